@@ -679,5 +679,6 @@ static const rtems_filesystem_file_handlers_r rtems_tfs_handlers = {
   .kqfilter_h = rtems_filesystem_default_kqfilter,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_filesystem_default_writev,
+  .sendfile_h = rtems_filesystem_default_sendfile
 };
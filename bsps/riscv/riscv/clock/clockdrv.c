@@ -248,6 +248,40 @@ RTEMS_SYSINIT_ITEM(
   RTEMS_SYSINIT_ORDER_FIRST
 );
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+static uint64_t riscv_clock_get_next_tick(riscv_timecounter *tc)
+{
+  uint32_t cpu = rtems_scheduler_get_processor();
+
+  return riscv_clock_read_mtime(&tc->clint->mtimecmp[cpu]);
+}
+
+static void riscv_clock_set_next_tick(riscv_timecounter *tc, uint64_t value)
+{
+  uint32_t cpu = rtems_scheduler_get_processor();
+
+  riscv_clock_write_mtimecmp(&tc->clint->mtimecmp[cpu], value);
+}
+
+#define Clock_driver_support_read_counter() \
+  riscv_clock_read_mtime(&riscv_clock_tc.clint->mtime)
+
+#define Clock_driver_support_get_next_tick() \
+  riscv_clock_get_next_tick(&riscv_clock_tc)
+
+#define Clock_driver_support_set_next_tick(value) \
+  riscv_clock_set_next_tick(&riscv_clock_tc, value)
+
+#define Clock_driver_support_tick_interval() riscv_clock_tc.interval
+
+/*
+ * The WFI instruction returns if an interrupt enabled in the mie register is
+ * pending regardless of the global interrupt enable in mstatus.
+ */
+#define Clock_driver_support_wait_for_interrupt() \
+  __asm__ volatile ("wfi" : : : "memory")
+#endif
+
 #define Clock_driver_support_at_tick() riscv_clock_at_tick(&riscv_clock_tc)
 
 #define Clock_driver_support_initialize_hardware() riscv_clock_initialize()
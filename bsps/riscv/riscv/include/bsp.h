@@ -66,6 +66,12 @@ extern "C" {
 
 #define BSP_FDT_IS_SUPPORTED
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+void *Clock_driver_tickless_idle_body(uintptr_t ignored);
+
+#define BSP_IDLE_TASK_BODY Clock_driver_tickless_idle_body
+#endif
+
 #ifdef __cplusplus
 }
 #endif
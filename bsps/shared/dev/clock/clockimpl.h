@@ -19,10 +19,12 @@
 
 #include <bsp.h>
 #include <rtems/clockdrv.h>
+#include <rtems/counter.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/smpimpl.h>
 #include <rtems/score/timecounter.h>
 #include <rtems/score/thread.h>
+#include <rtems/score/timestampimpl.h>
 #include <rtems/score/watchdogimpl.h>
 
 #ifdef Clock_driver_nanoseconds_since_last_tick
@@ -41,6 +43,24 @@
 #error "Fast Idle PLUS n ISRs per tick is not supported"
 #endif
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+  #if CLOCK_DRIVER_USE_FAST_IDLE || CLOCK_DRIVER_ISRS_PER_TICK
+    #error "Tickless Idle PLUS Fast Idle or n ISRs per tick is not supported"
+  #endif
+
+  #ifdef CLOCK_DRIVER_USE_ONLY_BOOT_PROCESSOR
+    #error "Tickless Idle PLUS boot processor only ticks is not supported"
+  #endif
+
+  #if !defined(Clock_driver_support_read_counter) || \
+    !defined(Clock_driver_support_get_next_tick) || \
+    !defined(Clock_driver_support_set_next_tick) || \
+    !defined(Clock_driver_support_tick_interval) || \
+    !defined(Clock_driver_support_wait_for_interrupt)
+    #error "Tickless Idle is not supported by this clock driver"
+  #endif
+#endif
+
 /**
  * @brief Do nothing by default.
  */
@@ -201,6 +221,129 @@ rtems_isr Clock_isr(
   #endif
 }
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+/*
+ * The timecounter must be updated before its counter wraps around, so limit
+ * the time without a clock interrupt to the half of the counter period.
+ */
+static uint64_t Clock_driver_tickless_get_ticks_maximum( void )
+{
+  const struct timecounter *tc;
+  uint64_t                  ns_per_tick;
+
+  tc = _Timecounter;
+  ns_per_tick = rtems_configuration_get_nanoseconds_per_tick();
+
+  return ( ( (uint64_t) tc->tc_counter_mask / 2 ) * 1000000000 )
+    / tc->tc_frequency / ns_per_tick;
+}
+
+static bool Clock_driver_tickless_may_skip_ticks( const Per_CPU_Control *cpu )
+{
+  if ( cpu->dispatch_necessary ) {
+    return false;
+  }
+
+  /*
+   * The boot processor updates the timecounter on behalf of all processors.
+   * The other processors use the timecounter in their clock tick.
+   */
+  return !_Per_CPU_Is_boot_processor( cpu )
+    || _SMP_Get_processor_maximum() == 1;
+}
+
+static void Clock_driver_tickless_wait(
+  Per_CPU_Control *cpu_self,
+  uint64_t         ticks
+)
+{
+  uint64_t            interval;
+  uint64_t            next;
+  uint64_t            now;
+  uint64_t            skipped;
+  rtems_counter_ticks begin;
+  Timestamp_Control   residency;
+
+  interval = Clock_driver_support_tick_interval();
+  next = Clock_driver_support_get_next_tick();
+
+  if ( Clock_driver_support_read_counter() >= next ) {
+    /* The clock interrupt is already pending */
+    return;
+  }
+
+  begin = rtems_counter_read();
+  Clock_driver_support_set_next_tick( next + ( ticks - 1 ) * interval );
+  Clock_driver_support_wait_for_interrupt();
+  now = Clock_driver_support_read_counter();
+
+  if ( now >= next ) {
+    skipped = ( now - next ) / interval;
+
+    if ( skipped >= ticks ) {
+      skipped = ticks - 1;
+    }
+  } else {
+    skipped = 0;
+  }
+
+  /*
+   * Program the last tick which elapsed.  The clock interrupt announces this
+   * tick as usual.  All ticks before it are accounted for here.
+   */
+  Clock_driver_support_set_next_tick( next + skipped * interval );
+  _Watchdog_Skip_ticks( cpu_self, skipped );
+
+  residency = rtems_counter_ticks_to_sbintime(
+    rtems_counter_difference( rtems_counter_read(), begin )
+  );
+  _Timestamp_Add_to( &cpu_self->Idle.residency, &residency );
+  cpu_self->Idle.wakeups_avoided += skipped;
+}
+
+/**
+ * @brief Idle thread body which avoids clock interrupts while no watchdog is
+ * due.
+ *
+ * The clock interrupt is programmed to the next expiration of a watchdog of
+ * the processor.  The clock ticks which elapsed without a clock interrupt are
+ * accounted for when the processor wakes up.
+ */
+void *Clock_driver_tickless_idle_body( uintptr_t ignored )
+{
+  uint64_t ticks_maximum;
+
+  (void) ignored;
+  ticks_maximum = Clock_driver_tickless_get_ticks_maximum();
+
+  while ( true ) {
+    ISR_Level        level;
+    Per_CPU_Control *cpu_self;
+    uint64_t         ticks;
+
+    _ISR_Local_disable( level );
+    cpu_self = _Per_CPU_Get();
+    cpu_self->Idle.tickless = true;
+
+    if ( Clock_driver_tickless_may_skip_ticks( cpu_self ) ) {
+      ticks = _Watchdog_Ticks_until_next_expiration( cpu_self, ticks_maximum );
+    } else {
+      ticks = 0;
+    }
+
+    if ( ticks > 1 ) {
+      Clock_driver_tickless_wait( cpu_self, ticks );
+    } else {
+      Clock_driver_support_wait_for_interrupt();
+    }
+
+    _ISR_Local_enable( level );
+  }
+
+  return NULL;
+}
+#endif
+
 void _Clock_Initialize( void )
 {
   Clock_driver_ticks = 0;
@@ -232,7 +232,8 @@ static const rtems_filesystem_file_handlers_r spi_bus_handler = {
   .mmap_h = rtems_filesystem_default_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_filesystem_default_writev,
+  .sendfile_h = rtems_filesystem_default_sendfile
 };
 
 static void spi_bus_node_destroy(IMFS_jnode_t *node)
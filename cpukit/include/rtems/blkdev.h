@@ -189,6 +189,7 @@ static inline void rtems_blkdev_request_done(
 #define RTEMS_BLKIO_PURGEDEV        _IO('B', 10)
 #define RTEMS_BLKIO_GETDEVSTATS     _IOR('B', 11, rtems_blkdev_stats *)
 #define RTEMS_BLKIO_RESETDEVSTATS   _IO('B', 12)
+#define RTEMS_BLKIO_GETMAPPEDAREA   _IOR('B', 13, void *)
 
 /** @} */
 
@@ -270,6 +271,17 @@ static inline int rtems_disk_fd_reset_device_stats(int fd)
  */
 #define RTEMS_BLKDEV_CAP_SYNC (1 << 1)
 
+/**
+ * @brief The device media is directly addressable memory.
+ *
+ * The driver returns the begin of the memory area with the
+ * @ref RTEMS_BLKIO_GETMAPPEDAREA IO control.  The block device buffer
+ * descriptors of such a device point directly into this memory area.  The
+ * device uses no cache buffers and the driver gets no transfer requests
+ * from the block device buffer.
+ */
+#define RTEMS_BLKDEV_CAP_MAPPED (1 << 2)
+
 /** @} */
 
 /**
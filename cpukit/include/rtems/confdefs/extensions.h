@@ -52,7 +52,19 @@
   #define CONFIGURE_MAXIMUM_USER_EXTENSIONS 0
 #endif
 
-#if CONFIGURE_MAXIMUM_USER_EXTENSIONS > 0
+/*
+ * The stack checker in the sampling mode creates one user extension in
+ * addition to the ones configured by the application.
+ */
+#if defined(CONFIGURE_STACK_CHECKER_ENABLED) \
+  && defined(CONFIGURE_STACK_CHECKER_SAMPLING)
+  #define _CONFIGURE_MAXIMUM_USER_EXTENSIONS \
+    ( CONFIGURE_MAXIMUM_USER_EXTENSIONS + 1 )
+#else
+  #define _CONFIGURE_MAXIMUM_USER_EXTENSIONS CONFIGURE_MAXIMUM_USER_EXTENSIONS
+#endif
+
+#if _CONFIGURE_MAXIMUM_USER_EXTENSIONS > 0
   #include <rtems/extensiondata.h>
 #endif
 
@@ -91,6 +103,8 @@
 
 #ifdef CONFIGURE_STACK_CHECKER_ENABLED
   #include <rtems/stackchk.h>
+#elif defined(CONFIGURE_STACK_CHECKER_SAMPLING)
+  #warning "CONFIGURE_STACK_CHECKER_SAMPLING defined without CONFIGURE_STACK_CHECKER_ENABLED"
 #endif
 
 #ifdef CONFIGURE_EXCEPTION_TO_SIGNAL_MAPPING
@@ -141,7 +155,11 @@ extern "C" {
       RTEMS_NEWLIB_EXTENSION,
     #endif
     #ifdef CONFIGURE_STACK_CHECKER_ENABLED
-      RTEMS_STACK_CHECKER_EXTENSION,
+      #ifdef CONFIGURE_STACK_CHECKER_SAMPLING
+        RTEMS_STACK_CHECKER_SAMPLING_EXTENSION,
+      #else
+        RTEMS_STACK_CHECKER_EXTENSION,
+      #endif
     #endif
     #ifdef CONFIGURE_INITIAL_EXTENSIONS
       CONFIGURE_INITIAL_EXTENSIONS,
@@ -166,8 +184,17 @@ extern "C" {
   );
 #endif
 
-#if CONFIGURE_MAXIMUM_USER_EXTENSIONS > 0
-  EXTENSION_INFORMATION_DEFINE( CONFIGURE_MAXIMUM_USER_EXTENSIONS );
+#if _CONFIGURE_MAXIMUM_USER_EXTENSIONS > 0
+  EXTENSION_INFORMATION_DEFINE( _CONFIGURE_MAXIMUM_USER_EXTENSIONS );
+#endif
+
+#if defined(CONFIGURE_STACK_CHECKER_ENABLED) \
+  && defined(CONFIGURE_STACK_CHECKER_SAMPLING)
+  RTEMS_SYSINIT_ITEM(
+    rtems_stack_checker_sampling_initialize,
+    RTEMS_SYSINIT_IDLE_THREADS,
+    RTEMS_SYSINIT_ORDER_LAST
+  );
 #endif
 
 #if CONFIGURE_RECORD_PER_PROCESSOR_ITEMS > 0
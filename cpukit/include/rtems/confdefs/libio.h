@@ -326,9 +326,32 @@ RTEMS_SYSINIT_ITEM(
 #endif /* !CONFIGURE_APPLICATION_DISABLE_FILESYSTEM */
 
 #if CONFIGURE_MAXIMUM_FILE_DESCRIPTORS > 0
+  #include <rtems/libio_.h>
+
+  /*
+   * The ring of free iops has a power of two size which is greater than or
+   * equal to the file descriptor maximum.
+   */
+  #define _CONFIGURE_LIBIO_RING_1( _n ) ( ( _n ) | ( ( _n ) >> 1 ) )
+  #define _CONFIGURE_LIBIO_RING_2( _n ) \
+    ( _CONFIGURE_LIBIO_RING_1( _n ) | ( _CONFIGURE_LIBIO_RING_1( _n ) >> 2 ) )
+  #define _CONFIGURE_LIBIO_RING_4( _n ) \
+    ( _CONFIGURE_LIBIO_RING_2( _n ) | ( _CONFIGURE_LIBIO_RING_2( _n ) >> 4 ) )
+  #define _CONFIGURE_LIBIO_RING_8( _n ) \
+    ( _CONFIGURE_LIBIO_RING_4( _n ) | ( _CONFIGURE_LIBIO_RING_4( _n ) >> 8 ) )
+  #define _CONFIGURE_LIBIO_RING_MASK \
+    ( _CONFIGURE_LIBIO_RING_8( CONFIGURE_MAXIMUM_FILE_DESCRIPTORS - 1 ) | \
+      ( _CONFIGURE_LIBIO_RING_8( CONFIGURE_MAXIMUM_FILE_DESCRIPTORS - 1 ) \
+        >> 16 ) )
+
   rtems_libio_t rtems_libio_iops[ CONFIGURE_MAXIMUM_FILE_DESCRIPTORS ];
 
   const uint32_t rtems_libio_number_iops = RTEMS_ARRAY_SIZE( rtems_libio_iops );
+
+  rtems_libio_iop_free_cell
+  rtems_libio_iop_free_ring[ _CONFIGURE_LIBIO_RING_MASK + 1 ];
+
+  const uint32_t rtems_libio_iop_free_ring_mask = _CONFIGURE_LIBIO_RING_MASK;
 #endif
 
 #ifdef __cplusplus
@@ -148,8 +148,8 @@ const size_t _Thread_Maximum_TLS_size =
 
 struct Thread_Configured_control {
   Thread_Control Control;
-  #if CONFIGURE_MAXIMUM_USER_EXTENSIONS > 0
-    void *extensions[ CONFIGURE_MAXIMUM_USER_EXTENSIONS + 1 ];
+  #if _CONFIGURE_MAXIMUM_USER_EXTENSIONS > 0
+    void *extensions[ _CONFIGURE_MAXIMUM_USER_EXTENSIONS + 1 ];
   #endif
   Configuration_Scheduler_node Scheduler_nodes[ _CONFIGURE_SCHEDULER_COUNT ];
   RTEMS_API_Control API_RTEMS;
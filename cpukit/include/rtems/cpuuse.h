@@ -97,6 +97,55 @@ struct rtems_printer;
  */
 int rtems_cpu_info_report( const struct rtems_printer *printer );
 
+/**
+ * @ingroup libmisc_cpuuse
+ *
+ * @brief Reports the wakeup latency histograms of each thread and priority
+ *   using the printer plugin.
+ *
+ * @param printer is the printer plugin to output the report.
+ *
+ * @par Notes
+ * The wakeup latency is the time from the unblock of a thread until it
+ * executes.  It is split into the time until the thread was selected as heir
+ * and the time until the context switch to the thread.  The statistics are
+ * only gathered if RTEMS was built with profiling enabled.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within device driver initialization
+ *   context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may obtain and release the object allocator mutex.  This may
+ *   cause the calling task to be preempted.
+ * @endparblock
+ */
+void rtems_cpu_usage_latency_report( const struct rtems_printer *printer );
+
+/**
+ * @ingroup libmisc_cpuuse
+ *
+ * @brief Resets the wakeup latency histograms of each thread and priority.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within device driver initialization
+ *   context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may obtain and release the object allocator mutex.  This may
+ *   cause the calling task to be preempted.
+ * @endparblock
+ */
+void rtems_cpu_usage_latency_reset( void );
+
 /* Generated from spec:/rtems/cpuuse/if/report */
 
 /**
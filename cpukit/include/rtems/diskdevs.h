@@ -275,6 +275,12 @@ struct rtems_disk_device {
    */
   void *driver_data;
 
+  /**
+   * @brief Begin of the memory area of a physical disk with the
+   * @ref RTEMS_BLKDEV_CAP_MAPPED capability, otherwise @c NULL.
+   */
+  void *mapped_area;
+
   /**
    * @brief Indicates that this disk should be deleted as soon as the last user
    * releases this disk.
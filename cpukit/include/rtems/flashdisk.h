@@ -76,10 +76,13 @@ extern "C" {
  * no erased pages it is queue on the used queue.
  *
  * The available queue is sorted from the least number available
- * to the most number of available pages. A segment that has just
- * been erased will placed at the end of the queue. A segment that
- * has only a few available pages will be used sooner and once
- * there are no available pages it is queued on the used queue.
+ * to the most number of available pages. Segments with the same
+ * number of available pages are sorted by the number of times they
+ * have been erased, so a segment that has just been erased is
+ * placed behind the empty segments with a lower erase count. A
+ * segment that has only a few available pages will be used sooner
+ * and once there are no available pages it is queued on the used
+ * queue.
  * The used queue hold segments that have no available pages and
  * is sorted from the least number of active pages to the most
  * number of active pages.
@@ -92,6 +95,22 @@ extern "C" {
  * they flagged as used and once the segment has only used pages
  * it is erased.
  *
+ * Blocks which are written once and never again keep their segments
+ * out of the compaction and the erase counts of the segments drift
+ * apart. If a wear level threshold is configured the active pages of
+ * the least erased segment are moved to an empty segment once its
+ * erase count is more than the threshold below the erase count of
+ * the most erased segment. The erase counts are kept in memory and
+ * start at zero each time the driver is initialized.
+ *
+ * If a background task priority is configured together with the
+ * background erase or background compact flags, a task per disk
+ * erases the used segments and compacts. The task does not hold the
+ * disk lock while the low level driver erases a segment. With more
+ * than one device the writes rotate over the devices and avoid the
+ * device with the segment being erased, so programming pages on one
+ * device overlaps the erase on another device.
+ *
  * A flash block driver like this never knows if a page is not
  * being used by the file-system. A typical file system is not
  * design with the idea of erasing a block on a disk once it is
@@ -136,6 +155,7 @@ extern "C" {
 #define RTEMS_FDISK_IOCTL_MONITORING   _IO('B', 131)
 #define RTEMS_FDISK_IOCTL_INFO_LEVEL   _IO('B', 132)
 #define RTEMS_FDISK_IOCTL_PRINT_STATUS _IO('B', 133)
+#define RTEMS_FDISK_IOCTL_ERASE_COUNTS _IO('B', 134)
 
 /**
  * @brief Flash Disk Monitoring Data allows a user to obtain
@@ -154,6 +174,9 @@ typedef struct rtems_fdisk_monitor_data
   uint32_t segs_used;
   uint32_t segs_failed;
   uint32_t seg_erases;
+  uint32_t seg_erases_min;
+  uint32_t seg_erases_max;
+  uint32_t wear_level_moves;
   uint32_t pages_desc;
   uint32_t pages_active;
   uint32_t pages_used;
@@ -161,6 +184,21 @@ typedef struct rtems_fdisk_monitor_data
   uint32_t info_level;
 } rtems_fdisk_monitor_data;
 
+/**
+ * @brief Flash Disk Erase Counts return the number of times each segment
+ * has been erased since the driver initialization.
+ *
+ * The segments are ordered by device and then by segment. Set the segment
+ * count to the size of the erase counts array before the
+ * RTEMS_FDISK_IOCTL_ERASE_COUNTS request. The request sets it to the
+ * number of segments of the disk and fills at most the array size.
+ */
+typedef struct rtems_fdisk_erase_counts
+{
+  uint32_t  segment_count;
+  uint32_t* erase_counts;
+} rtems_fdisk_erase_counts;
+
 /**
  * @brief Flash Segment Descriptor holds, number of continuous segments in the
  * device of this type, the base segment number in the device, the address
@@ -402,6 +440,29 @@ typedef struct rtems_flashdisk_config
    */
   uint32_t                       avail_compact_segs;
   uint32_t                       info_level;     /**< Default info level. */
+
+  /**
+   * The difference between the erase counts of the most and the least
+   * erased segment which triggers the static wear leveling.  The active
+   * pages of the least erased segment are then moved to an empty segment.
+   * Zero disables the static wear leveling.
+   */
+  uint32_t                       wear_level_threshold;
+
+  /**
+   * The priority of the background task which erases the used segments
+   * and compacts if RTEMS_FDISK_BACKGROUND_ERASE or
+   * RTEMS_FDISK_BACKGROUND_COMPACT is set.  Zero means no task is created
+   * and the application has to use the RTEMS_FDISK_IOCTL_ERASE_USED and
+   * RTEMS_FDISK_IOCTL_COMPACT requests.
+   */
+  rtems_task_priority            task_priority;
+
+  /**
+   * The stack size of the background task.  Zero selects twice the minimum
+   * stack size.
+   */
+  size_t                         task_stack_size;
 } rtems_flashdisk_config;
 
 /*
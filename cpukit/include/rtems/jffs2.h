@@ -16,8 +16,10 @@
 #define RTEMS_JFFS2_H
 
 #include <rtems/fs.h>
+#include <rtems/rtems/tasks.h>
 #include <sys/param.h>
 #include <sys/ioccom.h>
+#include <stdbool.h>
 #include <zlib.h>
 
 #ifdef __cplusplus
@@ -296,6 +298,9 @@ struct rtems_jffs2_flash_control {
    * This operation is optional and may be NULL.  This operation should wake up
    * a garbage collection thread.  The garbage collection thread should use the
    * RTEMS_JFFS2_ON_DEMAND_GARBAGE_COLLECTION IO control to carry out the work.
+   *
+   * As an alternative, the file system can start its own garbage collection
+   * task, see rtems_jffs2_mount_data::gc_task.
    */
   rtems_jffs2_trigger_garbage_collection trigger_garbage_collection;
 };
@@ -442,6 +447,124 @@ int rtems_jffs2_compressor_zlib_decompress(
   uint32_t datalen
 );
 
+/**
+ * @brief Size of the LZO compressor dictionary in entries.
+ */
+#define RTEMS_JFFS2_COMPRESSOR_LZO_DICT_SIZE 8192
+
+/**
+ * @brief LZO compressor control structure.
+ *
+ * The LZO1X-1 compressor is considerably faster than the ZLIB compressor,
+ * especially for the decompression, at the cost of a lower compression ratio.
+ * The compressed data is compatible with the LZO support of Linux.
+ */
+typedef struct {
+  rtems_jffs2_compressor_control super;
+
+  /**
+   * @brief Dictionary of the compressor.
+   */
+  uint16_t dict[RTEMS_JFFS2_COMPRESSOR_LZO_DICT_SIZE];
+
+  /**
+   * @brief Buffer for the worst case compressed size of a page.
+   */
+  unsigned char work[PAGE_SIZE + PAGE_SIZE / 16 + 64 + 3];
+} rtems_jffs2_compressor_lzo_control;
+
+/**
+ * @brief LZO compressor compress operation.
+ */
+uint16_t rtems_jffs2_compressor_lzo_compress(
+  rtems_jffs2_compressor_control *self,
+  unsigned char *data_in,
+  unsigned char *cdata_out,
+  uint32_t *datalen,
+  uint32_t *cdatalen
+);
+
+/**
+ * @brief LZO compressor decompress operation.
+ */
+int rtems_jffs2_compressor_lzo_decompress(
+  rtems_jffs2_compressor_control *self,
+  uint16_t comprtype,
+  unsigned char *cdata_in,
+  unsigned char *data_out,
+  uint32_t cdatalen,
+  uint32_t datalen
+);
+
+/**
+ * @brief JFFS2 garbage collection task configuration.
+ *
+ * The garbage collection task performs the garbage collection in the
+ * background, so that writes do not have to wait for the garbage collection
+ * to make room.  It works in incremental steps.  Each step holds the file
+ * system lock for at most about the step time and the task then gives way to
+ * other tasks for the step interval.
+ *
+ * @see rtems_jffs2_mount_data::gc_task.
+ */
+typedef struct {
+  /**
+   * @brief The priority of the garbage collection task.
+   *
+   * It should be lower than the priority of the tasks using the file system.
+   */
+  rtems_task_priority priority;
+
+  /**
+   * @brief The stack size of the garbage collection task.
+   *
+   * In case it is zero, then RTEMS_MINIMUM_STACK_SIZE is used.
+   */
+  size_t stack_size;
+
+  /**
+   * @brief The free blocks low watermark.
+   *
+   * The task starts to collect garbage if the count of free blocks drops
+   * below this value.  In case it is zero, then the garbage collection trigger
+   * level of the file system is used.
+   */
+  uint32_t free_blocks_low;
+
+  /**
+   * @brief The free blocks high watermark.
+   *
+   * Once started, the task collects garbage until the count of free blocks
+   * reaches this value or there is no more dirty space to reclaim.  In case it
+   * is less than the low watermark, then the low watermark is used.
+   */
+  uint32_t free_blocks_high;
+
+  /**
+   * @brief The maximum time in microseconds of one garbage collection step.
+   *
+   * A step carries out at least one garbage collection pass or block erase.
+   */
+  uint32_t step_time;
+
+  /**
+   * @brief The interval in clock ticks between two garbage collection steps.
+   *
+   * In case it is zero, then the task just yields the processor between two
+   * steps.
+   */
+  rtems_interval step_interval;
+
+  /**
+   * @brief Erase the blocks which contain only obsolete data when the task is
+   * idle.
+   *
+   * Otherwise, such blocks are erased on demand by the write which needs the
+   * space.
+   */
+  bool pre_erase;
+} rtems_jffs2_gc_task_config;
+
 /**
  * @brief JFFS2 mount options.
  *
@@ -459,6 +582,48 @@ typedef struct {
    * The compressor is optional and this pointer may be @c NULL.
    */
   rtems_jffs2_compressor_control *compressor_control;
+
+  /**
+   * @brief Minimum saving of the compression in percent.
+   *
+   * Compressed data which is not at least this much smaller than the
+   * uncompressed data is stored uncompressed.  Reading uncompressed data needs
+   * no decompression, so a small saving may not be worth the processor time.
+   * In case it is zero, then compressed data is stored if it is smaller.
+   */
+  uint8_t compressor_min_saving;
+
+  /**
+   * @brief Count of data nodes of a file written without a compression attempt
+   * after the compression was not beneficial for this file.
+   *
+   * This avoids futile compression attempts for files with incompressible
+   * content, for example already compressed files.  In case it is zero, then
+   * the compression is tried for each data node.
+   */
+  uint8_t compressor_backoff;
+
+  /**
+   * @brief Write and scan erase block summaries.
+   *
+   * A summary of the nodes of an erase block is written to the end of the
+   * block when it is full.  The mount reads the summary of a block instead of
+   * every node in the block, so the mount time depends on the count of erase
+   * blocks and not on the count of nodes.  The summary format is compatible
+   * with the Linux JFFS2 summary support.  A file system with summaries can be
+   * mounted without this option and the summaries are then ignored.
+   */
+  bool summary;
+
+  /**
+   * @brief Garbage collection task configuration.
+   *
+   * This configuration is optional and this pointer may be @c NULL.  In this
+   * case, no garbage collection task is started.  Otherwise, a task is created
+   * during mount and deleted during unmount, so the application configuration
+   * must account for one task per file system instance.
+   */
+  const rtems_jffs2_gc_task_config *gc_task;
 } rtems_jffs2_mount_data;
 
 /**
@@ -479,6 +644,54 @@ int rtems_jffs2_initialize(
   const void *data
 );
 
+/**
+ * @brief Count of bins of the write stall histogram.
+ *
+ * @see rtems_jffs2_statistics::write_stalls.
+ */
+#define RTEMS_JFFS2_WRITE_STALL_BINS 20
+
+/**
+ * @brief JFFS2 filesystem instance statistics.
+ *
+ * @see rtems_jffs2_info::statistics.
+ */
+typedef struct {
+  /**
+   * @brief Count of garbage collection steps of the garbage collection task.
+   */
+  uint32_t gc_steps;
+
+  /**
+   * @brief Count of garbage collection passes of the garbage collection task.
+   */
+  uint32_t gc_passes;
+
+  /**
+   * @brief Time in nanoseconds spent in garbage collection steps.
+   */
+  uint64_t gc_time;
+
+  /**
+   * @brief Count of erased blocks.
+   */
+  uint32_t erased_blocks;
+
+  /**
+   * @brief Count of blocks erased in advance by the garbage collection task.
+   */
+  uint32_t pre_erased_blocks;
+
+  /**
+   * @brief Histogram of the write durations.
+   *
+   * The bin with index i counts the writes which took 2^i up to but excluding
+   * 2^(i + 1) microseconds.  The first bin also counts the writes which took
+   * less than one microsecond and the last bin also counts all longer writes.
+   */
+  uint32_t write_stalls[RTEMS_JFFS2_WRITE_STALL_BINS];
+} rtems_jffs2_statistics;
+
 /**
  * @brief JFFS2 filesystem instance information.
  *
@@ -569,6 +782,11 @@ typedef struct {
    * Bad blocks are damaged.
    */
   uint32_t bad_blocks;
+
+  /**
+   * @brief Statistics since mount.
+   */
+  rtems_jffs2_statistics statistics;
 } rtems_jffs2_info;
 
 /**
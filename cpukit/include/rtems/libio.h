@@ -1014,6 +1014,35 @@ typedef int (*rtems_filesystem_mmap_t)(
   off_t off
 );
 
+/**
+ * @brief Transfers data from a node to another IO descriptor.
+ *
+ * The data is read starting at the offset of the source IO descriptor and
+ * written with the write handler of the destination IO descriptor.  File
+ * systems with contiguous storage may pass their storage directly to the
+ * destination write handler.  They must not hold a lock or a block device
+ * buffer while they call the destination write handler, since it may block
+ * or access the same device.  A @c NULL handler selects
+ * rtems_filesystem_default_sendfile().
+ *
+ * This handler is responsible to update the offset field of the source IO
+ * descriptor.
+ *
+ * @param[in, out] iop The IO pointer of the source.
+ * @param[in, out] out_iop The IO pointer of the destination.
+ * @param[in] count The count of characters to transfer.
+ *
+ * @retval non-negative Count of transferred characters.
+ * @retval -1 An error occurred.  The errno is set to indicate the error.
+ *
+ * @see rtems_filesystem_default_sendfile().
+ */
+typedef ssize_t (*rtems_filesystem_sendfile_t)(
+  rtems_libio_t *iop,
+  rtems_libio_t *out_iop,
+  size_t         count
+);
+
 /**
  * @brief File system node operations table.
  */
@@ -1034,6 +1063,7 @@ struct _rtems_filesystem_file_handlers_r {
   rtems_filesystem_readv_t readv_h;
   rtems_filesystem_writev_t writev_h;
   rtems_filesystem_mmap_t mmap_h;
+  rtems_filesystem_sendfile_t sendfile_h;
 };
 
 /**
@@ -1270,6 +1300,23 @@ int rtems_filesystem_default_mmap(
   off_t off
 );
 
+/**
+ * @brief Default sendfile handler.
+ *
+ * Transfers the data through an intermediate buffer with the read handler of
+ * the source and the write handler of the destination.  If the destination
+ * accepts less characters than were read, the offset of a regular file or
+ * block device source is moved back by the characters not written.  For other
+ * sources, for example pipes and terminals, these characters are lost.
+ *
+ * @see rtems_filesystem_sendfile_t.
+ */
+ssize_t rtems_filesystem_default_sendfile(
+  rtems_libio_t *iop,
+  rtems_libio_t *out_iop,
+  size_t         count
+);
+
 /** @} */
 
 /**
@@ -1589,6 +1636,59 @@ void rtems_libio_exit(void);
  */
 extern int rtems_mkdir(const char *path, mode_t mode);
 
+/**
+ * @brief Transfers data between file descriptors.
+ *
+ * This is similar to the Linux sendfile().  The data is passed from the
+ * source file system to the write handler of the destination without a copy
+ * to a user buffer, if the source file system supports this.
+ *
+ * @param out_fd The destination file descriptor.  The data is written at the
+ *   current file offset.
+ * @param in_fd The source file descriptor.
+ * @param[in, out] offset If not @c NULL, then the data is read starting at
+ *   this offset and the offset is updated to the end of the transferred data.
+ *   The file offset of @a in_fd is not changed in this case.  If @c NULL,
+ *   then the data is read starting at the file offset of @a in_fd and the
+ *   file offset is updated.
+ * @param count The count of characters to transfer.
+ *
+ * @retval non-negative Count of transferred characters.  It is less than
+ *   @a count at the end of the source file.
+ * @retval -1 An error occurred.  The @c errno indicates the error.
+ */
+ssize_t rtems_sendfile(int out_fd, int in_fd, off_t *offset, size_t count);
+
+/**
+ * @name Pipe Capacity
+ *
+ * The fcntl() commands F_GETPIPE_SZ and F_SETPIPE_SZ get and set the capacity
+ * of a pipe or FIFO similar to Linux.  The F_SETPIPE_SZ command returns the
+ * new capacity which is rounded up to a multiple of PIPE_BUF.  It fails with
+ * EBUSY if the pipe contains more data than the new capacity.  The commands
+ * are forwarded to the ioctl() handler of the file.
+ *
+ * A pipe with a capacity above the default passes blocking writes which do
+ * not fit into it directly to the readers.  The writer then returns once the
+ * readers consumed the whole write.  Readers wake up waiting writers in
+ * batches of half the pipe buffer, unless less space completes a write.
+ */
+/**@{**/
+
+#ifndef F_SETPIPE_SZ
+#define F_SETPIPE_SZ 1031
+#endif
+
+#ifndef F_GETPIPE_SZ
+#define F_GETPIPE_SZ 1032
+#endif
+
+#define RTEMS_IO_SET_PIPE_SIZE _IOWR('P', 1, int)
+
+#define RTEMS_IO_GET_PIPE_SIZE _IOR('P', 2, int)
+
+/** @} */
+
 /** @} */
 
 /**
@@ -1615,6 +1715,112 @@ extern int rtems_mkdir(const char *path, mode_t mode);
 
 /** @} */
 
+/**
+ * @brief Count of entries of the path component cache of a file system
+ * instance.
+ *
+ * This must be a power of two.
+ */
+#define RTEMS_FILESYSTEM_EVAL_PATH_CACHE_SIZE 32
+
+/**
+ * @brief Maximum length of a path component in the path component cache.
+ *
+ * Longer path components are not cached.
+ */
+#define RTEMS_FILESYSTEM_EVAL_PATH_CACHE_NAME_MAX 23
+
+/**
+ * @brief Size in bytes of a file system location in the path component cache.
+ */
+#define RTEMS_FILESYSTEM_EVAL_PATH_CACHE_LOCATION_SIZE 16
+
+/**
+ * @brief File system specific location of a directory or a directory entry in
+ * the path component cache.
+ *
+ * The file system stores in it what it needs to find the directory entry again
+ * without a directory search, for example a node pointer, an inode number and
+ * the offset of the directory entry, or a directory position.  Locations are
+ * compared byte by byte, so unused bytes must be zero.
+ */
+typedef union {
+  /**
+   * @brief A node pointer.
+   */
+  void *node;
+
+  /**
+   * @brief Values of 32 bits.
+   */
+  uint32_t values[ RTEMS_FILESYSTEM_EVAL_PATH_CACHE_LOCATION_SIZE / 4 ];
+
+  /**
+   * @brief The location bytes.
+   */
+  uint8_t bytes[ RTEMS_FILESYSTEM_EVAL_PATH_CACHE_LOCATION_SIZE ];
+} rtems_filesystem_eval_path_cache_location;
+
+/**
+ * @brief Path component cache entry.
+ *
+ * @see rtems_filesystem_eval_path_cache_enter().
+ */
+typedef struct {
+  /**
+   * @brief The location of the directory.
+   */
+  rtems_filesystem_eval_path_cache_location dir;
+
+  /**
+   * @brief The location of the directory entry.  It is unused if there is no
+   * such entry.
+   */
+  rtems_filesystem_eval_path_cache_location entry;
+
+  /**
+   * @brief The cache generation of this entry.  The entry is valid only if it
+   * is equal to the cache generation.
+   */
+  uint32_t generation;
+
+  /**
+   * @brief Indicates if the directory entry exists.  If it is false, then
+   * this is a negative entry.
+   */
+  bool exists;
+
+  /**
+   * @brief The length of the name.  A value of zero indicates an unused
+   * entry.
+   */
+  uint8_t namelen;
+
+  /**
+   * @brief The name of the directory entry.
+   */
+  char name[ RTEMS_FILESYSTEM_EVAL_PATH_CACHE_NAME_MAX ];
+} rtems_filesystem_eval_path_cache_entry;
+
+/**
+ * @brief Path component cache of a file system instance.
+ *
+ * The cache is protected by the file system instance lock.
+ */
+typedef struct {
+  /**
+   * @brief The cache generation.  It is incremented to invalidate all
+   * entries.
+   */
+  uint32_t generation;
+
+  /**
+   * @brief The cache entries.
+   */
+  rtems_filesystem_eval_path_cache_entry
+    entries[ RTEMS_FILESYSTEM_EVAL_PATH_CACHE_SIZE ];
+} rtems_filesystem_eval_path_cache;
+
 /**
  * @brief Mount table entry.
  */
@@ -1657,6 +1863,12 @@ struct rtems_filesystem_mount_table_entry_tt {
    * @see ClassicEventTransient.
    */
   rtems_id                               unmount_task;
+
+  /**
+   * The path component cache of this file system instance.  It is NULL, if
+   * the file system instance has no cache.
+   */
+  rtems_filesystem_eval_path_cache      *eval_path_cache;
 };
 
 /**
@@ -79,8 +79,43 @@ extern "C" {
 
 extern const uint32_t rtems_libio_number_iops;
 extern rtems_libio_t rtems_libio_iops[];
-extern void *rtems_libio_iop_free_head;
-extern void **rtems_libio_iop_free_tail;
+
+/**
+ * @brief A cell of the ring of free iops.
+ *
+ * The free iops are managed by a bounded multi-producer/multi-consumer queue
+ * without a lock.  The sequence number of a cell indicates for which ring
+ * position the cell is ready to be filled or emptied.  This avoids the ABA
+ * problem of lock-free lists.  Since the queue is first-in first-out, a freed
+ * iop is reused only after all other free iops.
+ */
+typedef struct {
+  Atomic_Uint    sequence;
+  rtems_libio_t *iop;
+} rtems_libio_iop_free_cell;
+
+/**
+ * @brief The ring of free iops.
+ *
+ * The ring size is a power of two which is greater than or equal to
+ * rtems_libio_number_iops.
+ */
+extern rtems_libio_iop_free_cell rtems_libio_iop_free_ring[];
+
+/**
+ * @brief The ring size minus one.
+ */
+extern const uint32_t rtems_libio_iop_free_ring_mask;
+
+/**
+ * @brief The ring position of the next free iop to append.
+ */
+extern Atomic_Uint rtems_libio_iop_free_enqueue;
+
+/**
+ * @brief The ring position of the next free iop to allocate.
+ */
+extern Atomic_Uint rtems_libio_iop_free_dequeue;
 
 extern const rtems_filesystem_file_handlers_r rtems_filesystem_null_handlers;
 
@@ -463,6 +498,30 @@ void rtems_libio_free(
   rtems_libio_t *iop
 );
 
+/**
+ * @brief Returns the count of free iops.
+ *
+ * The count is exact only if no iops are allocated or freed concurrently.
+ *
+ * @return The count of free iops.
+ */
+static inline uint32_t rtems_libio_free_count( void )
+{
+  unsigned int enqueue;
+  unsigned int dequeue;
+
+  dequeue = _Atomic_Load_uint(
+    &rtems_libio_iop_free_dequeue,
+    ATOMIC_ORDER_RELAXED
+  );
+  enqueue = _Atomic_Load_uint(
+    &rtems_libio_iop_free_enqueue,
+    ATOMIC_ORDER_RELAXED
+  );
+
+  return enqueue - dequeue;
+}
+
 /*
  *  File System Routine Prototypes
  */
@@ -572,9 +631,58 @@ typedef rtems_filesystem_eval_path_generic_status
   size_t tokenlen
 );
 
+/**
+ * @brief Gets the path component cache location of the current directory.
+ *
+ * @param[in, out] ctx The path evaluation context.
+ * @param[in, out] arg The handler argument.
+ * @param[out] dir The location of the current directory.  It must identify the
+ *   directory in the file system instance.  Unused bytes must be zero.
+ *
+ * @see rtems_filesystem_eval_path_generic().
+ */
+typedef void (*rtems_filesystem_eval_path_get_key)(
+  rtems_filesystem_eval_path_context_t *ctx,
+  void *arg,
+  rtems_filesystem_eval_path_cache_location *dir
+);
+
+/**
+ * @brief Evaluates a token with the directory entry location obtained from
+ * the path component cache.
+ *
+ * The handler must carry out the same checks as the token evaluation handler
+ * with the exception of the directory search.
+ *
+ * @param[in, out] ctx The path evaluation context.
+ * @param[in, out] arg The handler argument.
+ * @param[in] entry The location of the directory entry of the token.  It is
+ *   NULL if there is no such entry.
+ *
+ * @retval status The generic path evaluation status.
+ *
+ * @see rtems_filesystem_eval_path_generic().
+ */
+typedef rtems_filesystem_eval_path_generic_status
+(*rtems_filesystem_eval_path_eval_entry)(
+  rtems_filesystem_eval_path_context_t *ctx,
+  void *arg,
+  const rtems_filesystem_eval_path_cache_location *entry
+);
+
+/**
+ * @brief Generic path evaluation configuration.
+ *
+ * The get key and evaluate entry handlers are optional.  If they are present,
+ * then the path component cache of the file system instance is used.  The
+ * token evaluation handler should then enter the search results with
+ * rtems_filesystem_eval_path_cache_enter() into the cache.
+ */
 typedef struct {
   rtems_filesystem_eval_path_is_directory is_directory;
   rtems_filesystem_eval_path_eval_token eval_token;
+  rtems_filesystem_eval_path_get_key get_key;
+  rtems_filesystem_eval_path_eval_entry eval_entry;
 } rtems_filesystem_eval_path_generic_config;
 
 void rtems_filesystem_eval_path_generic(
@@ -583,6 +691,64 @@ void rtems_filesystem_eval_path_generic(
   const rtems_filesystem_eval_path_generic_config *config
 );
 
+/**
+ * @brief Looks up a directory entry in the path component cache.
+ *
+ * The file system instance lock must be held.
+ *
+ * @param[in] mt_entry The file system instance.
+ * @param[in] dir The location of the directory.
+ * @param[in] name The name of the directory entry.
+ * @param[in] namelen The name length in characters.
+ * @param[out] entry The location of the directory entry.  It is not changed
+ *   if there is no such entry.
+ * @param[out] exists Indicates if the directory entry exists.
+ *
+ * @retval true The cache contains the directory entry.
+ * @retval false Otherwise.
+ */
+bool rtems_filesystem_eval_path_cache_lookup(
+  const rtems_filesystem_mount_table_entry_t *mt_entry,
+  const rtems_filesystem_eval_path_cache_location *dir,
+  const char *name,
+  size_t namelen,
+  rtems_filesystem_eval_path_cache_location *entry,
+  bool *exists
+);
+
+/**
+ * @brief Enters a directory entry into the path component cache.
+ *
+ * The file system instance lock must be held.  Names longer than
+ * RTEMS_FILESYSTEM_EVAL_PATH_CACHE_NAME_MAX are ignored.
+ *
+ * @param[in] mt_entry The file system instance.
+ * @param[in] dir The location of the directory.
+ * @param[in] name The name of the directory entry.
+ * @param[in] namelen The name length in characters.
+ * @param[in] entry The location of the directory entry.  Use NULL to record
+ *   that there is no such entry.
+ */
+void rtems_filesystem_eval_path_cache_enter(
+  rtems_filesystem_mount_table_entry_t *mt_entry,
+  const rtems_filesystem_eval_path_cache_location *dir,
+  const char *name,
+  size_t namelen,
+  const rtems_filesystem_eval_path_cache_location *entry
+);
+
+/**
+ * @brief Invalidates all entries of the path component cache.
+ *
+ * This function must be called with the file system instance lock held after
+ * each change of the directory structure.
+ *
+ * @param[in] mt_entry The file system instance.
+ */
+void rtems_filesystem_eval_path_cache_flush(
+  rtems_filesystem_mount_table_entry_t *mt_entry
+);
+
 void rtems_filesystem_initialize(void);
 
 /**
@@ -18,6 +18,8 @@
 #ifndef _RTEMS_PIPE_H
 #define _RTEMS_PIPE_H
 
+#include <limits.h>
+
 #include <rtems/libio.h>
 #include <rtems/thread.h>
 
@@ -34,16 +36,29 @@
 extern "C" {
 #endif
 
+/*
+ * Default pipe capacity, see F_SETPIPE_SZ.  Only pipes with a larger capacity
+ * use direct writes and wake up writers in batches.
+ */
+#define PIPE_DEFAULT_CAPACITY PIPE_BUF
+
+/* Maximum pipe capacity, see F_SETPIPE_SZ */
+#define PIPE_MAX_CAPACITY (1024 * 1024)
+
 /* Control block to manage each pipe */
 typedef struct pipe_control {
   char *Buffer;
-  unsigned int Size;
+  unsigned int Size;      /* grows on demand up to the capacity */
+  unsigned int Capacity;
   unsigned int Start;
   unsigned int Length;
+  const char *DirectBuffer;   /* buffer lent by a blocked writer */
+  size_t DirectLength;
   unsigned int Readers;
   unsigned int Writers;
   unsigned int waitingReaders;
   unsigned int waitingWriters;
+  unsigned int writerNeed;        /* least space a waiting writer needs */
   unsigned int readerCounter;     /* incremental counters */
   unsigned int writerCounter;     /* for differentiation of successive opens */
   rtems_mutex Mutex;
@@ -39,6 +39,7 @@
 #include <errno.h>
 #include <pthread.h>
 
+#include <rtems/posix/muteximpl.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/threadqimpl.h>
 
@@ -151,6 +152,34 @@ RTEMS_INLINE_ROUTINE void _POSIX_Condition_variables_Release(
   );
 }
 
+/**
+ * @brief Checks if the threads waiting for the condition variable may be moved
+ * to the thread queue of the mutex in a broadcast.
+ *
+ * The threads are moved only to initialized, non-recursive mutexes without a
+ * locking protocol.  The FIFO thread queue of these mutexes does not depend
+ * on the owner.  On a surrender of the mutex, the ownership is handed over to
+ * the first moved thread.
+ *
+ * @param the_mutex The mutex associated with the condition variable.
+ *
+ * @retval true The waiting threads may be moved to the mutex.
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _POSIX_Condition_variables_Is_requeue_mutex(
+  const POSIX_Mutex_Control *the_mutex
+)
+{
+  unsigned long flags;
+
+  flags = the_mutex->flags;
+
+  return ( ( (uintptr_t) the_mutex ^ POSIX_MUTEX_MAGIC )
+      & ~POSIX_MUTEX_FLAGS_MASK ) == ( flags & ~POSIX_MUTEX_FLAGS_MASK )
+    && _POSIX_Mutex_Get_protocol( flags ) == POSIX_MUTEX_NO_PROTOCOL
+    && !_POSIX_Mutex_Is_recursive( flags );
+}
+
 /**
  * @brief Implements wake up version of the "signal" operation.
  * 
@@ -59,7 +59,9 @@ typedef struct {
 
 #define POSIX_MUTEX_RECURSIVE 0x4UL
 
-#define POSIX_MUTEX_FLAGS_MASK 0x7UL
+#define POSIX_MUTEX_ADAPTIVE 0x8UL
+
+#define POSIX_MUTEX_FLAGS_MASK 0xfUL
 
 #define POSIX_MUTEX_MAGIC 0x961c13b8UL
 
@@ -133,6 +135,40 @@ RTEMS_INLINE_ROUTINE bool _POSIX_Mutex_Is_recursive(
   return ( flags & POSIX_MUTEX_RECURSIVE ) != 0;
 }
 
+RTEMS_INLINE_ROUTINE bool _POSIX_Mutex_Is_adaptive(
+  unsigned long flags
+)
+{
+  return ( flags & POSIX_MUTEX_ADAPTIVE ) != 0;
+}
+
+#if defined(RTEMS_SMP)
+/**
+ * @brief Busy waits while the owner of the adaptive mutex executes on
+ *   another processor.
+ *
+ * Adaptive mutexes cannot use the priority ceiling protocol.  The priority
+ * value of their otherwise unused priority ceiling node stores the spin
+ * estimate, see _Thread_queue_Spin_while_owner_executes().  This function
+ * shall be called with interrupts enabled and without the mutex lock.
+ *
+ * @param[in, out] the_mutex The adaptive mutex.
+ * @param executing The executing thread.
+ */
+RTEMS_INLINE_ROUTINE void _POSIX_Mutex_Spin(
+  POSIX_Mutex_Control  *the_mutex,
+  const Thread_Control *executing
+)
+{
+  the_mutex->Priority_ceiling.priority =
+    _Thread_queue_Spin_while_owner_executes(
+      &the_mutex->Recursive.Mutex.Queue.Queue,
+      executing,
+      (uint32_t) the_mutex->Priority_ceiling.priority
+    );
+}
+#endif
+
 RTEMS_INLINE_ROUTINE Thread_Control *_POSIX_Mutex_Get_owner(
   const POSIX_Mutex_Control *the_mutex
 )
@@ -55,6 +55,46 @@ extern "C" {
  */
 /**@{**/
 
+#ifndef PTHREAD_MUTEX_ADAPTIVE_NP
+/**
+ * @brief Mutex type of a non-recursive mutex which busy waits for a bounded
+ *   time while the owner executes on another processor before the calling
+ *   thread blocks.
+ *
+ * Temporarily defined, will be shipped with a Newlib update.  This mutex
+ * type cannot be combined with the PTHREAD_PRIO_PROTECT protocol.
+ */
+#define PTHREAD_MUTEX_ADAPTIVE_NP 4
+#endif
+
+#ifndef PTHREAD_RWLOCK_DEFAULT_NP
+/**
+ * @brief RWLock kind of the default RWLock.
+ *
+ * Temporarily defined, will be shipped with a Newlib update.
+ */
+#define PTHREAD_RWLOCK_DEFAULT_NP 0
+
+/**
+ * @brief RWLock kind of a scalable RWLock for read-mostly data.
+ *
+ * Readers obtain the RWLock without writing to the RWLock object.  Writers
+ * have to wait for these readers and are more expensive.
+ *
+ * Temporarily defined, will be shipped with a Newlib update.
+ */
+#define PTHREAD_RWLOCK_SCALABLE_NP 1
+
+/* Temporarily defined, will be shipped with a Newlib update */
+int pthread_rwlockattr_setkind_np( pthread_rwlockattr_t *attr, int kind );
+
+/* Temporarily defined, will be shipped with a Newlib update */
+int pthread_rwlockattr_getkind_np(
+  const pthread_rwlockattr_t *attr,
+  int                        *kind
+);
+#endif
+
 /**
  *  For now, we are only allowing the user to specify the entry point
  *  and stack size for POSIX initialization threads.
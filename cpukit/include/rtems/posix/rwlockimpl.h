@@ -47,8 +47,20 @@
 extern "C" {
 #endif
 
+#define POSIX_RWLOCK_SCALABLE 0x1UL
+
+#define POSIX_RWLOCK_FLAGS_MASK 0x1UL
+
 #define POSIX_RWLOCK_MAGIC 0x9621dabdUL
 
+/*
+ * The layout of pthread_rwlockattr_t is defined by Newlib.  The RWLock kind
+ * is stored in the upper bits of the process-shared attribute.
+ */
+#define POSIX_RWLOCK_ATTR_PSHARED_MASK 0xff
+
+#define POSIX_RWLOCK_ATTR_KIND_SHIFT 8
+
 typedef struct {
   unsigned long flags;
   CORE_RWLock_Control RWLock;
@@ -61,6 +73,67 @@ RTEMS_INLINE_ROUTINE POSIX_RWLock_Control *_POSIX_RWLock_Get(
   return (POSIX_RWLock_Control *) rwlock;
 }
 
+RTEMS_INLINE_ROUTINE int _POSIX_RWLock_Attr_get_pshared(
+  const pthread_rwlockattr_t *attr
+)
+{
+  return attr->process_shared & POSIX_RWLOCK_ATTR_PSHARED_MASK;
+}
+
+RTEMS_INLINE_ROUTINE int _POSIX_RWLock_Attr_get_kind(
+  const pthread_rwlockattr_t *attr
+)
+{
+  return attr->process_shared >> POSIX_RWLOCK_ATTR_KIND_SHIFT;
+}
+
+RTEMS_INLINE_ROUTINE bool _POSIX_RWLock_Is_scalable(
+  const POSIX_RWLock_Control *the_rwlock
+)
+{
+  return ( the_rwlock->flags & POSIX_RWLOCK_SCALABLE ) != 0;
+}
+
+/**
+ * @brief Tries to obtain the RWLock for reading through the reader fast path
+ *   of scalable RWLocks.
+ *
+ * @param[in, out] the_rwlock is the RWLock.
+ *
+ * @retval true The RWLock was obtained for reading.
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _POSIX_RWLock_Seize_for_reading_biased(
+  POSIX_RWLock_Control *the_rwlock
+)
+{
+  return _POSIX_RWLock_Is_scalable( the_rwlock )
+    && _CORE_RWLock_Seize_for_reading_biased(
+      &the_rwlock->RWLock,
+      _Thread_Get_executing()
+    );
+}
+
+/**
+ * @brief Revokes the reader fast path of scalable RWLocks after the RWLock
+ *   was obtained for writing.
+ *
+ * @param[in, out] the_rwlock is the RWLock.
+ * @param status is the status of the RWLock seize for writing.
+ * @param wait indicates whether the calling thread is willing to wait for the
+ *   fast path readers.
+ * @param[in, out] queue_context is the thread queue context used to wait for
+ *   the fast path readers, see _CORE_RWLock_Revoke_bias().
+ *
+ * @return Returns the status of the RWLock seize for writing.
+ */
+Status_Control _POSIX_RWLock_Revoke_bias(
+  POSIX_RWLock_Control *the_rwlock,
+  Status_Control        status,
+  bool                  wait,
+  Thread_queue_Context *queue_context
+);
+
 bool _POSIX_RWLock_Auto_initialization( POSIX_RWLock_Control *the_rwlock );
 
 #define POSIX_RWLOCK_VALIDATE_OBJECT( rw ) \
@@ -68,7 +141,11 @@ bool _POSIX_RWLock_Auto_initialization( POSIX_RWLock_Control *the_rwlock );
     if ( ( rw ) == NULL ) { \
       return EINVAL; \
     } \
-    if ( ( (uintptr_t) ( rw ) ^ POSIX_RWLOCK_MAGIC ) != ( rw )->flags ) { \
+    if ( \
+      ( ( (uintptr_t) ( rw ) ^ POSIX_RWLOCK_MAGIC ) \
+          & ~POSIX_RWLOCK_FLAGS_MASK ) \
+        != ( ( rw )->flags & ~POSIX_RWLOCK_FLAGS_MASK ) \
+    ) { \
       if ( !_POSIX_RWLock_Auto_initialization( rw ) ) { \
         return EINVAL; \
       } \
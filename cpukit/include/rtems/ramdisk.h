@@ -135,6 +135,11 @@ typedef struct ramdisk {
    * @brief Free the RAM disk at the block device delete request.
    */
   bool free_at_delete_request;
+
+  /**
+   * @brief Map the block device buffers directly to the RAM disk memory area.
+   */
+  bool mapped;
 } ramdisk;
 
 int ramdisk_ioctl(rtems_disk_device *dd, uint32_t req, void *argp);
@@ -195,6 +200,22 @@ static inline void ramdisk_enable_free_at_delete_request(ramdisk *rd)
   rd->free_at_delete_request = true;
 }
 
+/**
+ * @brief Enables the mapping of the block device buffers to the RAM disk
+ * memory area.
+ *
+ * The RAM disk then reports the @ref RTEMS_BLKDEV_CAP_MAPPED capability.  The
+ * block device buffer descriptors point directly into the RAM disk memory
+ * area, so that no block is copied between the RAM disk and the block device
+ * buffer cache.  The cache memory is still allocated and is used by the other
+ * devices.  This must be called before the RAM disk is registered with
+ * rtems_blkdev_create().
+ */
+static inline void ramdisk_enable_mapping(ramdisk *rd)
+{
+  rd->mapped = true;
+}
+
 /**
  * @brief Allocates, initializes and registers a RAM disk.
  *
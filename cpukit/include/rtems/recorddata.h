@@ -55,7 +55,7 @@ extern "C" {
  * The record version reflects the record event definitions.  It is reported by
  * the RTEMS_RECORD_VERSION event.
  */
-#define RTEMS_RECORD_THE_VERSION 9
+#define RTEMS_RECORD_THE_VERSION 10
 
 /**
  * @brief The items are in 32-bit little-endian format.
@@ -369,6 +369,7 @@ typedef enum {
   RTEMS_RECORD_THREAD_DELETE,
   RTEMS_RECORD_THREAD_DISPATCH_DISABLE,
   RTEMS_RECORD_THREAD_DISPATCH_ENABLE,
+  RTEMS_RECORD_THREAD_DISPATCH_LATENCY,
   RTEMS_RECORD_THREAD_EXIT,
   RTEMS_RECORD_THREAD_EXITTED,
   RTEMS_RECORD_THREAD_ID,
@@ -390,6 +391,7 @@ typedef enum {
   RTEMS_RECORD_THREAD_RESOURCE_OBTAIN,
   RTEMS_RECORD_THREAD_RESOURCE_RELEASE,
   RTEMS_RECORD_THREAD_RESTART,
+  RTEMS_RECORD_THREAD_SCHEDULE_LATENCY,
   RTEMS_RECORD_THREAD_STACK_CURRENT,
   RTEMS_RECORD_THREAD_STACK_SIZE,
   RTEMS_RECORD_THREAD_STACK_USAGE,
@@ -437,8 +439,6 @@ typedef enum {
   RTEMS_RECORD_WRITEV_EXIT,
 
   /* Unused system events */
-  RTEMS_RECORD_SYSTEM_341,
-  RTEMS_RECORD_SYSTEM_342,
   RTEMS_RECORD_SYSTEM_343,
   RTEMS_RECORD_SYSTEM_344,
   RTEMS_RECORD_SYSTEM_345,
@@ -112,6 +112,8 @@ typedef struct rtems_rfs_bitmap_control_s
   size_t                   free;        //< Number of bits in the map that are
                                         //free (clear).
   rtems_rfs_bitmap_map     search_bits; //< The search bit map memory.
+  size_t                   free_run;    //< Upper limit of the longest run of
+                                        //free bits in the map.
 } rtems_rfs_bitmap_control;
 
 /**
@@ -172,6 +174,12 @@ typedef struct rtems_rfs_bitmap_control_s
  */
 #define rtems_rfs_bitmap_map_free(_c) ((_c)->free)
 
+/**
+ * Return the upper limit of the longest run of free bits in the bitmap. No run
+ * longer than this can be allocated from the map.
+ */
+#define rtems_rfs_bitmap_map_free_run(_c) ((_c)->free_run)
+
 /**
  * Return the buffer handle.
  */
@@ -285,6 +293,41 @@ int rtems_rfs_bitmap_map_alloc (rtems_rfs_bitmap_control* control,
                                 bool*                     allocate,
                                 rtems_rfs_bitmap_bit*     bit);
 
+/**
+ * Find and allocate a run of free bits. The search starts at the seed and
+ * moves up to the end of the map then wraps to the start of the map so runs
+ * allocated in succession follow each other. Nothing is allocated if no run of
+ * the requested length is free and the map's free run limit is updated to the
+ * longest run found.
+ * @param[in] control is the map control.
+ * @param[in] seed is the bit to search up from.
+ * @param[in] count is the number of bits in the run.
+ * @param[out] allocated A run was allocated.
+ * @param[out] bit will contain the first bit of the run if allocated.
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_bitmap_map_alloc_run (rtems_rfs_bitmap_control* control,
+                                    rtems_rfs_bitmap_bit      seed,
+                                    size_t                    count,
+                                    bool*                     allocated,
+                                    rtems_rfs_bitmap_bit*     bit);
+
+/**
+ * Set the free bits following a bit until a set bit or the end of the map is
+ * reached or count bits have been set.
+ * @param[in] control is the map control.
+ * @param[in] bit is the first bit to set.
+ * @param[in] count is the maximum number of bits to set.
+ * @param[out] set will contain the number of bits set.
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_bitmap_map_set_run (rtems_rfs_bitmap_control* control,
+                                  rtems_rfs_bitmap_bit      bit,
+                                  size_t                    count,
+                                  size_t*                   set);
+
 /**
  * Create a search bit map from the actual bit map.
  *
@@ -143,6 +143,18 @@ typedef struct rtems_rfs_block_map_s
    */
   rtems_rfs_buffer_handle doubly_buffer;
 
+  /**
+   * The first block of the run of blocks reserved for the map to grow into.
+   * The blocks are allocated in the bitmaps. They are only held while a write
+   * request is being processed and are released before it returns.
+   */
+  rtems_rfs_block_no reserved;
+
+  /**
+   * The number of blocks reserved.
+   */
+  size_t reserved_count;
+
 } rtems_rfs_block_map;
 
 /**
@@ -297,6 +309,37 @@ int rtems_rfs_block_map_next_block (rtems_rfs_file_system*  fs,
                                     rtems_rfs_block_map*    map,
                                     rtems_rfs_buffer_block* block);
 
+/**
+ * Reserve a run of blocks for the map to grow into. Growing the map takes the
+ * blocks from the reservation so a large write allocates its blocks with one
+ * bitmap search and the blocks are contiguous. Nothing is done if blocks are
+ * already reserved. The reserved blocks are allocated in the bitmaps so the
+ * caller must release the blocks it does not use with
+ * rtems_rfs_block_map_release_reserve() before the map is written back.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] map is a pointer to the open map.
+ * @param[in] blocks is the number of blocks the map is about to grow by.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_block_map_reserve (rtems_rfs_file_system* fs,
+                                 rtems_rfs_block_map*   map,
+                                 size_t                 blocks);
+
+/**
+ * Return the blocks reserved for the map and not used to the bitmaps.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] map is a pointer to the open map.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_block_map_release_reserve (rtems_rfs_file_system* fs,
+                                         rtems_rfs_block_map*   map);
+
 /**
  * Grow the block map by the specified number of blocks.
  *
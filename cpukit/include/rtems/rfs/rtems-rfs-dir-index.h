@@ -0,0 +1,266 @@
+/**
+ * @file
+ *
+ * @brief RTEMS File System Directory Index
+ *
+ * @ingroup rtems_rfs
+ *
+ * RTEMS File System Directory Index
+ *
+ * The directory index is an in memory hash table of the entries of a large
+ * directory. It maps the hash of an entry's name to the block of the
+ * directory the entry is held in and records the space used in each block of
+ * the directory. A look up only needs to read the blocks holding entries with
+ * a matching hash and adding an entry goes straight to the first block with
+ * enough space. The index is built from the directory blocks when a
+ * directory is first searched so the disk format is not changed and all
+ * volumes are supported. The number of directories indexed is set when the
+ * file system is mounted. The least recently used index is released when the
+ * limit is reached unless it has been used recently. In that case the large
+ * directories being searched do not fit in the indexes, releasing an index
+ * would only have it built again, and the directory is scanned instead.
+ */
+
+/*
+ *  Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if !defined (_RTEMS_RFS_DIR_INDEX_H_)
+#define _RTEMS_RFS_DIR_INDEX_H_
+
+#include <rtems/chain.h>
+
+#include <rtems/rfs/rtems-rfs-file-system.h>
+
+/**
+ * The minimum number of blocks a directory needs before it is indexed. Small
+ * directories are quicker to scan than to index.
+ */
+#define RTEMS_RFS_DIR_INDEX_MIN_BLOCKS (4)
+
+/**
+ * The default maximum number of directories indexed at any one time. The
+ * "max-dir-indexes" mount option overrides it and 0 disables the index.
+ */
+#define RTEMS_RFS_DIR_INDEX_MAX (8)
+
+/**
+ * The least recently used index is not released to index another directory
+ * if it has been used in the last number of index look ups given by the
+ * maximum number of indexes times this factor.
+ */
+#define RTEMS_RFS_DIR_INDEX_REUSE_FACTOR (2)
+
+/**
+ * A slot in the index's hash table. A block number of 0 is an empty slot so
+ * the directory's block number plus one is held.
+ */
+typedef struct _rtems_rfs_dir_index_slot
+{
+  /**
+   * The hash of the entry's name.
+   */
+  uint32_t hash;
+
+  /**
+   * The directory block the entry is in plus 1.
+   */
+  uint32_t bno;
+} rtems_rfs_dir_index_slot;
+
+/**
+ * The index of a directory.
+ */
+typedef struct _rtems_rfs_dir_index
+{
+  /**
+   * The node on the file system's list of indexes.
+   */
+  rtems_chain_node link;
+
+  /**
+   * The ino of the directory this index is for.
+   */
+  rtems_rfs_ino ino;
+
+  /**
+   * The file system's index clock when the index was last used.
+   */
+  uint32_t last_used;
+
+  /**
+   * The number of blocks in the directory.
+   */
+  uint32_t blocks;
+
+  /**
+   * The number of elements in the used table.
+   */
+  uint32_t used_size;
+
+  /**
+   * The number of bytes used by entries in each block of the directory.
+   */
+  uint32_t* used;
+
+  /**
+   * The number of entries held in the hash table.
+   */
+  uint32_t entries;
+
+  /**
+   * The hash table size less 1. The size is a power of 2.
+   */
+  uint32_t mask;
+
+  /**
+   * The hash table of the entries.
+   */
+  rtems_rfs_dir_index_slot* slots;
+} rtems_rfs_dir_index;
+
+/**
+ * Find the index of a directory. A found index becomes the most recently
+ * used index. Every call advances the file system's index clock.
+ *
+ * @param[in] fs is the file system.
+ * @param[in] ino is the ino of the directory.
+ *
+ * @retval index The index of the directory.
+ * @retval NULL The directory is not indexed.
+ */
+rtems_rfs_dir_index* rtems_rfs_dir_index_find (rtems_rfs_file_system* fs,
+                                               rtems_rfs_ino          ino);
+
+/**
+ * Create an empty index for a directory. The least recently used index is
+ * released if the maximum number of indexes has been reached and it has not
+ * been used recently.
+ *
+ * @param[in] fs is the file system.
+ * @param[in] ino is the ino of the directory.
+ *
+ * @retval index The new index of the directory.
+ * @retval NULL Indexing is disabled, the indexes are all in use or there is
+ *              not enough memory for the index.
+ */
+rtems_rfs_dir_index* rtems_rfs_dir_index_create (rtems_rfs_file_system* fs,
+                                                 rtems_rfs_ino          ino);
+
+/**
+ * Release the index of a directory if the directory is indexed.
+ *
+ * @param[in] fs is the file system.
+ * @param[in] ino is the ino of the directory.
+ */
+void rtems_rfs_dir_index_drop (rtems_rfs_file_system* fs, rtems_rfs_ino ino);
+
+/**
+ * Release all the indexes held by the file system.
+ *
+ * @param[in] fs is the file system.
+ */
+void rtems_rfs_dir_index_drop_all (rtems_rfs_file_system* fs);
+
+/**
+ * Add an entry to the index.
+ *
+ * @param[in] index is the index.
+ * @param[in] hash is the hash of the entry's name.
+ * @param[in] bno is the directory block the entry is in.
+ *
+ * @retval 0 Successful operation.
+ * @retval ENOMEM There is not enough memory to grow the index.
+ */
+int rtems_rfs_dir_index_add (rtems_rfs_dir_index* index,
+                             uint32_t             hash,
+                             rtems_rfs_block_no   bno);
+
+/**
+ * Remove an entry from the index.
+ *
+ * @param[in] index is the index.
+ * @param[in] hash is the hash of the entry's name.
+ * @param[in] bno is the directory block the entry is in.
+ *
+ * @retval true The entry was removed.
+ * @retval false The entry is not in the index.
+ */
+bool rtems_rfs_dir_index_remove (rtems_rfs_dir_index* index,
+                                 uint32_t             hash,
+                                 rtems_rfs_block_no   bno);
+
+/**
+ * Iterate over the directory blocks holding entries with a hash. Set the
+ * iterator to 0 to start.
+ *
+ * @param[in] index is the index.
+ * @param[in] hash is the hash to look for.
+ * @param[in,out] iterator is the position in the index.
+ * @param[out] bno is the directory block of the next entry with the hash.
+ *
+ * @retval true There is another entry with the hash.
+ * @retval false There are no more entries with the hash.
+ */
+bool rtems_rfs_dir_index_next (const rtems_rfs_dir_index* index,
+                               uint32_t                   hash,
+                               uint32_t*                  iterator,
+                               rtems_rfs_block_no*        bno);
+
+/**
+ * Set the number of bytes used in a directory block. The number of blocks in
+ * the directory grows to include the block.
+ *
+ * @param[in] index is the index.
+ * @param[in] bno is the directory block.
+ * @param[in] used is the number of bytes used in the block.
+ *
+ * @retval 0 Successful operation.
+ * @retval ENOMEM There is not enough memory to grow the index.
+ */
+int rtems_rfs_dir_index_set_used (rtems_rfs_dir_index* index,
+                                  rtems_rfs_block_no   bno,
+                                  uint32_t             used);
+
+/**
+ * Return the first directory block with space for an entry.
+ *
+ * @param[in] index is the index.
+ * @param[in] block_size is the size of a block.
+ * @param[in] size is the size of the entry including the header.
+ *
+ * @return The directory block. If it is the number of blocks in the directory
+ *         no block has space and the directory needs to grow.
+ */
+rtems_rfs_block_no rtems_rfs_dir_index_space (const rtems_rfs_dir_index* index,
+                                              size_t                     block_size,
+                                              size_t                     size);
+
+/**
+ * Return the number of bytes used in a directory block.
+ *
+ * @param[in] _i is the index.
+ * @param[in] _b is the directory block.
+ */
+#define rtems_rfs_dir_index_used(_i, _b) ((_i)->used[_b])
+
+/**
+ * Return the number of blocks in the indexed directory.
+ *
+ * @param[in] _i is the index.
+ */
+#define rtems_rfs_dir_index_blocks(_i) ((_i)->blocks)
+
+/**
+ * Set the number of blocks in the indexed directory when it shrinks.
+ *
+ * @param[in] _i is the index.
+ * @param[in] _b is the number of blocks.
+ */
+#define rtems_rfs_dir_index_set_blocks(_i, _b) ((_i)->blocks = (_b))
+
+#endif
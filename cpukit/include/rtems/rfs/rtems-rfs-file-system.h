@@ -22,6 +22,7 @@
 #define _RTEMS_RFS_FILE_SYSTEM_H_
 
 #include <rtems/rfs/rtems-rfs-group.h>
+#include <rtems/rfs/rtems-rfs-mutex.h>
 
 /**
  * Superblock offsets and values.
@@ -247,12 +248,47 @@ struct _rtems_rfs_file_system
    */
   uint32_t release_modified_count;
 
+  /**
+   * The lock of the buffer lists and counts. File data and the group bitmaps
+   * are accessed with their own locks held so the buffers can be requested
+   * and released by more than one task at a time.
+   */
+  rtems_rfs_mutex buffer_lock;
+
+  /**
+   * List of blocks requested from the I/O layer with the buffer lock
+   * released. Other requests of these blocks wait until the I/O request has
+   * finished.
+   */
+  rtems_chain_control buffer_io_requests;
+
   /**
    * List of open shared file node data. The shared node data such as the inode
    * and block map allows a single file to be open more than once.
    */
   rtems_chain_control file_shares;
 
+  /**
+   * List of directory indexes with the most recently used first.
+   */
+  rtems_chain_control dir_indexes;
+
+  /**
+   * Number of directory indexes on the directory indexes list.
+   */
+  uint32_t dir_index_count;
+
+  /**
+   * Maximum number of directory indexes. If 0 directories are not indexed.
+   */
+  uint32_t max_dir_indexes;
+
+  /**
+   * Directory index clock. It counts the index look ups and is used to decide
+   * if the least recently used index can be released.
+   */
+  uint32_t dir_index_clock;
+
   /**
    * Pointer to user data supplied when opening.
    */
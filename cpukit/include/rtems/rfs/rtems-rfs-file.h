@@ -84,6 +84,12 @@ typedef struct _rtems_rfs_file_shared
    */
   rtems_rfs_file_system* fs;
 
+  /**
+   * The lock of the file's data, block map and inode. Reads and writes of
+   * different files only hold their file's lock.
+   */
+  rtems_rfs_mutex lock;
+
 } rtems_rfs_file_shared;
 
 /**
@@ -227,6 +233,16 @@ typedef struct _rtems_rfs_file_handle
  */
 #define rtems_rfs_file_map(_f) (&(_f)->shared->map)
 
+/**
+ * Lock the shared file data.
+ */
+#define rtems_rfs_file_shared_lock(_s) rtems_rfs_mutex_lock (&(_s)->lock)
+
+/**
+ * Unlock the shared file data.
+ */
+#define rtems_rfs_file_shared_unlock(_s) rtems_rfs_mutex_unlock (&(_s)->lock)
+
 /**
  * Return the file's block position pointer given a file handle.
  */
@@ -32,6 +32,7 @@
 #include <rtems/rfs/rtems-rfs-trace.h>
 #include <rtems/rfs/rtems-rfs-bitmaps.h>
 #include <rtems/rfs/rtems-rfs-buffer.h>
+#include <rtems/rfs/rtems-rfs-mutex.h>
 
 /**
  * Block allocations for a group on disk.
@@ -80,8 +81,23 @@ typedef struct _rtems_rfs_group
    */
   rtems_rfs_buffer_handle inode_bitmap_buffer;
 
+  /**
+   * The lock of the group's bitmaps.
+   */
+  rtems_rfs_mutex lock;
+
 } rtems_rfs_group;
 
+/**
+ * Lock the group's bitmaps.
+ */
+#define rtems_rfs_group_lock(_g) rtems_rfs_mutex_lock (&(_g)->lock)
+
+/**
+ * Unlock the group's bitmaps.
+ */
+#define rtems_rfs_group_unlock(_g) rtems_rfs_mutex_unlock (&(_g)->lock)
+
 /**
  * Return the disk's block for a block in a group.
  */
@@ -139,6 +155,29 @@ int rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
                                   bool                   inode,
                                   rtems_rfs_bitmap_bit*  result);
 
+/**
+ * @brief Allocate a run of blocks.
+ *
+ * The whole run is allocated from the first free run found searching up from
+ * the goal through the groups. If no group has a free run of the length
+ * wanted the first block is allocated as rtems_rfs_group_bitmap_alloc() does
+ * and the run is extended with the free blocks that follow it in the same
+ * group.
+ *
+ * @param fs The file system data.
+ * @param goal The goal to seed the bitmap search.
+ * @param count The number of blocks wanted.
+ * @param result The first block of the run.
+ * @param allocated The number of blocks in the run. At least one block is
+ *                  allocated if there is no error.
+ * @retval int The error number (errno). No error if 0.
+ */
+int rtems_rfs_group_bitmap_alloc_run (rtems_rfs_file_system* fs,
+                                      rtems_rfs_bitmap_bit   goal,
+                                      size_t                 count,
+                                      rtems_rfs_bitmap_bit*  result,
+                                      size_t*                allocated);
+
 /**
  * @brief Free the group allocated bit.
  *
@@ -72,6 +72,23 @@ extern "C" {
  * @brief This group contains the Classic API directive attributes.
  */
 
+/**
+ * @ingroup RTEMSAPIClassicAttr
+ *
+ * @brief This attribute constant indicates that the Classic API semaphore
+ *   created by rtems_semaphore_create() shall busy wait for a bounded time
+ *   while the owner executes on another processor before the calling task
+ *   blocks.
+ *
+ * @par Notes
+ * The semaphore shall be a binary semaphore (#RTEMS_BINARY_SEMAPHORE) which
+ * does not use the Multiprocessor Resource Sharing Protocol.  The busy wait
+ * time adapts to the observed lengths of the critical sections protected by
+ * the semaphore.  In uniprocessor configurations, this attribute has no
+ * effect.
+ */
+#define RTEMS_ADAPTIVE_SPINNING 0x00000400
+
 /* Generated from spec:/rtems/attr/if/application-task */
 
 /**
@@ -225,6 +242,17 @@ typedef uint32_t rtems_attribute;
  */
 #define RTEMS_MULTIPROCESSOR_RESOURCE_SHARING 0x00000100
 
+/* Generated from spec:/rtems/attr/if/no-adaptive-spinning */
+
+/**
+ * @ingroup RTEMSAPIClassicAttr
+ *
+ * @brief This attribute constant indicates that the Classic API semaphore
+ *   created by rtems_semaphore_create() will block the calling task
+ *   immediately if the semaphore is not available.
+ */
+#define RTEMS_NO_ADAPTIVE_SPINNING 0x00000000
+
 /* Generated from spec:/rtems/attr/if/no-floating-point */
 
 /**
@@ -248,6 +248,20 @@ RTEMS_INLINE_ROUTINE bool _Attributes_Is_multiprocessor_resource_sharing(
   return ( attribute_set & RTEMS_MULTIPROCESSOR_RESOURCE_SHARING ) != 0;
 }
 
+/**
+ *  @brief Checks if the adaptive spinning attribute
+ *  is enabled in the attribute_set
+ *
+ *  This function returns TRUE if the adaptive spinning attribute
+ *  is enabled in the attribute_set and FALSE otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Attributes_Is_adaptive_spinning(
+  rtems_attribute attribute_set
+)
+{
+  return ( attribute_set & RTEMS_ADAPTIVE_SPINNING ) != 0;
+}
+
 /**
  *  @brief Checks if the barrier automatic release
  *  attribute is enabled in the attribute_set
@@ -139,6 +139,18 @@ RTEMS_INLINE_ROUTINE uintptr_t _Semaphore_Make_global( uintptr_t flags )
 }
 #endif
 
+#if defined(RTEMS_SMP)
+RTEMS_INLINE_ROUTINE bool _Semaphore_Is_adaptive( uintptr_t flags )
+{
+  return ( flags & 0x20 ) != 0;
+}
+
+RTEMS_INLINE_ROUTINE uintptr_t _Semaphore_Make_adaptive( uintptr_t flags )
+{
+  return flags | 0x20;
+}
+#endif
+
 RTEMS_INLINE_ROUTINE const Thread_queue_Operations *_Semaphore_Get_operations(
   uintptr_t flags
 )
@@ -93,6 +93,16 @@ typedef struct {
    * @brief The nest level in case of a recursive seize.
    */
   unsigned int nest_level;
+
+#if defined(RTEMS_SMP)
+  /**
+   * @brief The spin estimate in CPU counter ticks in case of an adaptive
+   *   mutex.
+   *
+   * @see _Thread_queue_Spin_while_owner_executes().
+   */
+  uint32_t spin_estimate;
+#endif
 } CORE_recursive_mutex_Control;
 
 /**
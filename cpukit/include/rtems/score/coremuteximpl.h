@@ -204,6 +204,9 @@ RTEMS_INLINE_ROUTINE void _CORE_recursive_mutex_Initialize(
 {
   _CORE_mutex_Initialize( &the_mutex->Mutex );
   the_mutex->nest_level = 0;
+#if defined(RTEMS_SMP)
+  the_mutex->spin_estimate = 0;
+#endif
 }
 
 /**
@@ -221,6 +224,37 @@ RTEMS_INLINE_ROUTINE Status_Control _CORE_recursive_mutex_Seize_nested(
   return STATUS_SUCCESSFUL;
 }
 
+#if defined(RTEMS_SMP)
+/**
+ * @brief Busy waits while the owner of the recursive mutex executes on
+ *   another processor.
+ *
+ * This is the spin phase of adaptive mutexes, see
+ * _Thread_queue_Spin_while_owner_executes().  The caller must have disabled
+ * interrupts through the lock context of the thread queue context and must
+ * not own the thread queue lock.  Interrupts are enabled during the busy
+ * wait.
+ *
+ * @param[in, out] the_mutex The recursive mutex to spin on.
+ * @param executing The executing thread.
+ * @param[in, out] queue_context The thread queue context.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_recursive_mutex_Spin(
+  CORE_recursive_mutex_Control *the_mutex,
+  const Thread_Control         *executing,
+  Thread_queue_Context         *queue_context
+)
+{
+  _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+  the_mutex->spin_estimate = _Thread_queue_Spin_while_owner_executes(
+    &the_mutex->Mutex.Wait_queue.Queue,
+    executing,
+    the_mutex->spin_estimate
+  );
+  _ISR_lock_ISR_disable( &queue_context->Lock_context.Lock_context );
+}
+#endif
+
 /**
  * @brief Seizes the recursive mutex.
  *
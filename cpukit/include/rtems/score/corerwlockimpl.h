@@ -230,6 +230,85 @@ Status_Control _CORE_RWLock_Seize_for_writing(
  */
 Status_Control _CORE_RWLock_Surrender( CORE_RWLock_Control *the_rwlock );
 
+/**
+ * @brief Tries to obtain the RWLock for reading through a visible reader
+ *   slot.
+ *
+ * This is the fast path of read-mostly RWLocks.  The reader publishes itself
+ * in a slot of a global table selected by the RWLock and the executing
+ * thread.  The RWLock control itself is not written, so readers on different
+ * processors do not contend for a cache line.  This is only possible if no
+ * writer revoked the fast path for readers of this RWLock.
+ *
+ * @param[in, out] the_rwlock is the RWLock to obtain.
+ * @param[in, out] executing is the executing thread.
+ *
+ * @retval true The RWLock was obtained for reading.
+ * @retval false The fast path is unavailable.  The RWLock shall be obtained
+ *   with _CORE_RWLock_Seize_for_reading().
+ */
+bool _CORE_RWLock_Seize_for_reading_biased(
+  CORE_RWLock_Control *the_rwlock,
+  Thread_Control      *executing
+);
+
+/**
+ * @brief Releases the RWLock obtained for reading through a visible reader
+ *   slot.
+ *
+ * @param[in, out] the_rwlock is the RWLock to release.
+ * @param[in, out] executing is the executing thread.
+ *
+ * @retval true The RWLock was obtained through the fast path by the executing
+ *   thread and is now released.
+ * @retval false Otherwise.  The RWLock shall be released with
+ *   _CORE_RWLock_Surrender().
+ */
+bool _CORE_RWLock_Surrender_biased(
+  CORE_RWLock_Control *the_rwlock,
+  Thread_Control      *executing
+);
+
+/**
+ * @brief Revokes the reader fast path of the RWLock.
+ *
+ * This function shall be called by the writer after the RWLock was obtained
+ * for writing with _CORE_RWLock_Seize_for_writing().  It waits until all
+ * readers which obtained the RWLock through the fast path released it.
+ *
+ * @param[in, out] the_rwlock is the RWLock obtained for writing.
+ * @param wait indicates whether the calling thread is willing to wait for the
+ *   fast path readers.
+ * @param[in, out] queue_context is the thread queue context used to wait for
+ *   the fast path readers.  The enqueue callout of the context defines the
+ *   timeout of the wait.  It is only used if @a wait is true.
+ *
+ * @retval STATUS_SUCCESSFUL The fast path is revoked and no fast path readers
+ *   are present.  The fast path shall be restored by
+ *   _CORE_RWLock_Restore_bias() after the RWLock was released.
+ * @retval STATUS_UNAVAILABLE There are fast path readers and the calling
+ *   thread is not willing to wait.  The revocation was undone.  The RWLock
+ *   shall be released with _CORE_RWLock_Surrender().
+ * @retval STATUS_TIMEOUT The wait for the fast path readers timed out.  The
+ *   revocation was undone.  The RWLock shall be released with
+ *   _CORE_RWLock_Surrender().
+ */
+Status_Control _CORE_RWLock_Revoke_bias(
+  CORE_RWLock_Control  *the_rwlock,
+  bool                  wait,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Restores the reader fast path of the RWLock.
+ *
+ * This function shall be called by the writer after the RWLock was released
+ * with _CORE_RWLock_Surrender().
+ *
+ * @param[in, out] the_rwlock is the released RWLock.
+ */
+void _CORE_RWLock_Restore_bias( CORE_RWLock_Control *the_rwlock );
+
 /** @} */
 
 #ifdef __cplusplus
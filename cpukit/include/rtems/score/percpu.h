@@ -76,7 +76,7 @@ extern "C" {
     #define PER_CPU_CONTROL_SIZE_BIG_POINTER 0
   #endif
 
-  #define PER_CPU_CONTROL_SIZE_BASE 180
+  #define PER_CPU_CONTROL_SIZE_BASE 204
   #define PER_CPU_CONTROL_SIZE_APPROX \
     ( PER_CPU_CONTROL_SIZE_BASE + CPU_PER_CPU_CONTROL_SIZE + \
     CPU_INTERRUPT_FRAME_SIZE + PER_CPU_CONTROL_SIZE_PROFILING + \
@@ -505,6 +505,33 @@ typedef struct Per_CPU_Control {
     Watchdog_Header Header[ PER_CPU_WATCHDOG_COUNT ];
   } Watchdog;
 
+  /**
+   * @brief Statistics of the idle thread of this processor.
+   *
+   * These members are only updated by Clock Drivers which support the
+   * tickless idle mode.  They are only written by this processor with
+   * interrupts disabled.
+   */
+  struct {
+    /**
+     * @brief Indicates that the idle thread of this processor uses the
+     * tickless idle mode.
+     */
+    bool tickless;
+
+    /**
+     * @brief Count of clock ticks which elapsed without a clock interrupt
+     * while the processor waited for interrupts.
+     */
+    uint64_t wakeups_avoided;
+
+    /**
+     * @brief Time spent by the processor waiting for interrupts in the
+     * tickless idle mode.
+     */
+    Timestamp_Control residency;
+  } Idle;
+
   #if defined( RTEMS_SMP )
     /**
      * @brief This lock protects some members of this structure.
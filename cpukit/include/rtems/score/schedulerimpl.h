@@ -977,6 +977,7 @@ RTEMS_INLINE_ROUTINE void _Scheduler_Update_heir(
     new_heir->Scheduler.state = THREAD_SCHEDULER_SCHEDULED;
 #endif
     _Thread_Update_CPU_time_used( heir, _Thread_Get_CPU( heir ) );
+    _Scheduler_Latency_heir( new_heir );
     _Thread_Heir = new_heir;
     _Thread_Dispatch_necessary = true;
   }
@@ -0,0 +1,159 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerLatency
+ *
+ * @brief This header file provides interfaces of the
+ *   @ref RTEMSScoreSchedulerLatency.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULERLATENCY_H
+#define _RTEMS_SCORE_SCHEDULERLATENCY_H
+
+#include <rtems/score/basedefs.h>
+#include <rtems/score/cpu.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSScoreSchedulerLatency Scheduler Latency Statistics
+ *
+ * @ingroup RTEMSScoreScheduler
+ *
+ * @brief This group contains the implementation of the wakeup latency
+ *   statistics of threads.
+ *
+ * The statistics are only available if RTEMS is built with profiling enabled.
+ * The wakeup latency is the time from the unblock of a thread until the
+ * context switch to the thread.  It is split into the schedule latency from
+ * the unblock until the thread is selected as the heir of a processor and the
+ * dispatch latency from the heir selection until the context switch.
+ *
+ * @{
+ */
+
+/**
+ * @brief This constant defines the count of buckets of a latency histogram.
+ *
+ * The first bucket counts latencies less than 1024ns.  The bucket with index
+ * N for 0 < N < SCHEDULER_LATENCY_BUCKETS - 1 counts latencies in the
+ * interval [2^(N + 9)ns, 2^(N + 10)ns).  The last bucket counts all greater
+ * latencies.
+ */
+#define SCHEDULER_LATENCY_BUCKETS 16
+
+/**
+ * @brief This constant defines the count of priority latency histograms.
+ *
+ * Threads with a priority greater than or equal to this value share the last
+ * priority latency histogram.
+ */
+#define SCHEDULER_LATENCY_PRIORITIES 256
+
+/**
+ * @brief This structure represents a latency histogram.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the count of latencies per bucket.
+   */
+  uint32_t buckets[ SCHEDULER_LATENCY_BUCKETS ];
+
+  /**
+   * @brief This member contains the maximum latency in nanoseconds.
+   */
+  uint32_t max;
+} Scheduler_Latency_histogram;
+
+#if defined(RTEMS_PROFILING)
+/**
+ * @brief This structure contains the wakeup latency state of a thread.
+ */
+typedef struct {
+  /**
+   * @brief This member is true, if the thread was unblocked and no context
+   *   switch to the thread happened since then.
+   */
+  bool is_pending;
+
+  /**
+   * @brief This member is true, if the latencies of the last wakeup were not
+   *   yet consumed by the event recording.
+   */
+  bool is_new_latency;
+
+  /**
+   * @brief This member contains the CPU counter value of the unblock.
+   */
+  CPU_Counter_ticks unblock_instant;
+
+  /**
+   * @brief This member contains the CPU counter value of the last heir
+   *   selection.
+   */
+  CPU_Counter_ticks heir_instant;
+
+  /**
+   * @brief This member contains the schedule latency in nanoseconds of the
+   *   last wakeup.
+   */
+  uint32_t schedule_latency;
+
+  /**
+   * @brief This member contains the dispatch latency in nanoseconds of the
+   *   last wakeup.
+   */
+  uint32_t dispatch_latency;
+
+  /**
+   * @brief This member contains the wakeup latency histogram of the thread.
+   */
+  Scheduler_Latency_histogram Histogram;
+} Scheduler_Latency_thread;
+
+/**
+ * @brief The wakeup latency histograms indexed by the thread priority.
+ *
+ * The thread priority is the priority used by the application configuration
+ * and the API.
+ */
+extern Scheduler_Latency_histogram
+  _Scheduler_Latency_priorities[ SCHEDULER_LATENCY_PRIORITIES ];
+#endif
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_SCHEDULERLATENCY_H */
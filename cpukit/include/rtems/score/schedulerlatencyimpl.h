@@ -0,0 +1,134 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerLatency
+ *
+ * @brief This header file provides interfaces of the
+ *   @ref RTEMSScoreSchedulerLatency which are only used by the
+ *   implementation.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULERLATENCYIMPL_H
+#define _RTEMS_SCORE_SCHEDULERLATENCYIMPL_H
+
+#include <rtems/score/schedulerlatency.h>
+#include <rtems/score/thread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @addtogroup RTEMSScoreSchedulerLatency
+ *
+ * @{
+ */
+
+/**
+ * @brief Records the unblock of the thread.
+ *
+ * @param[in, out] the_thread is the thread.
+ */
+static inline void _Scheduler_Latency_unblock( Thread_Control *the_thread )
+{
+#if defined(RTEMS_PROFILING)
+  CPU_Counter_ticks now;
+
+  now = _CPU_Counter_read();
+  the_thread->Latency.unblock_instant = now;
+  the_thread->Latency.heir_instant = now;
+  the_thread->Latency.is_pending = true;
+#else
+  (void) the_thread;
+#endif
+}
+
+/**
+ * @brief Records the selection of the thread as the heir of a processor.
+ *
+ * @param[in, out] the_thread is the thread.
+ */
+static inline void _Scheduler_Latency_heir( Thread_Control *the_thread )
+{
+#if defined(RTEMS_PROFILING)
+  if ( the_thread->Latency.is_pending ) {
+    the_thread->Latency.heir_instant = _CPU_Counter_read();
+  }
+#else
+  (void) the_thread;
+#endif
+}
+
+#if defined(RTEMS_PROFILING)
+/**
+ * @brief Records the context switch to the thread.
+ *
+ * This function shall be called with interrupts disabled.  It updates the
+ * wakeup latency histograms.
+ *
+ * @param[in, out] the_thread is the heir thread.
+ */
+void _Scheduler_Latency_do_context_switch( Thread_Control *the_thread );
+#endif
+
+/**
+ * @brief Records the context switch to the thread if it was unblocked.
+ *
+ * This function shall be called with interrupts disabled.
+ *
+ * @param[in, out] the_thread is the heir thread.
+ */
+static inline void _Scheduler_Latency_context_switch(
+  Thread_Control *the_thread
+)
+{
+#if defined(RTEMS_PROFILING)
+  if ( the_thread->Latency.is_pending ) {
+    _Scheduler_Latency_do_context_switch( the_thread );
+  }
+#else
+  (void) the_thread;
+#endif
+}
+
+/**
+ * @brief Resets the wakeup latency statistics.
+ *
+ * Concurrent updates of the statistics on other processors may get lost.
+ */
+void _Scheduler_Latency_reset( void );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_SCHEDULERLATENCYIMPL_H */
@@ -50,6 +50,7 @@
 #include <rtems/score/isrlock.h>
 #include <rtems/score/objectdata.h>
 #include <rtems/score/priority.h>
+#include <rtems/score/schedulerlatency.h>
 #include <rtems/score/schedulernode.h>
 #include <rtems/score/stack.h>
 #include <rtems/score/states.h>
@@ -870,6 +871,13 @@ struct _Thread_Control {
   SMP_lock_Stats Potpourri_stats;
 #endif
 
+#if defined(RTEMS_PROFILING)
+  /**
+   * @brief The wakeup latency state of the thread.
+   */
+  Scheduler_Latency_thread Latency;
+#endif
+
   /** This field is true if the thread is an idle thread. */
   bool                                  is_idle;
 #if defined(RTEMS_MULTIPROCESSING)
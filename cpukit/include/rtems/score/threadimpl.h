@@ -46,6 +46,7 @@
 #include <rtems/score/interr.h>
 #include <rtems/score/isr.h>
 #include <rtems/score/objectimpl.h>
+#include <rtems/score/schedulerlatencyimpl.h>
 #include <rtems/score/schedulernodeimpl.h>
 #include <rtems/score/statesimpl.h>
 #include <rtems/score/status.h>
@@ -1255,6 +1256,7 @@ RTEMS_INLINE_ROUTINE void _Thread_Dispatch_update_heir(
 )
 {
   _Thread_Update_CPU_time_used( cpu_for_heir->heir, cpu_for_heir );
+  _Scheduler_Latency_heir( heir );
 
   cpu_for_heir->heir = heir;
 
@@ -1929,7 +1931,7 @@ RTEMS_INLINE_ROUTINE void _Thread_Wait_acquire_critical(
   queue = the_thread->Wait.queue;
   queue_context->Lock_context.Wait.queue = queue;
 
-  if ( queue != NULL ) {
+  while ( queue != NULL ) {
     _Thread_queue_Gate_add(
       &the_thread->Wait.Lock.Pending_requests,
       &queue_context->Lock_context.Wait.Gate
@@ -1940,21 +1942,30 @@ RTEMS_INLINE_ROUTINE void _Thread_Wait_acquire_critical(
     );
     _Thread_Wait_acquire_queue_critical( queue, &queue_context->Lock_context );
 
-    if ( queue_context->Lock_context.Wait.queue == NULL ) {
-      _Thread_Wait_release_queue_critical(
-        queue,
-        &queue_context->Lock_context
-      );
-      _Thread_Wait_acquire_default_critical(
-        the_thread,
-        &queue_context->Lock_context.Lock_context
-      );
-      _Thread_Wait_remove_request_locked(
-        the_thread,
-        &queue_context->Lock_context
-      );
-      _Assert( the_thread->Wait.queue == NULL );
+    if ( queue_context->Lock_context.Wait.queue != NULL ) {
+      break;
     }
+
+    _Thread_Wait_release_queue_critical(
+      queue,
+      &queue_context->Lock_context
+    );
+    _Thread_Wait_acquire_default_critical(
+      the_thread,
+      &queue_context->Lock_context.Lock_context
+    );
+    _Thread_Wait_remove_request_locked(
+      the_thread,
+      &queue_context->Lock_context
+    );
+
+    /*
+     * The thread was either removed from the thread queue or moved to another
+     * thread queue by _Thread_Wait_requeue().  In the later case, retry with
+     * the new thread queue.
+     */
+    queue = the_thread->Wait.queue;
+    queue_context->Lock_context.Wait.queue = queue;
   }
 #else
   (void) the_thread;
@@ -2171,6 +2182,56 @@ RTEMS_INLINE_ROUTINE void _Thread_Wait_restore_default(
 #endif
 }
 
+/**
+ * @brief Moves the thread wait to another thread queue.
+ *
+ * The caller must be the owner of the current and the new thread wait queue
+ * lock.  The thread must be already extracted from the current thread queue
+ * and is enqueued by the caller on the new thread queue afterwards.
+ *
+ * On SMP configurations, the pending requests are invalidated, so that they
+ * retry with the new thread queue.
+ *
+ * @param[in, out] the_thread The thread.
+ * @param queue The new thread queue.
+ * @param operations The thread queue operations of the new thread queue.
+ *
+ * @see _Thread_queue_Requeue_critical().
+ */
+RTEMS_INLINE_ROUTINE void _Thread_Wait_requeue(
+  Thread_Control                *the_thread,
+  Thread_queue_Queue            *queue,
+  const Thread_queue_Operations *operations
+)
+{
+#if defined(RTEMS_SMP)
+  ISR_lock_Context  lock_context;
+  Chain_Node       *node;
+  const Chain_Node *tail;
+
+  _Thread_Wait_acquire_default_critical( the_thread, &lock_context );
+
+  node = _Chain_First( &the_thread->Wait.Lock.Pending_requests );
+  tail = _Chain_Immutable_tail( &the_thread->Wait.Lock.Pending_requests );
+
+  while ( node != tail ) {
+    Thread_queue_Context *queue_context;
+
+    queue_context = THREAD_QUEUE_CONTEXT_OF_REQUEST( node );
+    queue_context->Lock_context.Wait.queue = NULL;
+
+    node = _Chain_Next( node );
+  }
+#endif
+
+  the_thread->Wait.queue = queue;
+  the_thread->Wait.operations = operations;
+
+#if defined(RTEMS_SMP)
+  _Thread_Wait_release_default_critical( the_thread, &lock_context );
+#endif
+}
+
 /**
  * @brief Tranquilizes the thread after a wait on a thread queue.
  *
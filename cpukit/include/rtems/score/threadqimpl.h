@@ -971,6 +971,33 @@ bool _Thread_queue_Extract_locked(
   Thread_queue_Context          *queue_context
 );
 
+/**
+ * @brief Moves the thread from one thread queue to another thread queue.
+ *
+ * The thread remains blocked.  It is extracted from the source thread queue
+ * and enqueued on the target thread queue.  The caller must be the owner of
+ * both thread queue locks.  The thread queue locks are not released.
+ *
+ * The operations shall not depend on a thread queue owner, e.g. only
+ * ::_Thread_queue_Operations_FIFO and ::_Thread_queue_Operations_priority are
+ * allowed.  No priority inheritance or deadlock detection is performed.
+ *
+ * @param source The source thread queue.
+ * @param source_operations The source thread queue operations.
+ * @param target The target thread queue.
+ * @param target_operations The target thread queue operations.
+ * @param[in, out] the_thread The thread to move.
+ * @param[in, out] queue_context The thread queue context.
+ */
+void _Thread_queue_Requeue_critical(
+  Thread_queue_Queue            *source,
+  const Thread_queue_Operations *source_operations,
+  Thread_queue_Queue            *target,
+  const Thread_queue_Operations *target_operations,
+  Thread_Control                *the_thread,
+  Thread_queue_Context          *queue_context
+);
+
 /**
  * @brief Resumes the extracted or surrendered thread.
  *
@@ -1097,6 +1124,56 @@ void _Thread_queue_Surrender_sticky(
   Thread_queue_Context          *queue_context,
   const Thread_queue_Operations *operations
 );
+
+/**
+ * @brief The upper bound of the busy wait duration of
+ *   _Thread_queue_Spin_while_owner_executes() in nanoseconds.
+ *
+ * It is converted to CPU counter ticks, see #THREAD_QUEUE_SPIN_MAXIMUM.
+ */
+#define THREAD_QUEUE_SPIN_MAXIMUM_NANOSECONDS 20000
+
+/**
+ * @brief The upper bound of the busy wait duration of
+ *   _Thread_queue_Spin_while_owner_executes() in CPU counter ticks.
+ */
+#define THREAD_QUEUE_SPIN_MAXIMUM \
+  ( (uint32_t) ( ( (uint64_t) _CPU_Counter_frequency() \
+    * THREAD_QUEUE_SPIN_MAXIMUM_NANOSECONDS ) / 1000000000 ) )
+
+/**
+ * @brief Busy waits while the owner of the thread queue executes on another
+ * processor.
+ *
+ * This is the spin phase of adaptive mutexes.  It should be called without
+ * the thread queue lock and with interrupts enabled right before the thread
+ * queue is acquired to seize the mutex.  The busy wait stops if the thread
+ * queue has no owner, if the owner changed, if the owner no longer executes
+ * on a processor, or if the spin limit is reached.
+ *
+ * The spin estimate and the spin limit are durations in CPU counter ticks.
+ * The spin limit is twice the spin estimate plus one sixteenth of
+ * #THREAD_QUEUE_SPIN_MAXIMUM, at most #THREAD_QUEUE_SPIN_MAXIMUM.  The spin
+ * estimate is afterwards moved towards the actual busy wait duration by one
+ * eighth of the difference.  So, the spin limit adapts to the length of the
+ * critical sections protected by the mutex.  The processor is relaxed in
+ * each busy wait iteration, see _CPU_SMP_Processor_relax().
+ *
+ * The owner is read without synchronization.  A stale value only affects the
+ * spin decision, since thread control blocks are not given back to the
+ * system while a thread owns a resource.
+ *
+ * @param queue The thread queue of the mutex.
+ * @param executing The executing thread.
+ * @param spin_estimate The current spin estimate of the mutex.
+ *
+ * @return Returns the updated spin estimate of the mutex.
+ */
+uint32_t _Thread_queue_Spin_while_owner_executes(
+  const Thread_queue_Queue *queue,
+  const Thread_Control     *executing,
+  uint32_t                  spin_estimate
+);
 #endif
 
 /**
@@ -156,6 +156,41 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Header_destroy(
  */
 void _Watchdog_Tick( struct Per_CPU_Control *cpu );
 
+/**
+ * @brief Gets the count of watchdog ticks until the next watchdog of the
+ *   processor expires.
+ *
+ * This function is used by Clock Drivers which support the tickless idle
+ * mode.  Interrupts shall be disabled on the processor.
+ *
+ * @param cpu is the processor.
+ *
+ * @param ticks_maximum is the maximum count of ticks to return.
+ *
+ * @return Returns the count of clock ticks which may elapse before a watchdog
+ *   of the processor expires.  A return value of zero indicates that a
+ *   watchdog is already due.  The count may be less than the exact value, but
+ *   it is never greater.
+ */
+uint64_t _Watchdog_Ticks_until_next_expiration(
+  struct Per_CPU_Control *cpu,
+  uint64_t                ticks_maximum
+);
+
+/**
+ * @brief Accounts for clock ticks which elapsed on the processor without a
+ *   clock interrupt.
+ *
+ * This function is used by Clock Drivers which support the tickless idle
+ * mode.  Interrupts shall be disabled on the processor.  The next clock tick
+ * shall be announced through _Watchdog_Tick() as usual.
+ *
+ * @param cpu is the processor.
+ *
+ * @param ticks is the count of skipped clock ticks.
+ */
+void _Watchdog_Skip_ticks( struct Per_CPU_Control *cpu, uint64_t ticks );
+
 /**
  * @brief Gets the state of the watchdog.
  *
@@ -87,6 +87,7 @@ extern rtems_shell_cmd_t rtems_shell_SHUTDOWN_Command;
 extern rtems_shell_cmd_t rtems_shell_CPUINFO_Command;
 extern rtems_shell_cmd_t rtems_shell_CPUUSE_Command;
 extern rtems_shell_cmd_t rtems_shell_TOP_Command;
+extern rtems_shell_cmd_t rtems_shell_LATENCY_Command;
 extern rtems_shell_cmd_t rtems_shell_STACKUSE_Command;
 extern rtems_shell_cmd_t rtems_shell_PERIODUSE_Command;
 extern rtems_shell_cmd_t rtems_shell_PROFREPORT_Command;
@@ -449,6 +450,11 @@ extern rtems_shell_alias_t * const rtems_shell_Initial_aliases[];
          !defined(CONFIGURE_SHELL_NO_COMMAND_TOP)) || \
         defined(CONFIGURE_SHELL_COMMAND_TOP)
       &rtems_shell_TOP_Command,
+    #endif
+    #if (defined(CONFIGURE_SHELL_COMMANDS_ALL) && \
+         !defined(CONFIGURE_SHELL_NO_COMMAND_LATENCY)) || \
+        defined(CONFIGURE_SHELL_COMMAND_LATENCY)
+      &rtems_shell_LATENCY_Command,
     #endif
      #if (defined(CONFIGURE_SHELL_COMMANDS_ALL) && \
          !defined(CONFIGURE_SHELL_NO_COMMAND_STACKUSE)) || \
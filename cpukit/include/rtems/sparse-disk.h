@@ -26,7 +26,9 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <rtems.h>
+#include <rtems/chain.h>
 #include <rtems/diskdevs.h>
+#include <rtems/rbtree.h>
 #include <rtems/thread.h>
 
 #ifdef __cplusplus
@@ -41,9 +43,20 @@ extern "C" {
  */
 /**@{**/
 
+/**
+ * @brief A block with buffer.
+ *
+ * Each key owns one buffer of media block size for the whole lifetime of the
+ * sparse disk.  Keys in use are in the block tree of the sparse disk, all
+ * other keys are in the free key pool.
+ */
 typedef struct {
   rtems_blkdev_bnum  block;
   void              *data;
+  union {
+    rtems_rbtree_node tree_node;
+    rtems_chain_node  free_node;
+  } node;
 } rtems_sparse_disk_key;
 
 typedef struct rtems_sparse_disk rtems_sparse_disk;
@@ -58,6 +71,19 @@ struct rtems_sparse_disk {
   rtems_sparse_disk_delete_handler delete_handler;
   uint8_t                          fill_pattern;
   rtems_sparse_disk_key           *key_table;
+
+  /**
+   * @brief The keys in use ordered by block number.
+   */
+  rtems_rbtree_control             block_tree;
+
+  /**
+   * @brief The keys available for blocks which are not in the block tree.
+   *
+   * A write of a block which consists only of fill pattern bytes returns its
+   * key to this pool.
+   */
+  rtems_chain_control              free_keys;
 };
 
 /**
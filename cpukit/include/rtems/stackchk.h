@@ -24,6 +24,7 @@
 #include <stdbool.h> /* bool */
 
 #include <rtems/score/thread.h> /* Thread_Control */
+#include <rtems/rtems/types.h> /* rtems_id */
 #include <rtems/print.h>
 
 /**
@@ -73,6 +74,74 @@ void rtems_stack_checker_report_usage_with_plugin(
   const rtems_printer *printer
 );
 
+/**
+ * @brief Stack information of a thread or an interrupt stack.
+ */
+typedef struct {
+  /**
+   * @brief The object identifier of the thread or the processor index of the
+   * interrupt stack.
+   */
+  rtems_id id;
+
+  /**
+   * @brief The name of the thread or "Interrupt Stack".
+   */
+  const char *name;
+
+  /**
+   * @brief The stack pointer of the thread or NULL for interrupt stacks.
+   */
+  const void *current;
+
+  /**
+   * @brief The begin of the stack area.
+   */
+  const void *begin;
+
+  /**
+   * @brief The size of the stack area in bytes.
+   */
+  size_t size;
+
+  /**
+   * @brief The size of the stack area without the sanity pattern in bytes.
+   */
+  size_t available;
+
+  /**
+   * @brief The stack usage in bytes.
+   */
+  size_t used;
+} rtems_stack_checker_info;
+
+/**
+ * @brief Visitor routine for rtems_stack_checker_iterate().
+ *
+ * @param[in] info is the stack information.
+ * @param[in] arg is the argument passed to rtems_stack_checker_iterate().
+ *
+ * @retval true Stop the iteration.
+ * @retval false Continue the iteration.
+ */
+typedef bool ( *rtems_stack_checker_visitor )(
+  const rtems_stack_checker_info *info,
+  void                           *arg
+);
+
+/**
+ * @brief Iterates over the thread and interrupt stacks.
+ *
+ * The stack usage report uses this function.
+ *
+ * @param[in] visit is the visitor routine invoked for each stack.
+ * @param[in] arg is the argument passed to the visitor routine.
+ */
+void rtems_stack_checker_iterate(
+  rtems_stack_checker_visitor  visit,
+  void                        *arg
+);
+
 /*************************************************************
  *************************************************************
  **  Prototyped only so the user extension can be installed **
@@ -95,6 +164,20 @@ bool rtems_stack_checker_create_extension(
   Thread_Control *the_thread
 );
 
+/**
+ * @brief Stack Checker Task Create Extension for the Sampling Mode
+ * This method is the task create extension for the stack checker in the
+ * sampling mode.  The stack is not filled with a pattern, only the sanity
+ * pattern and some guard words are written.  So, the time to create a
+ * task does not depend on the stack size.
+ * @param[in] running points to the currently executing task
+ * @param[in] the_thread points to the newly created task
+ */
+bool rtems_stack_checker_sampling_create_extension(
+  Thread_Control *running,
+  Thread_Control *the_thread
+);
+
 void rtems_stack_checker_begin_extension( Thread_Control *executing );
 
 /**
@@ -113,6 +196,30 @@ void rtems_stack_checker_switch_extension(
   Thread_Control *heir
 );
 
+/**
+ * @brief Stack Checker Task Context Switch Extension for the Sampling Mode
+ * This method records the stack pointer as a high water mark sample in the
+ * thread extension slot of the sampling extension.  The checks are done by
+ * rtems_stack_checker_switch_extension().
+ * @param[in] running points to the currently executing task which
+ *            is being context switched out
+ * @param[in] heir points to the heir task which we are switching to
+ */
+void rtems_stack_checker_sampling_switch_extension(
+  Thread_Control *running,
+  Thread_Control *heir
+);
+
+/**
+ * @brief Stack Checker Sampling Initialization
+ * This method creates the user extension named "STCK" with
+ * rtems_stack_checker_sampling_switch_extension().  The thread extension
+ * slot of this extension holds the sampled stack usage of a thread.  This
+ * method is normally only used by confdefs.h which configures one user
+ * extension in addition to the CONFIGURE_MAXIMUM_USER_EXTENSIONS for it.
+ */
+void rtems_stack_checker_sampling_initialize( void );
+
 /**
  *  @brief Stack Checker Extension Set Definition
  *
@@ -132,6 +239,25 @@ void rtems_stack_checker_switch_extension(
   0                                            /* terminate    */ \
 }
 
+/**
+ *  @brief Stack Checker Sampling Extension Set Definition
+ *  This macro defines the user extension handler set for the stack
+ *  checker in the sampling mode.  This macro is normally only used by
+ *  confdefs.h.
+ */
+#define RTEMS_STACK_CHECKER_SAMPLING_EXTENSION \
+{ \
+  rtems_stack_checker_sampling_create_extension, /* rtems_task_create  */ \
+  0,                                             /* rtems_task_start   */ \
+  0,                                             /* rtems_task_restart */ \
+  0,                                             /* rtems_task_delete  */ \
+  rtems_stack_checker_switch_extension,          /* task_switch  */ \
+  rtems_stack_checker_begin_extension,           /* task_begin   */ \
+  0,                                             /* task_exitted */ \
+  0,                                             /* fatal        */ \
+  0                                              /* terminate    */ \
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -30,6 +30,16 @@ int _Semaphore_Try_wait(struct _Semaphore_Control *);
 /* Temporarily defined, will be shipped with a Newlib update */
 void _Semaphore_Post_binary(struct _Semaphore_Control *);
 
+/* Temporarily defined, will be shipped with a Newlib update */
+int _Futex_Wait_bitset(struct _Futex_Control *, int *, int, __uint32_t);
+
+/* Temporarily defined, will be shipped with a Newlib update */
+int _Futex_Wake_bitset(struct _Futex_Control *, int, __uint32_t);
+
+/* Temporarily defined, will be shipped with a Newlib update */
+int _Futex_Requeue(struct _Futex_Control *, int *, int, int,
+    struct _Futex_Control *, int, int *);
+
 typedef struct _Mutex_Control rtems_mutex;
 
 #define RTEMS_MUTEX_INITIALIZER( name ) _MUTEX_NAMED_INITIALIZER( name )
@@ -296,6 +306,57 @@ static __inline void rtems_binary_semaphore_destroy(
   _Semaphore_Destroy( &binary_semaphore->Semaphore );
 }
 
+typedef struct {
+  struct _Thread_queue_Queue _Queue;
+  unsigned int _current_state;
+  unsigned int _number_of_readers;
+} rtems_rwlock;
+
+#define RTEMS_RWLOCK_INITIALIZER( name ) \
+  { _THREAD_QUEUE_NAMED_INITIALIZER( name ), 0, 0 }
+
+static __inline void rtems_rwlock_init(
+  rtems_rwlock *rwlock,
+  const char   *name
+)
+{
+  rtems_rwlock init = RTEMS_RWLOCK_INITIALIZER( name );
+
+  *rwlock = init;
+}
+
+static __inline const char *rtems_rwlock_get_name(
+  const rtems_rwlock *rwlock
+)
+{
+  return rwlock->_Queue._name;
+}
+
+static __inline void rtems_rwlock_set_name(
+  rtems_rwlock *rwlock,
+  const char   *name
+)
+{
+  rwlock->_Queue._name = name;
+}
+
+void rtems_rwlock_read_lock( rtems_rwlock *rwlock );
+
+int rtems_rwlock_try_read_lock( rtems_rwlock *rwlock );
+
+void rtems_rwlock_read_unlock( rtems_rwlock *rwlock );
+
+void rtems_rwlock_write_lock( rtems_rwlock *rwlock );
+
+int rtems_rwlock_try_write_lock( rtems_rwlock *rwlock );
+
+void rtems_rwlock_write_unlock( rtems_rwlock *rwlock );
+
+static __inline void rtems_rwlock_destroy( rtems_rwlock *rwlock )
+{
+  (void) rwlock;
+}
+
 __END_DECLS
 
 #endif /* _RTEMS_THREAD_H */
@@ -23,7 +23,9 @@
 #include <zlib.h>
 #include <xz.h>
 
+#include <rtems.h>
 #include <rtems/print.h>
+#include <rtems/thread.h>
 
 /**
  *  @defgroup libmisc_untar_img Untar Image
@@ -43,6 +45,11 @@ extern "C" {
 #define UNTAR_GZ_INFLATE_FAILED 4
 #define UNTAR_GZ_INFLATE_END_FAILED 5
 
+/*
+ * Untar_FromMemory() writes each file with a single write request.  To extract
+ * an archive in memory which stays valid to the IMFS without a copy of the file
+ * data, use rtems_tarfs_load().
+ */
 int Untar_FromMemory(void *tar_buf, size_t size);
 int Untar_FromMemory_Print(void *tar_buf, size_t size, const rtems_printer* printer);
 int Untar_FromFile(const char *tar_name);
@@ -95,6 +102,88 @@ typedef struct {
   int out_fd;
 } Untar_ChunkContext;
 
+/**
+ * @brief Number of buffers of the Untar_PipeContext.
+ */
+#define UNTAR_PIPE_BUFFER_COUNT 2
+
+typedef struct {
+  /**
+   * @brief Instance of Chunk Context used by the extraction task.
+   */
+  Untar_ChunkContext base;
+
+  /**
+   * @brief Printer used by the extraction task.
+   */
+  const rtems_printer *printer;
+
+  /**
+   * @brief Protects the buffer state shared with the extraction task.
+   */
+  rtems_mutex mutex;
+
+  /**
+   * @brief Signals a change of the buffer state.
+   */
+  rtems_condition_variable changed;
+
+  /**
+   * @brief Buffers passed between the producer and the extraction task.
+   */
+  char *buffers[UNTAR_PIPE_BUFFER_COUNT];
+
+  /**
+   * @brief Size of each buffer.
+   */
+  size_t buffer_size;
+
+  /**
+   * @brief Count of valid bytes of the buffers handed to the extraction task.
+   */
+  size_t sizes[UNTAR_PIPE_BUFFER_COUNT];
+
+  /**
+   * @brief Index of the buffer filled by the producer.
+   */
+  size_t produce;
+
+  /**
+   * @brief Count of bytes in the buffer filled by the producer.
+   */
+  size_t fill;
+
+  /**
+   * @brief Index of the next buffer extracted by the extraction task.
+   */
+  size_t consume;
+
+  /**
+   * @brief Count of buffers handed to the extraction task.
+   */
+  size_t full;
+
+  /**
+   * @brief The producer finished.
+   */
+  bool done;
+
+  /**
+   * @brief First error status of the extraction.
+   */
+  int status;
+
+  /**
+   * @brief Identifier of the extraction task.
+   */
+  rtems_id worker;
+
+  /**
+   * @brief Identifier of the task waiting for the end of the extraction.
+   */
+  rtems_id finisher;
+} Untar_PipeContext;
+
 typedef struct {
   /**
    * @brief Instance of Chunk Context needed for tar decompression.
@@ -116,6 +205,15 @@ typedef struct {
    */
   size_t inflateBufferSize;
 
+  /**
+   * @brief Optional pipe context.
+   *
+   * If set after the initialization, the data is inflated directly into the
+   * buffers of the pipe and extracted by its task.  The inflate buffer is not
+   * used in this case.
+   */
+  Untar_PipeContext *pipe;
+
 } Untar_GzChunkContext;
 
 typedef struct {
@@ -144,6 +242,15 @@ typedef struct {
    */
   size_t inflateBufferSize;
 
+  /**
+   * @brief Optional pipe context.
+   *
+   * If set after the initialization, the data is decompressed directly into
+   * the buffers of the pipe and extracted by its task.  The inflate buffer is
+   * not used in this case.
+   */
+  Untar_PipeContext *pipe;
+
 } Untar_XzChunkContext;
 
 /**
@@ -174,6 +281,84 @@ int Untar_FromChunk_Print(
   const rtems_printer* printer
 );
 
+/**
+ * @brief Initializes the Untar_PipeContext and starts its extraction task.
+ *
+ * The extraction task writes the files while the producer, for example a
+ * decompressor, fills the next buffer.  The buffer is split into
+ * UNTAR_PIPE_BUFFER_COUNT buffers.  Larger buffers lead to larger write
+ * requests.  Untar_PipeContext_Finish() must be called to end the extraction.
+ *
+ * @param Untar_PipeContext *ctx [in] Pointer to a context structure.
+ * @param void *buffer [in] Pointer to the buffers.
+ * @param size_t buffer_size [in] Size of the buffers.
+ * @param rtems_task_priority priority [in] Priority of the extraction task,
+ *   RTEMS_CURRENT_PRIORITY selects the priority of the calling task.
+ * @param const rtems_printer *printer [in] Printer of the extraction task.
+ *
+ * @retval UNTAR_SUCCESSFUL (0)    on successful completion.
+ * @retval UNTAR_FAIL              if the task could not be started.
+ */
+int Untar_PipeContext_Init(
+  Untar_PipeContext *ctx,
+  void *buffer,
+  size_t buffer_size,
+  rtems_task_priority priority,
+  const rtems_printer *printer
+);
+
+/**
+ * @brief Returns the free part of the buffer filled by the producer.
+ *
+ * Waits until the extraction task released a buffer if all buffers are in
+ * use.  The produced data must be committed with Untar_PipeContext_Commit().
+ *
+ * @param Untar_PipeContext *ctx [in] Pointer to a context structure.
+ * @param size_t *size [out] Size of the free part of the buffer.
+ */
+void *Untar_PipeContext_Get_buffer(Untar_PipeContext *ctx, size_t *size);
+
+/**
+ * @brief Commits data produced into the buffer returned by
+ * Untar_PipeContext_Get_buffer().
+ *
+ * A full buffer is handed to the extraction task.
+ *
+ * @param Untar_PipeContext *ctx [in] Pointer to a context structure.
+ * @param size_t size [in] Count of bytes produced.
+ *
+ * @return The status of the extraction so far.
+ */
+int Untar_PipeContext_Commit(Untar_PipeContext *ctx, size_t size);
+
+/**
+ * @brief Copies a chunk of a TAR buffer into the pipe buffers.
+ *
+ * @param Untar_PipeContext *ctx [in] Pointer to a context structure.
+ * @param const void *chunk [in] Pointer to a chunk of a TAR buffer.
+ * @param size_t chunk_size [in] Length of the chunk of a TAR buffer.
+ *
+ * @return The status of the extraction so far.
+ */
+int Untar_FromPipeChunk(
+  Untar_PipeContext *ctx,
+  const void *chunk,
+  size_t chunk_size
+);
+
+/**
+ * @brief Hands the remaining data to the extraction task and waits for the
+ * end of the extraction.
+ *
+ * @param Untar_PipeContext *ctx [in] Pointer to a context structure.
+ *
+ * @retval UNTAR_SUCCESSFUL (0)    on successful completion.
+ * @retval UNTAR_FAIL              for a faulty step within the process.
+ * @retval UNTAR_INVALID_CHECKSUM  for an invalid header checksum.
+ * @retval UNTAR_INVALID_HEADER    for an invalid header.
+ */
+int Untar_PipeContext_Finish(Untar_PipeContext *ctx);
+
 /**
  * @brief Initializes the Untar_ChunkGzContext.
  *
@@ -238,6 +423,38 @@ int Untar_FromXzChunk_Print(
   const rtems_printer* printer
 );
 
+/**
+ * @brief Untars a XZ compressed POSIX TAR file from memory.
+ *
+ * The blocks of a single stream archive are independent of each other.  They
+ * are located through the index at the end of the stream and decompressed by
+ * up to @a worker_count tasks in parallel into a temporary buffer of the
+ * uncompressed archive size.  The calling task is one of the workers, the
+ * other workers run at its current priority.  The uncompressed archive is
+ * then extracted with Untar_FromMemory_Print().  Archives with more than one
+ * block are produced for example by xz --block-size or xz --threads.
+ *
+ * If the archive has no usable index or the temporary buffer cannot be
+ * allocated, then the archive is extracted in chunks by the calling task.
+ *
+ * @param xz [in] The XZ compressed archive.
+ * @param xz_size [in] The size of the XZ compressed archive.
+ * @param dict_max [in] The maximum dictionary size of a worker.
+ * @param worker_count [in] The maximum count of workers.  A value of zero
+ *   uses one worker for each processor.
+ * @param printer [in] The printer for diagnostic messages.  May be NULL.
+ *
+ * @retval UNTAR_SUCCESSFUL Successful operation.
+ * @retval UNTAR_FAIL The archive is invalid or a resource is unavailable.
+ */
+int Untar_FromXzMemory_Print(
+  const void *xz,
+  size_t xz_size,
+  uint32_t dict_max,
+  uint32_t worker_count,
+  const rtems_printer *printer
+);
+
 int Untar_ProcessHeader(Untar_HeaderContext *ctx, const char *bufr);
 
 #ifdef __cplusplus
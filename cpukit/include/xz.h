@@ -251,6 +251,14 @@ XZ_EXTERN void xz_dec_end(struct xz_dec *s);
 #	endif
 #endif
 
+/*
+ * CRC64 is the default integrity check of the xz tool, so enable its
+ * support unless XZ_NO_CRC64 is defined.
+ */
+#if !defined(XZ_USE_CRC64) && !defined(XZ_NO_CRC64)
+#	define XZ_USE_CRC64
+#endif
+
 /*
  * If CRC64 support has been enabled with XZ_USE_CRC64, a CRC64
  * implementation is needed too.
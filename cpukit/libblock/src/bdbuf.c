@@ -802,6 +802,33 @@ rtems_bdbuf_media_block (const rtems_disk_device *dd, rtems_blkdev_bnum block)
       ((((uint64_t) block) * dd->block_size) / dd->media_block_size);
 }
 
+/**
+ * Return true if the BDs of this device point directly into the memory area of
+ * the physical device.
+ */
+static bool
+rtems_bdbuf_is_mapped (const rtems_disk_device *dd)
+{
+  return dd->phys_dev->mapped_area != NULL;
+}
+
+/**
+ * Return the buffer of the BD.  The buffer of a mapped device is the memory of
+ * the media block, otherwise it is the cache buffer of the BD.
+ */
+static void *
+rtems_bdbuf_buffer_of_bd (const rtems_bdbuf_buffer *bd,
+                          const rtems_disk_device  *dd,
+                          rtems_blkdev_bnum         media_block)
+{
+  if (rtems_bdbuf_is_mapped (dd))
+    return (char *) dd->phys_dev->mapped_area
+      + (size_t) media_block * dd->media_block_size;
+
+  return (char *) bdbuf_cache.buffers
+    + (size_t) (bd - bdbuf_cache.bds) * bdbuf_config.buffer_min;
+}
+
 /**
  * Lock the mutex. A single task can nest calls.
  *
@@ -1046,6 +1073,19 @@ rtems_bdbuf_add_to_lru_list_after_access (rtems_bdbuf_buffer *bd)
     rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
 }
 
+/**
+ * The modifications of a mapped device are already in the media, so the buffer
+ * is cached and not modified after the access.
+ */
+static void
+rtems_bdbuf_add_to_modified_or_lru_list_after_access (rtems_bdbuf_buffer *bd)
+{
+  if (rtems_bdbuf_is_mapped (bd->dd))
+    rtems_bdbuf_add_to_lru_list_after_access (bd);
+  else
+    rtems_bdbuf_add_to_modified_list_after_access (bd);
+}
+
 /**
  * Compute the number of BDs per group for a given buffer size.
  *
@@ -1131,6 +1171,7 @@ rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
 {
   bd->dd        = dd ;
   bd->block     = block;
+  bd->buffer    = rtems_bdbuf_buffer_of_bd (bd, dd, block);
   bd->avl.left  = NULL;
   bd->avl.right = NULL;
   bd->waiters   = 0;
@@ -2090,6 +2131,16 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_MODIFIED);
         break;
       case RTEMS_BDBUF_STATE_EMPTY:
+        if (rtems_bdbuf_is_mapped (dd))
+        {
+          /*
+           * The buffer is the media block, so there is nothing to transfer.
+           */
+          ++dd->stats.read_hits;
+          rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
+          break;
+        }
+
         ++dd->stats.read_misses;
         rtems_bdbuf_set_read_ahead_trigger (dd, block);
         sc = rtems_bdbuf_execute_read_request (dd, bd, 1);
@@ -2126,7 +2177,8 @@ rtems_bdbuf_peek (rtems_disk_device *dd,
 {
   rtems_bdbuf_lock_cache ();
 
-  if (bdbuf_cache.read_ahead_enabled && nr_blocks > 0)
+  if (bdbuf_cache.read_ahead_enabled && nr_blocks > 0
+      && !rtems_bdbuf_is_mapped (dd))
   {
     rtems_bdbuf_read_ahead_reset(dd);
     dd->read_ahead.next = block;
@@ -2200,7 +2252,7 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_add_to_modified_list_after_access (bd);
+      rtems_bdbuf_add_to_modified_or_lru_list_after_access (bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
       rtems_bdbuf_discard_buffer_after_access (bd);
@@ -2232,7 +2284,10 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_sync_after_access (bd);
+      if (rtems_bdbuf_is_mapped (bd->dd))
+        rtems_bdbuf_add_to_lru_list_after_access (bd);
+      else
+        rtems_bdbuf_sync_after_access (bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
       rtems_bdbuf_discard_buffer_after_access (bd);
@@ -2256,6 +2311,12 @@ rtems_bdbuf_syncdev (rtems_disk_device *dd)
   if (rtems_bdbuf_tracer)
     printf ("bdbuf:syncdev: %08x\n", (unsigned) dd->dev);
 
+  /*
+   * A mapped device has no modified buffers.
+   */
+  if (rtems_bdbuf_is_mapped (dd))
+    return RTEMS_SUCCESSFUL;
+
   /*
    * Take the sync lock before locking the cache. Once we have the sync lock we
    * can lock the cache. If another thread has the sync lock it will cause this
@@ -72,6 +72,14 @@ rtems_status_code rtems_disk_init_phys(
       dd->capabilities = 0;
     }
 
+    if (
+      (dd->capabilities & RTEMS_BLKDEV_CAP_MAPPED) != 0
+        && (*handler)(dd, RTEMS_BLKIO_GETMAPPEDAREA, &dd->mapped_area) != 0
+    ) {
+      dd->capabilities &= ~RTEMS_BLKDEV_CAP_MAPPED;
+      dd->mapped_area = NULL;
+    }
+
     sc = rtems_bdbuf_set_block_size(dd, block_size, false);
   } else {
     sc = RTEMS_INVALID_NUMBER;
@@ -76,6 +76,11 @@
 #define RTEMS_FDISK_TRACE 1
 #endif
 
+/**
+ * The event which wakes up the background task.
+ */
+#define RTEMS_FDISK_TASK_EVENT RTEMS_EVENT_0
+
 /**
  * The start of a segment has a segment control table. This hold the CRC and
  * block number for the page.
@@ -148,8 +153,8 @@ typedef struct rtems_fdisk_segment_ctl
 
   uint32_t failed;        /**< The segment has failed. */
 
-  uint32_t erased;        /**< Counter to debugging. Wear support would
-                               remove this. */
+  uint32_t erased;        /**< Number of times the segment has been erased
+                               since the driver initialization. */
 } rtems_fdisk_segment_ctl;
 
 /**
@@ -218,11 +223,26 @@ typedef struct rtems_flashdisk
                                                 when being erased. */
   rtems_mutex lock;                        /**< Mutex for threading protection.*/
 
+  rtems_id                 task;           /**< The background task or 0. */
+  rtems_fdisk_segment_ctl* erasing;        /**< The segment the background
+                                                task erases with the lock
+                                                released. */
+  rtems_condition_variable erase_done;     /**< Signalled when the background
+                                                task finished an erase. */
+  uint32_t                 erase_waiters;  /**< The number of operations
+                                                waiting for the background
+                                                erase to finish. */
+  uint32_t                 next_device;    /**< The device of the next write. */
+
   uint8_t* copy_buffer;                    /**< Copy buf used during compacting */
 
   uint32_t info_level;                     /**< The info trace level. */
 
   uint32_t starvations;                    /**< Erased blocks starvations counter. */
+
+  uint32_t wear_level_threshold;           /**< Erase count difference which
+                                                triggers static wear leveling. */
+  uint32_t wear_level_moves;               /**< Static wear leveling counter. */
 } rtems_flashdisk;
 
 /**
@@ -725,7 +745,8 @@ rtems_fdisk_seg_next_available_page (rtems_fdisk_segment_ctl* sc)
 }
 
 /**
- * Find the segment on the queue that has the most free pages.
+ * Find the segment on the queue that has the most free pages. Take the least
+ * erased segment if more than one segment has the most free pages.
  */
 static rtems_fdisk_segment_ctl*
 rtems_fdisk_seg_most_available (const rtems_fdisk_segment_ctl_queue* queue)
@@ -735,8 +756,11 @@ rtems_fdisk_seg_most_available (const rtems_fdisk_segment_ctl_queue* queue)
 
   while (sc)
   {
-    if (rtems_fdisk_seg_pages_available (sc) >
-        rtems_fdisk_seg_pages_available (biggest))
+    uint32_t available = rtems_fdisk_seg_pages_available (sc);
+    uint32_t biggest_available = rtems_fdisk_seg_pages_available (biggest);
+
+    if ((available > biggest_available) ||
+        ((available == biggest_available) && (sc->erased < biggest->erased)))
       biggest = sc;
     sc = sc->next;
   }
@@ -1073,13 +1097,69 @@ rtems_fdisk_page_checksum (const uint8_t* buffer, uint32_t page_size)
   return cs;
 }
 
+static void
+rtems_fdisk_queue_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc);
+
 /**
- * Erase the segment.
+ * Wake up the background task if there is one.
+ */
+static void
+rtems_fdisk_wake_task (const rtems_flashdisk* fd)
+{
+  if (fd->task != 0)
+    rtems_event_send (fd->task, RTEMS_FDISK_TASK_EVENT);
+}
+
+/**
+ * Wait until the background task finished the current erase. The background
+ * task does not start another erase while operations wait, so the disk is
+ * only erased in the background while no operation needs the device. The
+ * last waiting operation wakes the task up to continue with the erase queue.
+ * The lock must be held.
+ */
+static void
+rtems_fdisk_wait_for_erase_done (rtems_flashdisk* fd)
+{
+  ++fd->erase_waiters;
+  rtems_condition_variable_wait (&fd->erase_done, &fd->lock);
+  --fd->erase_waiters;
+
+  if ((fd->erase_waiters == 0) && fd->erase.head)
+    rtems_fdisk_wake_task (fd);
+}
+
+/**
+ * Wait for the background task to finish the erase of a segment. The lock
+ * must be held.
+ */
+static void
+rtems_fdisk_wait_for_erase (rtems_flashdisk* fd)
+{
+  while (fd->erasing)
+    rtems_fdisk_wait_for_erase_done (fd);
+}
+
+/**
+ * Wait for the background task to finish the erase of a segment if the
+ * block is on the device being erased. The driver must not be called for
+ * a device being erased. The lock must be held.
+ */
+static void
+rtems_fdisk_wait_for_block (rtems_flashdisk*             fd,
+                            const rtems_fdisk_block_ctl* bc)
+{
+  while (fd->erasing && bc->segment &&
+         (bc->segment->device == fd->erasing->device))
+    rtems_fdisk_wait_for_erase_done (fd);
+}
+
+/**
+ * Call the driver to erase the segment.
  */
 static int
-rtems_fdisk_erase_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
+rtems_fdisk_seg_erase (const rtems_flashdisk*         fd,
+                       const rtems_fdisk_segment_ctl* sc)
 {
-  int                                ret;
   uint32_t                           device;
   uint32_t                           segment;
   const rtems_fdisk_segment_desc*    sd;
@@ -1088,7 +1168,21 @@ rtems_fdisk_erase_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
   segment = sc->segment;
   sd = rtems_fdisk_seg_descriptor (fd, device, segment);
   ops = fd->devices[device].descriptor->flash_ops;
-  ret = ops->erase (sd, device, segment);
+  return ops->erase (sd, device, segment);
+}
+
+/**
+ * Update the segment control after the driver erased the segment.
+ *
+ * @param fd The flash disk control table.
+ * @param sc The segment control table of the erased segment.
+ * @param ret The return value of the driver erase call.
+ */
+static int
+rtems_fdisk_erase_segment_done (rtems_flashdisk*         fd,
+                                rtems_fdisk_segment_ctl* sc,
+                                int                      ret)
+{
   if (ret)
   {
     rtems_fdisk_error (" erase-segment:%02d-%03d: "      \
@@ -1112,15 +1206,41 @@ rtems_fdisk_erase_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
   sc->failed = false;
 
   /*
-   * Push to the tail of the available queue. It is a very
-   * simple type of wear reduction. Every other available
-   * segment will now get a go.
+   * Queue behind the empty segments with a lower erase count. This is
+   * the dynamic wear leveling. Every less erased available segment will
+   * get a go first.
    */
-  rtems_fdisk_segment_queue_push_tail (&fd->available, sc);
+  rtems_fdisk_queue_segment (fd, sc);
 
   return 0;
 }
 
+/**
+ * Erase the segment.
+ */
+static int
+rtems_fdisk_erase_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
+{
+  return rtems_fdisk_erase_segment_done (fd, sc, rtems_fdisk_seg_erase (fd, sc));
+}
+
+/**
+ * Erase the segment now or leave it to the background handler if the driver
+ * has been configured to background erase.
+ */
+static int
+rtems_fdisk_release_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
+{
+  if ((fd->flags & RTEMS_FDISK_BACKGROUND_ERASE))
+  {
+    rtems_fdisk_segment_queue_push_tail (&fd->erase, sc);
+    rtems_fdisk_wake_task (fd);
+    return 0;
+  }
+
+  return rtems_fdisk_erase_segment (fd, sc);
+}
+
 /**
  * Erase used segment.
  */
@@ -1130,6 +1250,8 @@ rtems_fdisk_erase_used (rtems_flashdisk* fd)
   rtems_fdisk_segment_ctl* sc;
   int                      latched_ret = 0;
 
+  rtems_fdisk_wait_for_erase (fd);
+
   while ((sc = rtems_fdisk_segment_queue_pop_head (&fd->erase)))
   {
     /*
@@ -1211,10 +1333,7 @@ rtems_fdisk_queue_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
     }
     else
     {
-      if ((fd->flags & RTEMS_FDISK_BACKGROUND_ERASE))
-        rtems_fdisk_segment_queue_push_tail (&fd->erase, sc);
-      else
-        rtems_fdisk_erase_segment (fd, sc);
+      rtems_fdisk_release_segment (fd, sc);
     }
   }
   else
@@ -1228,29 +1347,28 @@ rtems_fdisk_queue_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
      * empty segments longer aiding compaction.
      *
      * The down side is the wear effect as a single segment
-     * could be used more than segment. This will not be
-     * addressed until wear support is added.
-     *
-     * @note Wear support can be added by having counts for
-     * for the number of times a segment is erased. This
-     * available list is then sorted on the least number
-     * of available pages then empty segments are sorted
-     * on the least number of erases the segment has.
+     * could be used more than segment. Segments with the same
+     * number of available pages, for example the empty
+     * segments, are sorted on the least number of erases the
+     * segment has.
      *
-     * The erase count can be stored in specially flaged
-     * pages and contain a counter (32bits?) and 32 bits
-     * for each segment. When a segment is erased a
-     * bit is cleared for that segment. When 32 erasers
-     * has occurred the page is re-written to the flash
-     * with all the counters updated with the number of
-     * bits cleared and all bits set back to 1.
+     * @note The erase counts are only held in memory. They
+     * could be stored in specially flaged pages and contain a
+     * counter (32bits?) and 32 bits for each segment. When a
+     * segment is erased a bit is cleared for that segment.
+     * When 32 erasers has occurred the page is re-written to
+     * the flash with all the counters updated with the number
+     * of bits cleared and all bits set back to 1.
      */
     rtems_fdisk_segment_ctl* seg = fd->available.head;
+    uint32_t                 available = rtems_fdisk_seg_pages_available (sc);
 
     while (seg)
     {
-      if (rtems_fdisk_seg_pages_available (sc) <
-          rtems_fdisk_seg_pages_available (seg))
+      uint32_t seg_available = rtems_fdisk_seg_pages_available (seg);
+
+      if ((available < seg_available) ||
+          ((available == seg_available) && (sc->erased < seg->erased)))
         break;
       seg = seg->next;
     }
@@ -1372,7 +1490,7 @@ rtems_fdisk_recycle_segment (rtems_flashdisk*         fd,
         {
           if (ssc->pages_active == 0)
           {
-            ret = rtems_fdisk_erase_segment (fd, ssc);
+            ret = rtems_fdisk_release_segment (fd, ssc);
           }
           else
           {
@@ -1407,11 +1525,89 @@ rtems_fdisk_recycle_segment (rtems_flashdisk*         fd,
                        ssc->pages_active);
   }
 
-  ret = rtems_fdisk_erase_segment (fd, ssc);
+  ret = rtems_fdisk_release_segment (fd, ssc);
 
   return ret;
 }
 
+/**
+ * Static wear leveling. A segment with blocks which are not written again is
+ * not compacted and so not erased. Move the active pages of the least erased
+ * segment to the most erased empty segment if its erase count is more than
+ * the threshold below the erase count of the most erased segment. At most one
+ * segment is moved per call to bound the delay of a write.
+ */
+static int
+rtems_fdisk_level_wear (rtems_flashdisk* fd)
+{
+  rtems_fdisk_segment_ctl* ssc = 0;
+  rtems_fdisk_segment_ctl* dsc = 0;
+  rtems_fdisk_segment_ctl* sc;
+  uint32_t                 max_erased = 0;
+  uint32_t                 device;
+  uint32_t                 pages;
+
+  if (fd->wear_level_threshold == 0)
+    return 0;
+
+  for (device = 0; device < fd->device_count; device++)
+  {
+    uint32_t segment;
+
+    for (segment = 0; segment < fd->devices[device].segment_count; segment++)
+    {
+      sc = &fd->devices[device].segments[segment];
+
+      if (sc->failed)
+        continue;
+
+      if (sc->erased > max_erased)
+        max_erased = sc->erased;
+
+      if (sc->pages_active && (!ssc || (sc->erased < ssc->erased)))
+        ssc = sc;
+    }
+  }
+
+  if (!ssc || ((max_erased - ssc->erased) <= fd->wear_level_threshold))
+    return 0;
+
+  rtems_fdisk_segment_queue_remove (&fd->available, ssc);
+  rtems_fdisk_segment_queue_remove (&fd->used, ssc);
+
+  /*
+   * The cold blocks are placed into the most erased segment so this segment
+   * gets a rest.
+   */
+  for (sc = fd->available.head; sc; sc = sc->next)
+  {
+    if (!dsc ||
+        (rtems_fdisk_seg_pages_available (sc) >
+         rtems_fdisk_seg_pages_available (dsc)) ||
+        ((rtems_fdisk_seg_pages_available (sc) ==
+          rtems_fdisk_seg_pages_available (dsc)) &&
+         (sc->erased > dsc->erased)))
+      dsc = sc;
+  }
+
+  if (!dsc || (rtems_fdisk_seg_pages_available (dsc) < ssc->pages_active))
+  {
+    rtems_fdisk_queue_segment (fd, ssc);
+    return 0;
+  }
+
+#if RTEMS_FDISK_TRACE
+  rtems_fdisk_info (fd, " level-wear:%02d-%03d=>%02d-%03d: e=%d/%d max=%d",
+                    ssc->device, ssc->segment, dsc->device, dsc->segment,
+                    ssc->erased, dsc->erased, max_erased);
+#endif
+
+  fd->wear_level_moves++;
+
+  pages = ssc->pages_active;
+  return rtems_fdisk_recycle_segment (fd, ssc, dsc, &pages);
+}
+
 /**
  * Compact the used segments to free what is available. Find the segment
  * with the most available number of pages and see if we have
@@ -1427,6 +1623,11 @@ rtems_fdisk_compact (rtems_flashdisk* fd)
   uint32_t compacted_segs = 0;
   uint32_t pages;
 
+  /*
+   * Compacting copies pages between segments on any device.
+   */
+  rtems_fdisk_wait_for_erase (fd);
+
   if (rtems_fdisk_is_erased_blocks_starvation (fd))
   {
 #if RTEMS_FDISK_TRACE
@@ -1544,7 +1745,55 @@ rtems_fdisk_compact (rtems_flashdisk* fd)
     compacted_segs += segments;
   }
 
-  return 0;
+  return rtems_fdisk_level_wear (fd);
+}
+
+/**
+ * The background task erases the used segments and compacts. The lock is
+ * released while the driver erases a segment so the blocks in the segments
+ * of the other devices can be read and written in the meantime. An
+ * operation which needs the device being erased waits for the erase to
+ * finish. No further erase is started while operations wait.
+ */
+static rtems_task
+rtems_fdisk_task (rtems_task_argument arg)
+{
+  rtems_flashdisk* fd = (rtems_flashdisk*) arg;
+
+  while (true)
+  {
+    rtems_event_set          events;
+    rtems_fdisk_segment_ctl* sc;
+
+    rtems_event_receive (RTEMS_FDISK_TASK_EVENT,
+                         RTEMS_EVENT_ANY | RTEMS_WAIT,
+                         RTEMS_NO_TIMEOUT,
+                         &events);
+
+    rtems_mutex_lock (&fd->lock);
+
+    while ((fd->erase_waiters == 0) &&
+           (sc = rtems_fdisk_segment_queue_pop_head (&fd->erase)))
+    {
+      int ret;
+
+      fd->erasing = sc;
+      rtems_mutex_unlock (&fd->lock);
+
+      ret = rtems_fdisk_seg_erase (fd, sc);
+
+      rtems_mutex_lock (&fd->lock);
+      fd->erasing = 0;
+      rtems_condition_variable_broadcast (&fd->erase_done);
+
+      rtems_fdisk_erase_segment_done (fd, sc, ret);
+    }
+
+    if ((fd->flags & RTEMS_FDISK_BACKGROUND_COMPACT))
+      rtems_fdisk_compact (fd);
+
+    rtems_mutex_unlock (&fd->lock);
+  }
 }
 
 /**
@@ -1769,6 +2018,8 @@ rtems_fdisk_read_block (rtems_flashdisk* fd,
 
   bc = &fd->blocks[block];
 
+  rtems_fdisk_wait_for_block (fd, bc);
+
   if (!bc->segment)
   {
 #if RTEMS_FDISK_TRACE
@@ -1838,6 +2089,44 @@ rtems_fdisk_read_block (rtems_flashdisk* fd,
   return EIO;
 }
 
+/**
+ * Take the segment for the next write from the available queue. With more
+ * than one device the writes rotate over the devices and skip the device the
+ * background task erases, so the program and erase operations overlap. The
+ * first segment of a device on the available queue is the one of this device
+ * with the least number of available pages. If only segments of the device
+ * being erased are available wait for the erase to finish.
+ */
+static rtems_fdisk_segment_ctl*
+rtems_fdisk_take_write_segment (rtems_flashdisk* fd)
+{
+  uint32_t i;
+
+  for (i = 0; (fd->device_count > 1) && (i < fd->device_count); i++)
+  {
+    uint32_t                 device = (fd->next_device + i) % fd->device_count;
+    rtems_fdisk_segment_ctl* sc;
+
+    if (fd->erasing && (fd->erasing->device == device))
+      continue;
+
+    for (sc = fd->available.head; sc; sc = sc->next)
+    {
+      if (sc->device == device)
+      {
+        rtems_fdisk_segment_queue_remove (&fd->available, sc);
+        fd->next_device = (device + 1) % fd->device_count;
+        return sc;
+      }
+    }
+  }
+
+  if (fd->erasing && fd->available.head)
+    rtems_fdisk_wait_for_erase (fd);
+
+  return rtems_fdisk_segment_queue_pop_head (&fd->available);
+}
+
 /**
  * Write a block. The block:
  *
@@ -1847,8 +2136,9 @@ rtems_fdisk_read_block (rtems_flashdisk* fd,
  * If the block does not exist in flash we need to get the next
  * segment available to place the page into. The segments with
  * available pages are held on the avaliable list sorted on least
- * number of available pages as the primary key. Currently there
- * is no secondary key. Empty segments are at the end of the list.
+ * number of available pages as the primary key and the erase count
+ * as the secondary key. Empty segments are at the end of the list.
+ * With more than one device the writes rotate over the devices.
  *
  * If the block already exists we need to set the USED bit in the
  * current page's flags. This is a single byte which changes a 1 to
@@ -1890,6 +2180,11 @@ rtems_fdisk_write_block (rtems_flashdisk* fd,
 
   bc = &fd->blocks[block];
 
+  /*
+   * The page of the block is verified and flagged used on its device.
+   */
+  rtems_fdisk_wait_for_block (fd, bc);
+
   /*
    * Does the page exist in flash ?
    */
@@ -1956,6 +2251,8 @@ rtems_fdisk_write_block (rtems_flashdisk* fd,
      */
     if ((fd->flags & RTEMS_FDISK_BACKGROUND_COMPACT) == 0)
       rtems_fdisk_compact (fd);
+    else
+      rtems_fdisk_wake_task (fd);
   }
 
   /*
@@ -1970,24 +2267,34 @@ rtems_fdisk_write_block (rtems_flashdisk* fd,
   /*
    * Get the next avaliable segment.
    */
-  sc = rtems_fdisk_segment_queue_pop_head (&fd->available);
+  sc = rtems_fdisk_take_write_segment (fd);
 
   /*
    * Is the flash disk full ?
    */
   if (!sc)
   {
+    /*
+     * Wait for a segment the background handler is erasing then
+     * erase the remaining used segments now rather than wait for
+     * the background handler to get to them.
+     */
+    rtems_fdisk_erase_used (fd);
+
     /*
      * If compacting is configured for the background do it now
      * to see if we can get some space back.
      */
     if ((fd->flags & RTEMS_FDISK_BACKGROUND_COMPACT))
+    {
       rtems_fdisk_compact (fd);
+      rtems_fdisk_erase_used (fd);
+    }
 
     /*
      * Try again for some free space.
      */
-    sc = rtems_fdisk_segment_queue_pop_head (&fd->available);
+    sc = rtems_fdisk_take_write_segment (fd);
 
     if (!sc)
     {
@@ -2168,15 +2475,22 @@ rtems_fdisk_erase_disk (rtems_flashdisk* fd)
   rtems_fdisk_info (fd, "erase-disk");
 #endif
 
+  rtems_fdisk_wait_for_erase (fd);
+
   ret = rtems_fdisk_erase_flash (fd);
 
   if (ret == 0)
   {
     for (device = 0; device < fd->device_count; device++)
     {
+      uint32_t segment;
+
       if (!fd->devices[device].segments)
         return ENOMEM;
 
+      for (segment = 0; segment < fd->devices[device].segment_count; segment++)
+        fd->devices[device].segments[segment].erased++;
+
       ret = rtems_fdisk_recover_block_mappings (fd);
       if (ret)
         break;
@@ -2219,6 +2533,10 @@ rtems_fdisk_monitoring_data (rtems_flashdisk*          fd,
   data->pages_bad     = 0;
   data->seg_erases    = 0;
 
+  data->seg_erases_min   = UINT32_MAX;
+  data->seg_erases_max   = 0;
+  data->wear_level_moves = fd->wear_level_moves;
+
   for (i = 0; i < fd->device_count; i++)
   {
     data->segment_count += fd->devices[i].segment_count;
@@ -2233,13 +2551,45 @@ rtems_fdisk_monitoring_data (rtems_flashdisk*          fd,
       data->pages_used   += sc->pages_used;
       data->pages_bad    += sc->pages_bad;
       data->seg_erases   += sc->erased;
+
+      if (sc->erased < data->seg_erases_min)
+        data->seg_erases_min = sc->erased;
+      if (sc->erased > data->seg_erases_max)
+        data->seg_erases_max = sc->erased;
     }
   }
 
+  if (data->segment_count == 0)
+    data->seg_erases_min = 0;
+
   data->info_level = fd->info_level;
   return 0;
 }
 
+/**
+ * Flash Disk Erase Counts are returned for each segment.
+ */
+static int
+rtems_fdisk_erase_counts_data (rtems_flashdisk*          fd,
+                               rtems_fdisk_erase_counts* counts)
+{
+  uint32_t count = 0;
+  uint32_t i;
+  uint32_t j;
+
+  for (i = 0; i < fd->device_count; i++)
+  {
+    for (j = 0; j < fd->devices[i].segment_count; j++, count++)
+    {
+      if (count < counts->segment_count)
+        counts->erase_counts[count] = fd->devices[i].segments[j].erased;
+    }
+  }
+
+  counts->segment_count = count;
+  return 0;
+}
+
 /**
  * Print to stdout the status of the driver. This is a debugging aid.
  */
@@ -2442,6 +2792,11 @@ rtems_fdisk_ioctl (rtems_disk_device *dd, uint32_t req, void* argp)
       errno = rtems_fdisk_print_status (fd);
       break;
 
+    case RTEMS_FDISK_IOCTL_ERASE_COUNTS:
+      errno = rtems_fdisk_erase_counts_data (fd,
+                                             (rtems_fdisk_erase_counts*) argp);
+      break;
+
     default:
       rtems_blkdev_ioctl (dd, req, argp);
       break;
@@ -2496,6 +2851,8 @@ rtems_fdisk_initialize (rtems_device_major_number major,
     fd->unavail_blocks     = c->unavail_blocks;
     fd->info_level         = c->info_level;
 
+    fd->wear_level_threshold = c->wear_level_threshold;
+
     for (device = 0; device < c->device_count; device++)
       blocks += rtems_fdisk_blocks_in_device (&c->devices[device],
                                               c->block_size);
@@ -2518,12 +2875,14 @@ rtems_fdisk_initialize (rtems_device_major_number major,
       return RTEMS_NO_MEMORY;
 
     rtems_mutex_init (&fd->lock, "Flash Disk");
+    rtems_condition_variable_init (&fd->erase_done, "Flash Disk Erase");
 
     sc = rtems_blkdev_create(name, c->block_size, blocks - fd->unavail_blocks,
                              rtems_fdisk_ioctl, fd);
     if (sc != RTEMS_SUCCESSFUL)
     {
       rtems_mutex_destroy (&fd->lock);
+      rtems_condition_variable_destroy (&fd->erase_done);
       free (fd->copy_buffer);
       free (fd->blocks);
       free (fd->devices);
@@ -2545,6 +2904,7 @@ rtems_fdisk_initialize (rtems_device_major_number major,
       {
         unlink (name);
         rtems_mutex_destroy (&fd->lock);
+        rtems_condition_variable_destroy (&fd->erase_done);
         free (fd->copy_buffer);
         free (fd->blocks);
         free (fd->devices);
@@ -2580,6 +2940,7 @@ rtems_fdisk_initialize (rtems_device_major_number major,
     {
       unlink (name);
       rtems_mutex_destroy (&fd->lock);
+      rtems_condition_variable_destroy (&fd->erase_done);
       free (fd->copy_buffer);
       free (fd->blocks);
       free (fd->devices);
@@ -2593,6 +2954,7 @@ rtems_fdisk_initialize (rtems_device_major_number major,
     {
       unlink (name);
       rtems_mutex_destroy (&fd->lock);
+      rtems_condition_variable_destroy (&fd->erase_done);
       free (fd->copy_buffer);
       free (fd->blocks);
       free (fd->devices);
@@ -2600,6 +2962,49 @@ rtems_fdisk_initialize (rtems_device_major_number major,
                          strerror (ret), ret);
       return ret;
     }
+
+    if ((c->task_priority != 0) &&
+        ((fd->flags & (RTEMS_FDISK_BACKGROUND_ERASE |
+                       RTEMS_FDISK_BACKGROUND_COMPACT)) != 0))
+    {
+      size_t stack_size = c->task_stack_size;
+
+      if (stack_size == 0)
+        stack_size = 2 * RTEMS_MINIMUM_STACK_SIZE;
+
+      sc = rtems_task_create (rtems_build_name ('F', 'D', 'K', 'a' + minor),
+                              c->task_priority,
+                              stack_size,
+                              RTEMS_DEFAULT_MODES,
+                              RTEMS_DEFAULT_ATTRIBUTES,
+                              &fd->task);
+      if (sc == RTEMS_SUCCESSFUL)
+      {
+        sc = rtems_task_start (fd->task, rtems_fdisk_task,
+                               (rtems_task_argument) fd);
+        if (sc != RTEMS_SUCCESSFUL)
+          rtems_task_delete (fd->task);
+      }
+
+      if (sc != RTEMS_SUCCESSFUL)
+      {
+        fd->task = 0;
+        unlink (name);
+        rtems_mutex_destroy (&fd->lock);
+        rtems_condition_variable_destroy (&fd->erase_done);
+        free (fd->copy_buffer);
+        free (fd->blocks);
+        free (fd->devices);
+        rtems_fdisk_error ("background task create failed: %s",
+                           rtems_status_text (sc));
+        return sc;
+      }
+
+      /*
+       * Erase the segments queued during the recovery.
+       */
+      rtems_fdisk_wake_task (fd);
+    }
   }
 
   return RTEMS_SUCCESSFUL;
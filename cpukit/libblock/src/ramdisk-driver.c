@@ -121,6 +121,17 @@ ramdisk_ioctl(rtems_disk_device *dd, uint32_t req, void *argp)
             break;
         }
 
+        case RTEMS_BLKIO_CAPABILITIES:
+            *(uint32_t *) argp = rd->mapped ? RTEMS_BLKDEV_CAP_MAPPED : 0;
+            return 0;
+
+        case RTEMS_BLKIO_GETMAPPEDAREA:
+            if (rd->mapped) {
+              *(void **) argp = rd->area;
+              return 0;
+            }
+            break;
+
         case RTEMS_BLKIO_DELETED:
             if (rd->free_at_delete_request) {
               ramdisk_free(rd);
@@ -105,8 +105,13 @@ static rtems_status_code sparse_disk_initialize( rtems_sparse_disk *sd,
 
   data                  += key_table_size;
 
+  rtems_rbtree_initialize_empty( &sd->block_tree );
+  rtems_chain_initialize_empty( &sd->free_keys );
+
   for ( i = 0; i < blocks_with_buffer; ++i, data += media_block_size ) {
     sd->key_table[i].data = data;
+    rtems_chain_append_unprotected( &sd->free_keys,
+                                    &sd->key_table[i].node.free_node );
   }
 
   sd->media_block_size = media_block_size;
@@ -116,10 +121,14 @@ static rtems_status_code sparse_disk_initialize( rtems_sparse_disk *sd,
 /*
  * Block comparison
  */
-static int sparse_disk_compare( const void *aa, const void *bb )
+static rtems_rbtree_compare_result sparse_disk_compare(
+  const rtems_rbtree_node *aa,
+  const rtems_rbtree_node *bb )
 {
-  const rtems_sparse_disk_key *a = aa;
-  const rtems_sparse_disk_key *b = bb;
+  const rtems_sparse_disk_key *a = RTEMS_CONTAINER_OF(
+    aa, rtems_sparse_disk_key, node.tree_node );
+  const rtems_sparse_disk_key *b = RTEMS_CONTAINER_OF(
+    bb, rtems_sparse_disk_key, node.tree_node );
 
   if ( a->block < b->block ) {
     return -1;
@@ -136,37 +145,80 @@ static rtems_sparse_disk_key *sparse_disk_find_block(
 )
 {
   rtems_sparse_disk_key key = { .block = block };
+  rtems_rbtree_node    *node;
 
-  return bsearch(
-    &key,
-    sparse_disk->key_table,
-    sparse_disk->used_count,
-    sizeof( rtems_sparse_disk_key ),
-    sparse_disk_compare
+  node = rtems_rbtree_find(
+    &sparse_disk->block_tree,
+    &key.node.tree_node,
+    sparse_disk_compare,
+    true
   );
+
+  if ( NULL == node )
+    return NULL;
+
+  return RTEMS_CONTAINER_OF( node, rtems_sparse_disk_key, node.tree_node );
 }
 
+/*
+ * Takes a key from the free key pool and inserts it into the block tree.  This
+ * is O(log n) in the count of blocks in use.
+ */
 static rtems_sparse_disk_key *sparse_disk_get_new_block(
   rtems_sparse_disk      *sparse_disk,
   const rtems_blkdev_bnum block
 )
 {
+  rtems_chain_node      *node;
   rtems_sparse_disk_key *key;
 
-  if ( sparse_disk->used_count >= sparse_disk->blocks_with_buffer ) {
+  node = rtems_chain_get_unprotected( &sparse_disk->free_keys );
+
+  if ( NULL == node ) {
     return NULL;
   }
 
-  key = &sparse_disk->key_table[ sparse_disk->used_count ];
+  key = RTEMS_CONTAINER_OF( node, rtems_sparse_disk_key, node.free_node );
   key->block = block;
-  ++sparse_disk->used_count;
-  qsort(
-    sparse_disk->key_table,
-    sparse_disk->used_count,
-    sizeof( rtems_sparse_disk_key ),
-    sparse_disk_compare
+  rtems_rbtree_insert(
+    &sparse_disk->block_tree,
+    &key->node.tree_node,
+    sparse_disk_compare,
+    true
   );
-  return sparse_disk_find_block( sparse_disk, block );
+  ++sparse_disk->used_count;
+  return key;
+}
+
+/*
+ * Returns the key of a block which contains only fill pattern bytes to the
+ * free key pool.  The stale buffer content is overwritten by the next user of
+ * the key.
+ */
+static void sparse_disk_release_block(
+  rtems_sparse_disk     *sparse_disk,
+  rtems_sparse_disk_key *key
+)
+{
+  rtems_rbtree_extract( &sparse_disk->block_tree, &key->node.tree_node );
+  rtems_chain_prepend_unprotected( &sparse_disk->free_keys,
+                                   &key->node.free_node );
+  --sparse_disk->used_count;
+}
+
+static bool sparse_disk_is_fill_pattern(
+  const rtems_sparse_disk *sparse_disk,
+  const uint8_t           *buffer,
+  const size_t             size )
+{
+  size_t i;
+
+  for ( i = 0; i < size; ++i ) {
+    if ( buffer[i] != sparse_disk->fill_pattern )
+      return false;
+  }
+
+  return true;
 }
 
 static int sparse_disk_read_block(
@@ -198,9 +250,8 @@ static int sparse_disk_write_block(
   const size_t            buffer_size )
 {
   size_t                 bytes_to_copy = sparse_disk->media_block_size;
-  bool                   block_needs_writing = false;
+  bool                   is_fill_pattern;
   rtems_sparse_disk_key *key;
-  size_t                 i;
 
   if ( buffer_size < bytes_to_copy )
     bytes_to_copy = buffer_size;
@@ -209,23 +260,31 @@ static int sparse_disk_write_block(
    * If the read method does not find a block it will deliver the fill pattern anyway.
    */
 
-  key = sparse_disk_find_block( sparse_disk, block );
+  is_fill_pattern = sparse_disk_is_fill_pattern( sparse_disk,
+                                                 buffer,
+                                                 bytes_to_copy );
+  key             = sparse_disk_find_block( sparse_disk, block );
 
   if ( NULL == key ) {
-    for ( i = 0; ( !block_needs_writing ) && ( i < bytes_to_copy ); ++i ) {
-      if ( buffer[i] != sparse_disk->fill_pattern )
-        block_needs_writing = true;
-    }
-
-    if ( block_needs_writing ) {
-      key = sparse_disk_get_new_block( sparse_disk, block );
-    }
+    if ( is_fill_pattern )
+      return bytes_to_copy;
+
+    key = sparse_disk_get_new_block( sparse_disk, block );
+
+    if ( NULL == key )
+      return -1;
+
+    /* The buffer may contain stale data of a released block */
+    memset( (uint8_t *) key->data + bytes_to_copy,
+            sparse_disk->fill_pattern,
+            sparse_disk->media_block_size - bytes_to_copy );
+  } else if ( is_fill_pattern
+              && bytes_to_copy == sparse_disk->media_block_size ) {
+    sparse_disk_release_block( sparse_disk, key );
+    return bytes_to_copy;
   }
 
-  if ( NULL != key )
-    memcpy( key->data, buffer, bytes_to_copy );
-  else if ( block_needs_writing )
-    return -1;
+  memcpy( key->data, buffer, bytes_to_copy );
 
   return bytes_to_copy;
 }
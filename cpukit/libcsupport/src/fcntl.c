@@ -104,6 +104,25 @@ static int duplicate2_iop( rtems_libio_t *iop, int fd2 )
   return rv;
 }
 
+static int pipe_size_iop( rtems_libio_t *iop, int cmd, int size )
+{
+  ioctl_command_t request;
+  int             rv;
+
+  if ( cmd == F_SETPIPE_SZ ) {
+    request = RTEMS_IO_SET_PIPE_SIZE;
+  } else {
+    request = RTEMS_IO_GET_PIPE_SIZE;
+  }
+
+  rv = (*iop->pathinfo.handlers->ioctl_h)( iop, request, &size );
+  if ( rv != 0 ) {
+    return -1;
+  }
+
+  return size;
+}
+
 static int vfcntl(
   int fd,
   int cmd,
@@ -196,6 +215,14 @@ static int vfcntl(
       ret = -1;
       break;
 
+    case F_SETPIPE_SZ:
+      ret = pipe_size_iop( iop, cmd, va_arg( ap, int ) );
+      break;
+
+    case F_GETPIPE_SZ:
+      ret = pipe_size_iop( iop, cmd, 0 );
+      break;
+
     default:
       errno = EINVAL;
       ret = -1;
@@ -27,6 +27,7 @@
 #include <rtems.h>
 #include <rtems/libio_.h>
 #include <rtems/assoc.h>
+#include <rtems/score/threaddispatch.h>
 
 /* define this to alias O_NDELAY to  O_NONBLOCK, i.e.,
  * O_NDELAY is accepted on input but fcntl(F_GETFL) returns
@@ -106,26 +107,87 @@ int rtems_libio_to_fcntl_flags( unsigned int flags )
   return fcntl_flags;
 }
 
+/*
+ * The free iops are managed by a ring without a lock, see
+ * rtems_libio_iop_free_cell.  Thread dispatching is disabled while a cell is
+ * claimed and not yet updated.  This bounds the time other processors may
+ * have to wait for the cell.
+ */
+
 rtems_libio_t *rtems_libio_allocate( void )
 {
-  rtems_libio_t *iop;
-
-  rtems_libio_lock();
-
-  iop = rtems_libio_iop_free_head;
-
-  if ( iop != NULL ) {
-    void *next;
-
-    next = iop->data1;
-    rtems_libio_iop_free_head = next;
+  Per_CPU_Control           *cpu_self;
+  rtems_libio_iop_free_cell *cell;
+  unsigned int               pos;
+  rtems_libio_t             *iop;
+
+  cpu_self = _Thread_Dispatch_disable();
+  pos = _Atomic_Load_uint(
+    &rtems_libio_iop_free_dequeue,
+    ATOMIC_ORDER_RELAXED
+  );
 
-    if ( next == NULL ) {
-      rtems_libio_iop_free_tail = &rtems_libio_iop_free_head;
+  while ( true ) {
+    unsigned int sequence;
+    int          delta;
+
+    cell = &rtems_libio_iop_free_ring[ pos & rtems_libio_iop_free_ring_mask ];
+    sequence = _Atomic_Load_uint( &cell->sequence, ATOMIC_ORDER_ACQUIRE );
+    delta = (int) ( sequence - ( pos + 1 ) );
+
+    if ( delta == 0 ) {
+      /* The cell contains the free iop of this position */
+      if (
+        _Atomic_Compare_exchange_uint(
+          &rtems_libio_iop_free_dequeue,
+          &pos,
+          pos + 1,
+          ATOMIC_ORDER_RELAXED,
+          ATOMIC_ORDER_RELAXED
+        )
+      ) {
+        break;
+      }
+    } else if ( delta < 0 ) {
+      unsigned int enqueue;
+
+      enqueue = _Atomic_Load_uint(
+        &rtems_libio_iop_free_enqueue,
+        ATOMIC_ORDER_RELAXED
+      );
+
+      /*
+       * If no iop is appended to this position right now, then there is no
+       * free iop.
+       */
+      if ( enqueue == pos ) {
+        _Thread_Dispatch_enable( cpu_self );
+        return NULL;
+      }
+
+      pos = _Atomic_Load_uint(
+        &rtems_libio_iop_free_dequeue,
+        ATOMIC_ORDER_RELAXED
+      );
+    } else {
+      /* Another thread allocated the iop of this position */
+      pos = _Atomic_Load_uint(
+        &rtems_libio_iop_free_dequeue,
+        ATOMIC_ORDER_RELAXED
+      );
     }
   }
 
-  rtems_libio_unlock();
+  iop = cell->iop;
+
+  /* Make the cell ready to be filled in the next round of the ring */
+  _Atomic_Store_uint(
+    &cell->sequence,
+    pos + rtems_libio_iop_free_ring_mask + 1,
+    ATOMIC_ORDER_RELEASE
+  );
+
+  _Thread_Dispatch_enable( cpu_self );
 
   return iop;
 }
@@ -134,12 +196,13 @@ void rtems_libio_free(
   rtems_libio_t *iop
 )
 {
-  size_t zero;
+  Per_CPU_Control           *cpu_self;
+  rtems_libio_iop_free_cell *cell;
+  unsigned int               pos;
+  size_t                     zero;
 
   rtems_filesystem_location_free( &iop->pathinfo );
 
-  rtems_libio_lock();
-
   /*
    * Clear everything except the reference count part.  At this point in time
    * there may be still some holders of this file descriptor.
@@ -149,11 +212,29 @@ void rtems_libio_free(
   memset( (char *) iop + zero, 0, sizeof( *iop ) - zero );
 
   /*
-   * Append it to the free list.  This increases the likelihood that a use
-   * after close is detected.
+   * Append it to the free ring.  This increases the likelihood that a use
+   * after close is detected.  The ring has a cell for each iop, so it cannot
+   * be full.
+   */
+  cpu_self = _Thread_Dispatch_disable();
+  pos = _Atomic_Fetch_add_uint(
+    &rtems_libio_iop_free_enqueue,
+    1,
+    ATOMIC_ORDER_RELAXED
+  );
+  cell = &rtems_libio_iop_free_ring[ pos & rtems_libio_iop_free_ring_mask ];
+
+  /*
+   * Wait for an allocation on another processor which claimed the cell in the
+   * previous round of the ring but did not yet update it.
    */
-  *rtems_libio_iop_free_tail = iop;
-  rtems_libio_iop_free_tail = &iop->data1;
+  while (
+    _Atomic_Load_uint( &cell->sequence, ATOMIC_ORDER_ACQUIRE ) != pos
+  ) {
+    /* Wait */
+  }
 
-  rtems_libio_unlock();
+  cell->iop = iop;
+  _Atomic_Store_uint( &cell->sequence, pos + 1, ATOMIC_ORDER_RELEASE );
+  _Thread_Dispatch_enable( cpu_self );
 }
@@ -41,23 +41,24 @@ void rtems_libio_unlock( void )
   _API_Mutex_Unlock( &rtems_libio_mutex );
 }
 
-void *rtems_libio_iop_free_head;
+Atomic_Uint rtems_libio_iop_free_enqueue;
 
-void **rtems_libio_iop_free_tail = &rtems_libio_iop_free_head;
+Atomic_Uint rtems_libio_iop_free_dequeue;
 
 static void rtems_libio_init( void )
 {
     uint32_t i;
-    rtems_libio_t *iop;
-
-    if (rtems_libio_number_iops > 0)
-    {
-        iop = rtems_libio_iop_free_head = &rtems_libio_iops[0];
-        for (i = 0 ; (i + 1) < rtems_libio_number_iops ; i++, iop++)
-          iop->data1 = iop + 1;
-        iop->data1 = NULL;
-        rtems_libio_iop_free_tail = &iop->data1;
+
+    for (i = 0 ; i <= rtems_libio_iop_free_ring_mask ; i++)
+      _Atomic_Init_uint(&rtems_libio_iop_free_ring[i].sequence, i);
+
+    for (i = 0 ; i < rtems_libio_number_iops ; i++) {
+      rtems_libio_iop_free_ring[i].iop = &rtems_libio_iops[i];
+      _Atomic_Init_uint(&rtems_libio_iop_free_ring[i].sequence, i + 1);
     }
+
+    _Atomic_Init_uint(&rtems_libio_iop_free_enqueue, rtems_libio_number_iops);
+    _Atomic_Init_uint(&rtems_libio_iop_free_dequeue, 0);
 }
 
 RTEMS_SYSINIT_ITEM(
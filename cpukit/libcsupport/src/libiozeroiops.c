@@ -5,9 +5,9 @@
  *
  * @ingroup LibIOInternal
  *
- * @brief This source file provides rtems_libio_iops and
- *   rtems_libio_number_iops for a zero file descriptor application
- *   configuration.
+ * @brief This source file provides rtems_libio_iops,
+ *   rtems_libio_number_iops, and the ring of free iops for a zero file
+ *   descriptor application configuration.
  */
 
 /*
@@ -44,3 +44,7 @@
 rtems_libio_t rtems_libio_iops[ 0 ];
 
 const uint32_t rtems_libio_number_iops = 0;
+
+rtems_libio_iop_free_cell rtems_libio_iop_free_ring[ 1 ];
+
+const uint32_t rtems_libio_iop_free_ring_mask = 0;
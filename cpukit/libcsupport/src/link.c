@@ -50,6 +50,7 @@ int link( const char *path1, const char *path2 )
       rtems_filesystem_eval_path_get_token( &ctx_2 ),
       rtems_filesystem_eval_path_get_tokenlen( &ctx_2 )
     );
+    rtems_filesystem_eval_path_cache_flush( currentloc_2->mt_entry );
   }
 
   rtems_filesystem_eval_path_cleanup( &ctx_1 );
@@ -56,14 +56,18 @@ static rtems_filesystem_mount_table_entry_t *alloc_mount_table_entry(
   size_t target_size = strlen( target ) + 1;
   size_t size = sizeof( rtems_filesystem_mount_table_entry_t )
     + filesystemtype_size + source_size + target_size
-    + sizeof( rtems_filesystem_global_location_t );
+    + sizeof( rtems_filesystem_global_location_t )
+    + sizeof( rtems_filesystem_eval_path_cache );
   rtems_filesystem_mount_table_entry_t *mt_entry = calloc( 1, size );
 
   if ( mt_entry != NULL ) {
     rtems_filesystem_global_location_t *mt_fs_root =
       (rtems_filesystem_global_location_t *)
         ((char *) mt_entry + sizeof( *mt_entry ));
-    char *str = (char *) mt_fs_root + sizeof( *mt_fs_root );
+    rtems_filesystem_eval_path_cache *eval_path_cache =
+      (rtems_filesystem_eval_path_cache *)
+        ((char *) mt_fs_root + sizeof( *mt_fs_root ));
+    char *str = (char *) eval_path_cache + sizeof( *eval_path_cache );
 
     memcpy( str, filesystemtype, filesystemtype_size );
     mt_entry->type = str;
@@ -80,6 +84,7 @@ static rtems_filesystem_mount_table_entry_t *alloc_mount_table_entry(
 
     mt_entry->mounted = true;
     mt_entry->mt_fs_root = mt_fs_root;
+    mt_entry->eval_path_cache = eval_path_cache;
     mt_entry->pathconf_limits_and_options = &rtems_filesystem_default_pathconf;
 
     mt_fs_root->location.mt_entry = mt_entry;
@@ -118,6 +123,9 @@ static int register_subordinate_file_system(
     mt_point_node = rtems_filesystem_location_transform_to_global( &targetloc );
     mt_entry->mt_point_node = mt_point_node;
     rv = (*mt_point_node->location.mt_entry->ops->mount_h)( mt_entry );
+    rtems_filesystem_eval_path_cache_flush(
+      mt_point_node->location.mt_entry
+    );
     if ( rv == 0 ) {
       rtems_filesystem_mt_lock();
       rtems_chain_append_unprotected(
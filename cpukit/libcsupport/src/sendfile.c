@@ -0,0 +1,81 @@
+/**
+ *  @file
+ *
+ *  @brief Transfer Data Between File Descriptors
+ *  @ingroup libcsupport
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/libio_.h>
+
+static ssize_t sendfile_to(
+  int            out_fd,
+  rtems_libio_t *in_iop,
+  off_t         *offset,
+  size_t         count
+)
+{
+  rtems_libio_t              *out_iop;
+  rtems_filesystem_sendfile_t sendfile_h;
+  off_t                       saved_offset = 0;
+  ssize_t                     n;
+
+  LIBIO_GET_IOP_WITH_ACCESS( out_fd, out_iop, LIBIO_FLAGS_WRITE, EBADF );
+
+  if ( offset != NULL ) {
+    saved_offset = in_iop->offset;
+    in_iop->offset = *offset;
+  }
+
+  /* Handler tables which predate sendfile_h leave it zero-initialized */
+  sendfile_h = in_iop->pathinfo.handlers->sendfile_h;
+
+  if ( sendfile_h == NULL ) {
+    sendfile_h = rtems_filesystem_default_sendfile;
+  }
+
+  n = ( *sendfile_h )( in_iop, out_iop, count );
+
+  if ( offset != NULL ) {
+    if ( n >= 0 ) {
+      *offset = in_iop->offset;
+    }
+
+    in_iop->offset = saved_offset;
+  }
+
+  rtems_libio_iop_drop( out_iop );
+  return n;
+}
+
+ssize_t rtems_sendfile( int out_fd, int in_fd, off_t *offset, size_t count )
+{
+  rtems_libio_t *in_iop;
+  ssize_t        n;
+
+  if ( offset != NULL && *offset < 0 ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  if ( count > SSIZE_MAX ) {
+    count = SSIZE_MAX;
+  }
+
+  rtems_libio_check_count( count );
+
+  LIBIO_GET_IOP_WITH_ACCESS( in_fd, in_iop, LIBIO_FLAGS_READ, EBADF );
+  n = sendfile_to( out_fd, in_iop, offset, count );
+  rtems_libio_iop_drop( in_iop );
+  return n;
+}
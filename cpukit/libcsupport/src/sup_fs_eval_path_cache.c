@@ -0,0 +1,142 @@
+/**
+ *  @file
+ *
+ *  @brief RTEMS File System Path Component Cache
+ *  @ingroup LibIOInternal
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/libio_.h>
+
+#include <string.h>
+
+static rtems_filesystem_eval_path_cache_entry *get_cache_entry(
+  rtems_filesystem_eval_path_cache *cache,
+  const rtems_filesystem_eval_path_cache_location *dir,
+  const char *name,
+  size_t namelen
+)
+{
+  uint32_t hash = 2166136261U;
+  size_t i;
+
+  for ( i = 0; i < sizeof( dir->bytes ); ++i ) {
+    hash = ( hash ^ dir->bytes[ i ] ) * 16777619U;
+  }
+
+  for ( i = 0; i < namelen; ++i ) {
+    hash = ( hash ^ (uint8_t) name[ i ] ) * 16777619U;
+  }
+
+  hash ^= hash >> 16;
+
+  return &cache->entries[
+    hash & ( RTEMS_FILESYSTEM_EVAL_PATH_CACHE_SIZE - 1 )
+  ];
+}
+
+bool rtems_filesystem_eval_path_cache_lookup(
+  const rtems_filesystem_mount_table_entry_t *mt_entry,
+  const rtems_filesystem_eval_path_cache_location *dir,
+  const char *name,
+  size_t namelen,
+  rtems_filesystem_eval_path_cache_location *entry,
+  bool *exists
+)
+{
+  rtems_filesystem_eval_path_cache *cache = mt_entry->eval_path_cache;
+  const rtems_filesystem_eval_path_cache_entry *cache_entry;
+
+  if (
+    cache == NULL
+      || namelen == 0
+      || namelen > RTEMS_FILESYSTEM_EVAL_PATH_CACHE_NAME_MAX
+  ) {
+    return false;
+  }
+
+  cache_entry = get_cache_entry( cache, dir, name, namelen );
+
+  if (
+    cache_entry->generation == cache->generation
+      && cache_entry->namelen == namelen
+      && memcmp( &cache_entry->dir, dir, sizeof( *dir ) ) == 0
+      && memcmp( cache_entry->name, name, namelen ) == 0
+  ) {
+    *exists = cache_entry->exists;
+
+    if ( cache_entry->exists ) {
+      *entry = cache_entry->entry;
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+void rtems_filesystem_eval_path_cache_enter(
+  rtems_filesystem_mount_table_entry_t *mt_entry,
+  const rtems_filesystem_eval_path_cache_location *dir,
+  const char *name,
+  size_t namelen,
+  const rtems_filesystem_eval_path_cache_location *entry
+)
+{
+  rtems_filesystem_eval_path_cache *cache = mt_entry->eval_path_cache;
+  rtems_filesystem_eval_path_cache_entry *cache_entry;
+
+  if (
+    cache == NULL
+      || namelen == 0
+      || namelen > RTEMS_FILESYSTEM_EVAL_PATH_CACHE_NAME_MAX
+  ) {
+    return;
+  }
+
+  cache_entry = get_cache_entry( cache, dir, name, namelen );
+  cache_entry->dir = *dir;
+  cache_entry->generation = cache->generation;
+  cache_entry->namelen = (uint8_t) namelen;
+  memcpy( cache_entry->name, name, namelen );
+
+  if ( entry != NULL ) {
+    cache_entry->entry = *entry;
+    cache_entry->exists = true;
+  } else {
+    memset( &cache_entry->entry, 0, sizeof( cache_entry->entry ) );
+    cache_entry->exists = false;
+  }
+}
+
+void rtems_filesystem_eval_path_cache_flush(
+  rtems_filesystem_mount_table_entry_t *mt_entry
+)
+{
+  rtems_filesystem_eval_path_cache *cache = mt_entry->eval_path_cache;
+
+  if ( cache == NULL ) {
+    return;
+  }
+
+  ++cache->generation;
+
+  /*
+   * After a wrap around of the generation, entries of a previous round could
+   * be valid again.
+   */
+  if ( cache->generation == 0 ) {
+    memset( cache->entries, 0, sizeof( cache->entries ) );
+  }
+}
@@ -46,6 +46,40 @@ static bool is_eval_path_root(
     && (*mt_entry->ops->are_nodes_equal_h)( loc, rootloc );
 }
 
+static rtems_filesystem_eval_path_generic_status eval_token(
+  rtems_filesystem_eval_path_context_t *ctx,
+  void *arg,
+  const rtems_filesystem_eval_path_generic_config *config,
+  const char *token,
+  size_t tokenlen
+)
+{
+  if (config->eval_entry != NULL) {
+    const rtems_filesystem_location_info_t *currentloc =
+      rtems_filesystem_eval_path_get_currentloc( ctx );
+    rtems_filesystem_eval_path_cache_location dir;
+    rtems_filesystem_eval_path_cache_location entry;
+    bool exists;
+    bool hit;
+
+    (*config->get_key)(ctx, arg, &dir);
+    hit = rtems_filesystem_eval_path_cache_lookup(
+      currentloc->mt_entry,
+      &dir,
+      token,
+      tokenlen,
+      &entry,
+      &exists
+    );
+
+    if (hit) {
+      return (*config->eval_entry)(ctx, arg, exists ? &entry : NULL);
+    }
+  }
+
+  return (*config->eval_token)(ctx, arg, token, tokenlen);
+}
+
 void rtems_filesystem_eval_path_generic(
   rtems_filesystem_eval_path_context_t *ctx,
   void *arg,
@@ -99,7 +133,7 @@ void rtems_filesystem_eval_path_generic(
             status = (*config->eval_token)(ctx, arg, "..", 2);
           }
         } else {
-          status = (*config->eval_token)(ctx, arg, token, tokenlen);
+          status = eval_token(ctx, arg, config, token, tokenlen);
         }
 
         if (status == RTEMS_FILESYSTEM_EVAL_PATH_GENERIC_NO_ENTRY) {
@@ -34,6 +34,7 @@
 #include <sys/fcntl.h>
 #include <sys/filio.h>
 #include <sys/ttycom.h>
+#include <sys/uio.h>
 
 #include <rtems/termiostypes.h>
 
@@ -1144,6 +1145,30 @@ oproc (unsigned char c, rtems_termios_tty *tty, bool wait)
   return doTransmit (buf, len, tty, wait, true) > 0;
 }
 
+/*
+ * Returns the count of leading characters which oproc() would transmit
+ * unchanged, so that they can be passed to the device in one block.
+ */
+static size_t
+oprocPassThroughRun (const char *buf, size_t len, const rtems_termios_tty *tty)
+{
+  size_t i;
+
+  if (tty->termios.c_oflag & OLCUC) {
+    return 0;
+  }
+
+  for (i = 0; i < len; ++i) {
+    char c = buf[i];
+
+    if (c == '\n' || c == '\r' || c == '\t' || c == '\b') {
+      break;
+    }
+  }
+
+  return i;
+}
+
 static uint32_t
 rtems_termios_write_tty (rtems_libio_t *iop, rtems_termios_tty *tty,
                          const char *buf, uint32_t len)
@@ -1154,6 +1179,32 @@ rtems_termios_write_tty (rtems_libio_t *iop, rtems_termios_tty *tty,
     uint32_t todo = len;
 
     while (todo > 0) {
+      size_t run;
+
+      run = oprocPassThroughRun (buf, todo, tty);
+
+      if (run > 0) {
+        size_t sent;
+        size_t i;
+
+        sent = doTransmit (buf, run, tty, wait, false);
+
+        for (i = 0; i < sent; ++i) {
+          if (!iscntrl((unsigned char) buf[i]))
+            ++tty->column;
+        }
+
+        buf += sent;
+        todo -= sent;
+        wait = false;
+
+        if (sent != run) {
+          break;
+        }
+
+        continue;
+      }
+
       if (!oproc (*buf, tty, wait)) {
         break;
       }
@@ -1492,6 +1543,34 @@ fillBufferPoll (struct rtems_termios_tty *tty)
   return RTEMS_TERMIOS_IPROC_CONTINUE;
 }
 
+/*
+ * Restart the incoming data stream if the raw input queue drained below the
+ * low water mark.  The device lock must be held by the caller.
+ */
+static void
+checkLowwater (struct rtems_termios_tty *tty)
+{
+  if(((tty->rawInBuf.Tail - tty->rawInBuf.Head) % tty->rawInBuf.Size)
+     < tty->lowwater) {
+    tty->flow_ctrl &= ~FL_IREQXOF;
+    /* if tx stopped and XON should be sent... */
+    if (((tty->flow_ctrl & (FL_MDXON | FL_ISNTXOF))
+         ==                (FL_MDXON | FL_ISNTXOF))
+        && ((tty->rawOutBufState == rob_idle)
+      || (tty->flow_ctrl & FL_OSTOP))) {
+      /* XON should be sent now... */
+      (*tty->handler.write)(
+        tty->device_context, (void *)&(tty->termios.c_cc[VSTART]), 1);
+    } else if (tty->flow_ctrl & FL_MDRTS) {
+      tty->flow_ctrl &= ~FL_IRTSOFF;
+      /* activate RTS line */
+      if (tty->flow.start_remote_tx != NULL) {
+        tty->flow.start_remote_tx(tty->device_context);
+      }
+    }
+  }
+}
+
 /*
  * Fill the input buffer from the raw input queue
  */
@@ -1520,26 +1599,7 @@ fillBufferQueue (struct rtems_termios_tty *tty)
       newHead = (tty->rawInBuf.Head + 1) % tty->rawInBuf.Size;
       c = tty->rawInBuf.theBuf[newHead];
       tty->rawInBuf.Head = newHead;
-
-      if(((tty->rawInBuf.Tail - newHead) % tty->rawInBuf.Size)
-         < tty->lowwater) {
-        tty->flow_ctrl &= ~FL_IREQXOF;
-        /* if tx stopped and XON should be sent... */
-        if (((tty->flow_ctrl & (FL_MDXON | FL_ISNTXOF))
-             ==                (FL_MDXON | FL_ISNTXOF))
-            && ((tty->rawOutBufState == rob_idle)
-          || (tty->flow_ctrl & FL_OSTOP))) {
-          /* XON should be sent now... */
-          (*tty->handler.write)(
-            tty->device_context, (void *)&(tty->termios.c_cc[VSTART]), 1);
-        } else if (tty->flow_ctrl & FL_MDRTS) {
-          tty->flow_ctrl &= ~FL_IRTSOFF;
-          /* activate RTS line */
-          if (tty->flow.start_remote_tx != NULL) {
-            tty->flow.start_remote_tx(tty->device_context);
-          }
-        }
-      }
+      checkLowwater (tty);
 
       rtems_termios_device_lock_release (ctx, &lock_context);
 
@@ -1594,25 +1654,143 @@ fillBufferQueue (struct rtems_termios_tty *tty)
   return RTEMS_TERMIOS_IPROC_CONTINUE;
 }
 
+/*
+ * Returns true, if the input processing of fillBufferQueue() would only copy
+ * the characters of the raw input queue to the cooked buffer.  The early input
+ * processing is already done by rtems_termios_enqueue_raw_characters().
+ */
+static bool
+isRawQueueRead (const struct rtems_termios_tty *tty)
+{
+  return (tty->termios.c_lflag & (ICANON | ISIG | ECHO)) == 0;
+}
+
+/*
+ * Move the characters of the raw input queue directly to the caller buffers
+ * in contiguous segments.  This follows the non-canonical VMIN and VTIME
+ * rules of fillBufferQueue().
+ */
+static size_t
+readRawQueue (
+  struct rtems_termios_tty *tty,
+  const struct iovec       *iov,
+  int                       iovcnt
+)
+{
+  rtems_termios_device_context *ctx = tty->device_context;
+  rtems_interval timeout = tty->rawInBufSemaphoreFirstTimeout;
+  size_t done = 0;
+  size_t offset = 0;
+  int v = 0;
+
+  while (v < iovcnt) {
+    rtems_interrupt_lock_context lock_context;
+    unsigned int head;
+    unsigned int tail;
+    bool wait = true;
+
+    rtems_termios_device_lock_acquire (ctx, &lock_context);
+    head = tty->rawInBuf.Head;
+    tail = tty->rawInBuf.Tail;
+    rtems_termios_device_lock_release (ctx, &lock_context);
+
+    /*
+     * The characters from Head to Tail belong to the reader, so they can be
+     * copied with interrupts enabled.
+     */
+    while (head != tail && v < iovcnt) {
+      unsigned int first;
+      size_t n;
+
+      if (offset == iov[v].iov_len) {
+        offset = 0;
+        ++v;
+        continue;
+      }
+
+      first = (head + 1) % tty->rawInBuf.Size;
+
+      if (tail >= first) {
+        n = tail - first + 1;
+      } else {
+        n = tty->rawInBuf.Size - first;
+      }
+
+      if (n > iov[v].iov_len - offset) {
+        n = iov[v].iov_len - offset;
+      }
+
+      memcpy ((char *) iov[v].iov_base + offset, &tty->rawInBuf.theBuf[first],
+              n);
+      offset += n;
+      done += n;
+
+      rtems_termios_device_lock_acquire (ctx, &lock_context);
+
+      /* A concurrent flush of the input queue discards the snapshot */
+      if (tty->rawInBuf.Head == head) {
+        head = first + (unsigned int) n - 1;
+        tty->rawInBuf.Head = head;
+        checkLowwater (tty);
+      } else {
+        head = tail;
+      }
+
+      rtems_termios_device_lock_release (ctx, &lock_context);
+
+      timeout = tty->rawInBufSemaphoreTimeout;
+
+      if (done >= tty->termios.c_cc[VMIN]) {
+        wait = false;
+      }
+    }
+
+    while (v < iovcnt && offset == iov[v].iov_len) {
+      offset = 0;
+      ++v;
+    }
+
+    if (!wait || v == iovcnt) {
+      break;
+    }
+
+    if (tty->rawInBufSemaphoreWait) {
+      if (rtems_binary_semaphore_wait_timed_ticks (&tty->rawInBuf.Semaphore,
+                                                   timeout) != 0) {
+        break;
+      }
+    } else {
+      if (rtems_binary_semaphore_try_wait (&tty->rawInBuf.Semaphore) != 0) {
+        break;
+      }
+    }
+  }
+
+  return done;
+}
+
 static rtems_status_code
-rtems_termios_read_tty (
+rtems_termios_read_tty_vector (
   struct rtems_termios_tty *tty,
-  char                     *buffer,
-  uint32_t                  initial_count,
+  const struct iovec       *iov,
+  int                       iovcnt,
   uint32_t                 *count_read
 )
 {
   uint32_t                         count;
   rtems_termios_iproc_status_code  rc;
-
-  count = initial_count;
+  int                              v;
 
   if (tty->cindex == tty->ccount) {
     tty->cindex = tty->ccount = 0;
     tty->read_start_column = tty->column;
     if (tty->handler.poll_read != NULL && tty->handler.mode == TERMIOS_POLLED)
       rc = fillBufferPoll (tty);
-    else
+    else if (isRawQueueRead (tty)) {
+      *count_read = (uint32_t) readRawQueue (tty, iov, iovcnt);
+      tty->tty_rcvwakeup = false;
+      return RTEMS_SUCCESSFUL;
+    } else
       rc = fillBufferQueue (tty);
   } else {
     rc = RTEMS_TERMIOS_IPROC_CONTINUE;
@@ -1621,12 +1799,19 @@ rtems_termios_read_tty (
   /*
    * If there are characters in the buffer, then copy them to the caller.
    */
-  while (count && (tty->cindex < tty->ccount)) {
-    *buffer++ = tty->cbuf[tty->cindex++];
-    count--;
-   }
+  count = 0;
+  for (v = 0; v < iovcnt && tty->cindex < tty->ccount; ++v) {
+    size_t n = (size_t) (tty->ccount - tty->cindex);
+
+    if (n > iov[v].iov_len)
+      n = iov[v].iov_len;
+
+    memcpy (iov[v].iov_base, &tty->cbuf[tty->cindex], n);
+    tty->cindex += (int) n;
+    count += (uint32_t) n;
+  }
   tty->tty_rcvwakeup = false;
-  *count_read = initial_count - count;
+  *count_read = count;
 
   /*
    * fillBufferPoll and fillBufferQueue can indicate that the operation
@@ -1640,6 +1825,22 @@ rtems_termios_read_tty (
   return RTEMS_SUCCESSFUL;
 }
 
+static rtems_status_code
+rtems_termios_read_tty (
+  struct rtems_termios_tty *tty,
+  char                     *buffer,
+  uint32_t                  initial_count,
+  uint32_t                 *count_read
+)
+{
+  struct iovec iov;
+
+  iov.iov_base = buffer;
+  iov.iov_len = initial_count;
+
+  return rtems_termios_read_tty_vector (tty, &iov, 1, count_read);
+}
+
 rtems_status_code
 rtems_termios_read (void *arg)
 {
@@ -1694,6 +1895,136 @@ mustCallReceiveCallback (const rtems_termios_tty *tty, unsigned char c,
   }
 }
 
+/*
+ * Stop the incoming data stream if the raw input queue would exceed the high
+ * water mark.  The device lock must be held by the caller.
+ */
+static void
+checkHighwater (struct rtems_termios_tty *tty, unsigned int newTail,
+                unsigned int head)
+{
+  rtems_termios_device_context *ctx = tty->device_context;
+
+  /* if chars_in_buffer > highwater                */
+  if ((tty->flow_ctrl & FL_IREQXOF) != 0 && (((newTail - head) %
+      tty->rawInBuf.Size) > tty->highwater)) {
+    /* incoming data stream should be stopped */
+    tty->flow_ctrl |= FL_IREQXOF;
+    if ((tty->flow_ctrl & (FL_MDXOF | FL_ISNTXOF))
+        ==                (FL_MDXOF             ) ) {
+      if ((tty->flow_ctrl & FL_OSTOP) ||
+          (tty->rawOutBufState == rob_idle)) {
+        /* if tx is stopped due to XOFF or out of data */
+        /*    call write function here                 */
+        tty->flow_ctrl |= FL_ISNTXOF;
+        (*tty->handler.write)(ctx,
+            (void *)&(tty->termios.c_cc[VSTOP]), 1);
+      }
+    } else if ((tty->flow_ctrl & (FL_MDRTS | FL_IRTSOFF)) == (FL_MDRTS) ) {
+      tty->flow_ctrl |= FL_IRTSOFF;
+      /* deactivate RTS line */
+      if (tty->flow.stop_remote_tx != NULL) {
+        tty->flow.stop_remote_tx(ctx);
+      }
+    }
+  }
+}
+
+/*
+ * Returns true, if received characters need no per character processing, so
+ * that they can be placed on the raw queue in blocks.
+ */
+static bool
+isRawBlockInput (const struct rtems_termios_tty *tty)
+{
+  if ((tty->flow_ctrl & FL_MDXON) != 0) {
+    return false;
+  }
+
+  if ((tty->termios.c_iflag & (ISTRIP | IUCLC | ICRNL | INLCR | IGNCR)) != 0) {
+    return false;
+  }
+
+  /*
+   * In canonical mode, the receive callback depends on the line delimiters.
+   */
+  return tty->tty_rcv.sw_pfn == NULL || (tty->termios.c_lflag & ICANON) == 0;
+}
+
+/*
+ * Place a block of characters on the raw queue.  The characters are copied in
+ * at most two contiguous segments.  Returns the number of characters dropped
+ * because of overflow.
+ */
+static int
+enqueueRawBlock (struct rtems_termios_tty *tty, const char *buf, int len)
+{
+  rtems_termios_device_context *ctx = tty->device_context;
+  rtems_interrupt_lock_context lock_context;
+  unsigned int size = tty->rawInBuf.Size;
+  unsigned int head;
+  unsigned int tail;
+  unsigned int avail;
+  unsigned int todo;
+  int dropped;
+  bool callReciveCallback;
+
+  rtems_termios_device_lock_acquire (ctx, &lock_context);
+
+  head = tty->rawInBuf.Head;
+  tail = tty->rawInBuf.Tail;
+
+  if (tail >= head) {
+    avail = size - 1 - (tail - head);
+  } else {
+    avail = head - tail - 1;
+  }
+
+  todo = (unsigned int) len;
+  if (todo > avail) {
+    todo = avail;
+  }
+
+  dropped = len - (int) todo;
+
+  while (todo > 0) {
+    unsigned int first = (tail + 1) % size;
+    unsigned int n = size - first;
+
+    if (n > todo) {
+      n = todo;
+    }
+
+    memcpy (&tty->rawInBuf.theBuf[first], buf, n);
+    tail = first + n - 1;
+    buf += n;
+    todo -= n;
+  }
+
+  checkHighwater (tty, tail, head);
+  tty->rawInBuf.Tail = tail;
+
+  callReciveCallback = false;
+
+  /*
+   * check to see if rcv wakeup callback was set
+   */
+  if (tty->tty_rcv.sw_pfn != NULL && !tty->tty_rcvwakeup) {
+    if (dropped > 0 || mustCallReceiveCallback (tty, 0, tail, head)) {
+      tty->tty_rcvwakeup = true;
+      callReciveCallback = true;
+    }
+  }
+
+  rtems_termios_device_lock_release (ctx, &lock_context);
+
+  if (callReciveCallback) {
+    (*tty->tty_rcv.sw_pfn)(&tty->termios, tty->tty_rcv.sw_arg);
+  }
+
+  return dropped;
+}
+
 /*
  * Place characters on raw queue.
  * NOTE: This routine runs in the context of the
@@ -1726,6 +2057,13 @@ rtems_termios_enqueue_raw_characters (void *ttyp, const char *buf, int len)
     return 0;
   }
 
+  if (isRawBlockInput (tty)) {
+    dropped = enqueueRawBlock (tty, buf, len);
+    tty->rawInBufDropped += dropped;
+    rtems_binary_semaphore_post (&tty->rawInBuf.Semaphore);
+    return dropped;
+  }
+
   while (len--) {
     c = *buf++;
     /* FIXME: implement IXANY: any character restarts output */
@@ -1785,29 +2123,7 @@ rtems_termios_enqueue_raw_characters (void *ttyp, const char *buf, int len)
       oldTail = tty->rawInBuf.Tail;
       newTail = (oldTail + 1) % tty->rawInBuf.Size;
 
-      /* if chars_in_buffer > highwater                */
-      if ((tty->flow_ctrl & FL_IREQXOF) != 0 && (((newTail - head) %
-          tty->rawInBuf.Size) > tty->highwater)) {
-        /* incoming data stream should be stopped */
-        tty->flow_ctrl |= FL_IREQXOF;
-        if ((tty->flow_ctrl & (FL_MDXOF | FL_ISNTXOF))
-            ==                (FL_MDXOF             ) ) {
-          if ((tty->flow_ctrl & FL_OSTOP) ||
-              (tty->rawOutBufState == rob_idle)) {
-            /* if tx is stopped due to XOFF or out of data */
-            /*    call write function here                 */
-            tty->flow_ctrl |= FL_ISNTXOF;
-            (*tty->handler.write)(ctx,
-                (void *)&(tty->termios.c_cc[VSTOP]), 1);
-          }
-        } else if ((tty->flow_ctrl & (FL_MDRTS | FL_IRTSOFF)) == (FL_MDRTS) ) {
-          tty->flow_ctrl |= FL_IRTSOFF;
-          /* deactivate RTS line */
-          if (tty->flow.stop_remote_tx != NULL) {
-            tty->flow.stop_remote_tx(ctx);
-          }
-        }
-      }
+      checkHighwater (tty, newTail, head);
 
       callReciveCallback = false;
 
@@ -2195,6 +2511,80 @@ rtems_termios_imfs_write (rtems_libio_t *iop, const void *buffer, size_t count)
   return (ssize_t) bytes_moved;
 }
 
+static ssize_t
+rtems_termios_imfs_readv (
+  rtems_libio_t      *iop,
+  const struct iovec *iov,
+  int                 iovcnt,
+  ssize_t             total
+)
+{
+  struct rtems_termios_tty *tty;
+  uint32_t                  bytes_moved;
+  rtems_status_code         sc;
+
+  tty = iop->data1;
+
+  rtems_mutex_lock (&tty->isem);
+
+  if (rtems_termios_linesw[tty->t_line].l_read != NULL) {
+    rtems_mutex_unlock (&tty->isem);
+    return rtems_filesystem_default_readv (iop, iov, iovcnt, total);
+  }
+
+  sc = rtems_termios_read_tty_vector (tty, iov, iovcnt, &bytes_moved);
+  rtems_mutex_unlock (&tty->isem);
+  if (sc != RTEMS_SUCCESSFUL) {
+     return rtems_status_code_to_errno (sc);
+  }
+  return (ssize_t) bytes_moved;
+}
+
+/*
+ * The output semaphore is held for the complete IO vector, so the buffers
+ * appear contiguous on the line.
+ */
+static ssize_t
+rtems_termios_imfs_writev (
+  rtems_libio_t      *iop,
+  const struct iovec *iov,
+  int                 iovcnt,
+  ssize_t             total
+)
+{
+  struct rtems_termios_tty *tty;
+  int                       v;
+
+  tty = iop->data1;
+
+  rtems_mutex_lock (&tty->osem);
+
+  if (rtems_termios_linesw[tty->t_line].l_write != NULL) {
+    rtems_mutex_unlock (&tty->osem);
+    return rtems_filesystem_default_writev (iop, iov, iovcnt, total);
+  }
+
+  total = 0;
+
+  for (v = 0; v < iovcnt; ++v) {
+    uint32_t len = (uint32_t) iov[v].iov_len;
+
+    if (len > 0) {
+      uint32_t bytes_moved;
+
+      bytes_moved = rtems_termios_write_tty (iop, tty, iov[v].iov_base, len);
+      total += (ssize_t) bytes_moved;
+
+      if (bytes_moved != len) {
+        break;
+      }
+    }
+  }
+
+  rtems_mutex_unlock (&tty->osem);
+  return total;
+}
+
 static int
 rtems_termios_imfs_ioctl (rtems_libio_t *iop, ioctl_command_t request,
   void *buffer)
@@ -2230,8 +2620,9 @@ static const rtems_filesystem_file_handlers_r rtems_termios_imfs_handler = {
   .kqfilter_h = rtems_termios_kqfilter,
   .mmap_h = rtems_termios_mmap,
   .poll_h = rtems_termios_poll,
-  .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .readv_h = rtems_termios_imfs_readv,
+  .writev_h = rtems_termios_imfs_writev,
+  .sendfile_h = rtems_filesystem_default_sendfile
 };
 
 static IMFS_jnode_t *
@@ -0,0 +1,114 @@
+/**
+ * @file
+ *
+ * @brief Default Sendfile Handler
+ *
+ * @ingroup LibIOFSHandler
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/libio_.h>
+
+#include <sys/stat.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SENDFILE_BUFFER_SIZE ( 32 * 1024 )
+
+ssize_t rtems_filesystem_default_sendfile(
+  rtems_libio_t *iop,
+  rtems_libio_t *out_iop,
+  size_t         count
+)
+{
+  char        *buffer;
+  size_t       size;
+  ssize_t      total;
+  struct stat  st;
+  bool         seekable;
+
+  if ( count == 0 ) {
+    return 0;
+  }
+
+  /*
+   * Characters read from a pipe or a terminal cannot be given back, see
+   * below.
+   */
+  memset( &st, 0, sizeof( st ) );
+  seekable = ( *iop->pathinfo.handlers->fstat_h )( &iop->pathinfo, &st ) == 0
+    && ( S_ISREG( st.st_mode ) || S_ISBLK( st.st_mode ) );
+
+  size = count < SENDFILE_BUFFER_SIZE ? count : SENDFILE_BUFFER_SIZE;
+  buffer = malloc( size );
+  if ( buffer == NULL ) {
+    rtems_set_errno_and_return_minus_one( ENOMEM );
+  }
+
+  total = 0;
+
+  while ( count > 0 ) {
+    size_t  chunk = count < size ? count : size;
+    ssize_t in;
+    ssize_t done;
+
+    in = ( *iop->pathinfo.handlers->read_h )( iop, buffer, chunk );
+    if ( in <= 0 ) {
+      if ( in < 0 && total == 0 ) {
+        total = -1;
+      }
+
+      break;
+    }
+
+    done = 0;
+
+    while ( done < in ) {
+      ssize_t out = ( *out_iop->pathinfo.handlers->write_h )(
+        out_iop,
+        &buffer[ done ],
+        (size_t) ( in - done )
+      );
+
+      if ( out <= 0 ) {
+        break;
+      }
+
+      done += out;
+    }
+
+    total += done;
+    count -= (size_t) done;
+
+    if ( done != in ) {
+      /*
+       * Give back the characters which were read but not written.  For
+       * sources which cannot seek, for example pipes and terminals, these
+       * characters are lost.
+       */
+      if ( seekable ) {
+        iop->offset -= in - done;
+      }
+
+      if ( total == 0 ) {
+        total = -1;
+      }
+
+      break;
+    }
+  }
+
+  free( buffer );
+  return total;
+}
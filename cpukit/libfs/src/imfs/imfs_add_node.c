@@ -90,6 +90,7 @@ int IMFS_add_node( const char *path, IMFS_jnode_t *node, void *arg )
         parent = currentloc->node_access;
         IMFS_assert( parent != NULL );
         IMFS_add_to_directory( parent, node );
+        rtems_filesystem_eval_path_cache_flush( currentloc->mt_entry );
         IMFS_mtime_ctime_update( parent );
         rv = 0;
       } else {
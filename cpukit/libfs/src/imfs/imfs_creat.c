@@ -62,6 +62,7 @@ IMFS_jnode_t *IMFS_create_node(
      */
     IMFS_assert( parent != NULL );
     IMFS_add_to_directory( parent, node );
+    rtems_filesystem_eval_path_cache_flush( parentloc->mt_entry );
   } else {
     free( allocated_node );
   }
@@ -35,7 +35,8 @@ static const rtems_filesystem_file_handlers_r IMFS_dir_minimal_handlers = {
   .mmap_h = rtems_filesystem_default_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_filesystem_default_writev,
+  .sendfile_h = rtems_filesystem_default_sendfile
 };
 
 const IMFS_mknod_control IMFS_mknod_control_dir_minimal = {
@@ -89,77 +89,155 @@ static rtems_filesystem_global_location_t **IMFS_is_mount_point(
   return fs_root_ptr;
 }
 
-static rtems_filesystem_eval_path_generic_status IMFS_eval_token(
+static rtems_filesystem_eval_path_generic_status IMFS_eval_entry(
   rtems_filesystem_eval_path_context_t *ctx,
-  void *arg,
-  const char *token,
-  size_t tokenlen
+  IMFS_directory_t *dir,
+  IMFS_jnode_t *entry
 )
 {
   rtems_filesystem_eval_path_generic_status status =
     RTEMS_FILESYSTEM_EVAL_PATH_GENERIC_DONE;
   rtems_filesystem_location_info_t *currentloc =
     rtems_filesystem_eval_path_get_currentloc( ctx );
-  IMFS_directory_t *dir = currentloc->node_access;
-  bool access_ok = rtems_filesystem_eval_path_check_access(
+  bool terminal = !rtems_filesystem_eval_path_has_path( ctx );
+  int eval_flags = rtems_filesystem_eval_path_get_flags( ctx );
+  bool follow_hard_link = (eval_flags & RTEMS_FS_FOLLOW_HARD_LINK) != 0;
+  bool follow_sym_link = (eval_flags & RTEMS_FS_FOLLOW_SYM_LINK) != 0;
+  mode_t mode = entry->st_mode;
+
+  rtems_filesystem_eval_path_clear_token( ctx );
+
+  if ( IMFS_is_hard_link( mode ) && ( follow_hard_link || !terminal ) ) {
+    const IMFS_link_t *hard_link = (const IMFS_link_t *) entry;
+
+    entry = hard_link->link_node;
+  }
+
+  if ( S_ISLNK( mode ) && ( follow_sym_link || !terminal ) ) {
+    const IMFS_sym_link_t *sym_link = (const IMFS_sym_link_t *) entry;
+    const char *target = sym_link->name;
+
+    rtems_filesystem_eval_path_recursive( ctx, target, strlen( target ) );
+  } else {
+    rtems_filesystem_global_location_t **fs_root_ptr =
+      IMFS_is_mount_point( entry, mode );
+
+    if ( fs_root_ptr == NULL ) {
+      --dir->Node.reference_count;
+      ++entry->reference_count;
+      currentloc->node_access = entry;
+      currentloc->node_access_2 =
+        IMFS_generic_get_context_by_node( entry );
+      IMFS_Set_handlers( currentloc );
+
+      if ( !terminal ) {
+        status = RTEMS_FILESYSTEM_EVAL_PATH_GENERIC_CONTINUE;
+      }
+    } else {
+      bool access_ok = rtems_filesystem_eval_path_check_access(
+        ctx,
+        RTEMS_FS_PERMS_EXEC,
+        entry->st_mode,
+        entry->st_uid,
+        entry->st_gid
+      );
+      if ( access_ok ) {
+        rtems_filesystem_eval_path_restart( ctx, fs_root_ptr );
+      }
+    }
+  }
+
+  return status;
+}
+
+static bool IMFS_eval_check_search_access(
+  rtems_filesystem_eval_path_context_t *ctx,
+  const IMFS_directory_t *dir
+)
+{
+  return rtems_filesystem_eval_path_check_access(
     ctx,
     RTEMS_FS_PERMS_EXEC,
     dir->Node.st_mode,
     dir->Node.st_uid,
     dir->Node.st_gid
   );
+}
 
-  if ( access_ok ) {
+static void IMFS_eval_set_cache_location(
+  rtems_filesystem_eval_path_cache_location *location,
+  const IMFS_jnode_t *node
+)
+{
+  memset( location, 0, sizeof( *location ) );
+  location->node = RTEMS_DECONST( IMFS_jnode_t *, node );
+}
+
+static rtems_filesystem_eval_path_generic_status IMFS_eval_token(
+  rtems_filesystem_eval_path_context_t *ctx,
+  void *arg,
+  const char *token,
+  size_t tokenlen
+)
+{
+  rtems_filesystem_eval_path_generic_status status =
+    RTEMS_FILESYSTEM_EVAL_PATH_GENERIC_DONE;
+  rtems_filesystem_location_info_t *currentloc =
+    rtems_filesystem_eval_path_get_currentloc( ctx );
+  IMFS_directory_t *dir = currentloc->node_access;
+
+  if ( IMFS_eval_check_search_access( ctx, dir ) ) {
     IMFS_jnode_t *entry = IMFS_search_in_directory( dir, token, tokenlen );
+    rtems_filesystem_eval_path_cache_location dir_location;
+    rtems_filesystem_eval_path_cache_location entry_location;
+
+    IMFS_eval_set_cache_location( &dir_location, &dir->Node );
+    IMFS_eval_set_cache_location( &entry_location, entry );
+    rtems_filesystem_eval_path_cache_enter(
+      currentloc->mt_entry,
+      &dir_location,
+      token,
+      tokenlen,
+      entry != NULL ? &entry_location : NULL
+    );
 
     if ( entry != NULL ) {
-      bool terminal = !rtems_filesystem_eval_path_has_path( ctx );
-      int eval_flags = rtems_filesystem_eval_path_get_flags( ctx );
-      bool follow_hard_link = (eval_flags & RTEMS_FS_FOLLOW_HARD_LINK) != 0;
-      bool follow_sym_link = (eval_flags & RTEMS_FS_FOLLOW_SYM_LINK) != 0;
-      mode_t mode = entry->st_mode;
+      status = IMFS_eval_entry( ctx, dir, entry );
+    } else {
+      status = RTEMS_FILESYSTEM_EVAL_PATH_GENERIC_NO_ENTRY;
+    }
+  }
 
-      rtems_filesystem_eval_path_clear_token( ctx );
+  return status;
+}
+
+static void IMFS_eval_get_key(
+  rtems_filesystem_eval_path_context_t *ctx,
+  void *arg,
+  rtems_filesystem_eval_path_cache_location *dir
+)
+{
+  rtems_filesystem_location_info_t *currentloc =
+    rtems_filesystem_eval_path_get_currentloc( ctx );
 
-      if ( IMFS_is_hard_link( mode ) && ( follow_hard_link || !terminal ) ) {
-        const IMFS_link_t *hard_link = (const IMFS_link_t *) entry;
+  IMFS_eval_set_cache_location( dir, currentloc->node_access );
+}
 
-        entry = hard_link->link_node;
-      }
+static rtems_filesystem_eval_path_generic_status IMFS_eval_cached_entry(
+  rtems_filesystem_eval_path_context_t *ctx,
+  void *arg,
+  const rtems_filesystem_eval_path_cache_location *entry
+)
+{
+  rtems_filesystem_eval_path_generic_status status =
+    RTEMS_FILESYSTEM_EVAL_PATH_GENERIC_DONE;
+  rtems_filesystem_location_info_t *currentloc =
+    rtems_filesystem_eval_path_get_currentloc( ctx );
+  IMFS_directory_t *dir = currentloc->node_access;
 
-      if ( S_ISLNK( mode ) && ( follow_sym_link || !terminal ) ) {
-        const IMFS_sym_link_t *sym_link = (const IMFS_sym_link_t *) entry;
-        const char *target = sym_link->name;
-
-        rtems_filesystem_eval_path_recursive( ctx, target, strlen( target ) );
-      } else {
-        rtems_filesystem_global_location_t **fs_root_ptr =
-          IMFS_is_mount_point( entry, mode );
-
-        if ( fs_root_ptr == NULL ) {
-          --dir->Node.reference_count;
-          ++entry->reference_count;
-          currentloc->node_access = entry;
-          currentloc->node_access_2 =
-            IMFS_generic_get_context_by_node( entry );
-          IMFS_Set_handlers( currentloc );
-
-          if ( !terminal ) {
-            status = RTEMS_FILESYSTEM_EVAL_PATH_GENERIC_CONTINUE;
-          }
-        } else {
-          access_ok = rtems_filesystem_eval_path_check_access(
-            ctx,
-            RTEMS_FS_PERMS_EXEC,
-            entry->st_mode,
-            entry->st_uid,
-            entry->st_gid
-          );
-          if ( access_ok ) {
-            rtems_filesystem_eval_path_restart( ctx, fs_root_ptr );
-          }
-        }
-      }
+  if ( IMFS_eval_check_search_access( ctx, dir ) ) {
+    if ( entry != NULL ) {
+      status = IMFS_eval_entry( ctx, dir, entry->node );
     } else {
       status = RTEMS_FILESYSTEM_EVAL_PATH_GENERIC_NO_ENTRY;
     }
@@ -170,7 +248,9 @@ static rtems_filesystem_eval_path_generic_status IMFS_eval_token(
 
 static const rtems_filesystem_eval_path_generic_config IMFS_eval_config = {
   .is_directory = IMFS_eval_is_directory,
-  .eval_token = IMFS_eval_token
+  .eval_token = IMFS_eval_token,
+  .get_key = IMFS_eval_get_key,
+  .eval_entry = IMFS_eval_cached_entry
 };
 
 void IMFS_eval_path( rtems_filesystem_eval_path_context_t *ctx )
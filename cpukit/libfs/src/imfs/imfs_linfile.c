@@ -42,6 +42,37 @@ static ssize_t IMFS_linfile_read(
   return (ssize_t) count;
 }
 
+static ssize_t IMFS_linfile_sendfile(
+  rtems_libio_t *iop,
+  rtems_libio_t *out_iop,
+  size_t         count
+)
+{
+  IMFS_file_t *file = IMFS_iop_to_file( iop );
+  off_t start = iop->offset;
+  size_t size = file->File.size;
+  const unsigned char *data = file->Linearfile.direct;
+  ssize_t n;
+
+  if (start >= (off_t) size)
+    return 0;
+
+  if (count > size - start)
+    count = size - start;
+
+  IMFS_update_atime( &file->Node );
+
+  /*
+   * The file content is contiguous, so it can be passed directly to the
+   * destination.
+   */
+  n = (*out_iop->pathinfo.handlers->write_h)( out_iop, &data[start], count );
+  if (n > 0)
+    iop->offset = start + n;
+
+  return n;
+}
+
 static int IMFS_linfile_open(
   rtems_libio_t *iop,
   const char    *pathname,
@@ -92,7 +123,8 @@ static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .mmap_h = rtems_filesystem_default_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_filesystem_default_writev,
+  .sendfile_h = IMFS_linfile_sendfile
 };
 
 static IMFS_jnode_t *IMFS_node_initialize_linfile(
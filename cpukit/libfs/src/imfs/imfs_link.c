@@ -97,7 +97,8 @@ static const rtems_filesystem_file_handlers_r IMFS_link_handlers = {
   .mmap_h = rtems_filesystem_default_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_filesystem_default_writev,
+  .sendfile_h = rtems_filesystem_default_sendfile
 };
 
 static IMFS_jnode_t *IMFS_node_initialize_hard_link(
@@ -43,12 +43,32 @@ uint16_t jffs2_compress(struct jffs2_sb_info *c, struct jffs2_inode_info *f,
 {
 	struct super_block *sb = OFNI_BS_2SFFJ(c);
 	rtems_jffs2_compressor_control *cc = sb->s_compressor_control;
+	uint32_t orig_slen = *datalen;
+	uint32_t orig_dlen = *cdatalen;
 	int ret;
 
-	if (cc != NULL) {
+	if (cc != NULL && f->compr_backoff == 0) {
 		*cpage_out = &cc->buffer[0];
 		ret = (*cc->compress)(cc, data_in, *cpage_out, datalen, cdatalen);
+
+		/* Not worth the decompression on each read */
+		if (ret != JFFS2_COMPR_NONE &&
+		    (uint64_t) (*datalen - *cdatalen) * 100 <
+		    (uint64_t) *datalen * sb->s_compressor_min_saving) {
+			ret = JFFS2_COMPR_NONE;
+		}
+
+		if (ret == JFFS2_COMPR_NONE) {
+			/* Store the data as if no compression was tried */
+			*datalen = orig_slen;
+			*cdatalen = orig_dlen;
+			f->compr_backoff = sb->s_compressor_backoff;
+		}
 	} else {
+		if (cc != NULL) {
+			--f->compr_backoff;
+		}
+
 		ret = JFFS2_COMPR_NONE;
 	}
 
@@ -0,0 +1,371 @@
+#include "rtems-jffs2-config.h"
+
+/*
+ * JFFS2 -- Journalling Flash File System, Version 2.
+ *
+ * Copyright © 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * LZO1X-1 compressor and safe decompressor.  The stream format is the one of
+ * the JFFS2_COMPR_LZO nodes written by Linux, so that file systems can be
+ * exchanged.
+ *
+ * For licensing information, see the file 'LICENCE' in this directory.
+ *
+ */
+
+#include <linux/kernel.h>
+#include <linux/types.h>
+#include <linux/errno.h>
+#include <linux/string.h>
+#include <linux/jffs2.h>
+#include "compr.h"
+
+#define M2_MAX_LEN	8
+#define M3_MAX_LEN	33
+#define M4_MAX_LEN	9
+
+#define M2_MAX_OFFSET	0x0800
+#define M3_MAX_OFFSET	0x4000
+#define M4_MAX_OFFSET	0xbfff
+
+#define M3_MARKER	32
+#define M4_MARKER	16
+
+#define D_SIZE		RTEMS_JFFS2_COMPRESSOR_LZO_DICT_SIZE
+#define D_MASK		(D_SIZE - 1)
+
+#define D_BITS		13
+
+RTEMS_STATIC_ASSERT(D_SIZE == (1 << D_BITS), lzo_dict_size);
+
+static rtems_jffs2_compressor_lzo_control *get_lzo_control(
+	rtems_jffs2_compressor_control *super
+)
+{
+	return (rtems_jffs2_compressor_lzo_control *) super;
+}
+
+static inline uint32_t get_le32(const unsigned char *p)
+{
+	return (uint32_t) p[0] | ((uint32_t) p[1] << 8) |
+	    ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static unsigned char *lzo_store_count(unsigned char *op, size_t count)
+{
+	while (count > 255) {
+		count -= 255;
+		*op++ = 0;
+	}
+
+	*op++ = (unsigned char) count;
+
+	return op;
+}
+
+static unsigned char *lzo_store_literals(unsigned char *op,
+					 const unsigned char *out,
+					 const unsigned char *ii, size_t t)
+{
+	if (op == out && t <= 238) {
+		*op++ = (unsigned char) (17 + t);
+	} else if (t <= 3) {
+		/* Use the two spare bits of the previous match */
+		op[-2] |= (unsigned char) t;
+	} else if (t <= 18) {
+		*op++ = (unsigned char) (t - 3);
+	} else {
+		*op++ = 0;
+		op = lzo_store_count(op, t - 18);
+	}
+
+	memcpy(op, ii, t);
+
+	return op + t;
+}
+
+/*
+ * The input length must be at most M4_MAX_OFFSET + 1, so that the dictionary
+ * can store the positions in 16 bits.
+ */
+static size_t lzo1x_1_compress(const unsigned char *in, size_t in_len,
+			       unsigned char *out, uint16_t *dict)
+{
+	const unsigned char *ip = in;
+	const unsigned char *ii = in;
+	unsigned char *op = out;
+
+	memset(dict, 0, D_SIZE * sizeof(*dict));
+
+	if (in_len > 20) {
+		const unsigned char *ip_end = in + in_len - 20;
+
+		ip += 4;
+
+		for (;;) {
+			const unsigned char *m_pos;
+			size_t m_len;
+			size_t m_off;
+			uint32_t dv;
+			size_t t;
+
+			/* Skip faster through incompressible data */
+			ip += 1 + ((ip - ii) >> 5);
+next:
+			if (ip >= ip_end)
+				break;
+
+			dv = get_le32(ip);
+			t = ((dv * 0x1824429dU) >> (32 - D_BITS)) & D_MASK;
+			m_pos = in + dict[t];
+			dict[t] = (uint16_t) (ip - in);
+
+			if (dv != get_le32(m_pos))
+				continue;
+
+			t = ip - ii;
+			if (t != 0)
+				op = lzo_store_literals(op, out, ii, t);
+
+			m_len = 4;
+			while (ip + m_len < ip_end && ip[m_len] == m_pos[m_len])
+				++m_len;
+
+			m_off = ip - m_pos;
+			ip += m_len;
+			ii = ip;
+
+			if (m_len <= M2_MAX_LEN && m_off <= M2_MAX_OFFSET) {
+				m_off -= 1;
+				*op++ = (unsigned char) (((m_len - 1) << 5) |
+				    ((m_off & 7) << 2));
+				*op++ = (unsigned char) (m_off >> 3);
+			} else {
+				if (m_off <= M3_MAX_OFFSET) {
+					m_off -= 1;
+					if (m_len <= M3_MAX_LEN) {
+						*op++ = (unsigned char) (M3_MARKER |
+						    (m_len - 2));
+					} else {
+						*op++ = M3_MARKER;
+						op = lzo_store_count(op,
+						    m_len - M3_MAX_LEN);
+					}
+				} else {
+					m_off -= 0x4000;
+					if (m_len <= M4_MAX_LEN) {
+						*op++ = (unsigned char) (M4_MARKER |
+						    ((m_off >> 11) & 8) |
+						    (m_len - 2));
+					} else {
+						*op++ = (unsigned char) (M4_MARKER |
+						    ((m_off >> 11) & 8));
+						op = lzo_store_count(op,
+						    m_len - M4_MAX_LEN);
+					}
+				}
+
+				*op++ = (unsigned char) (m_off << 2);
+				*op++ = (unsigned char) (m_off >> 6);
+			}
+
+			goto next;
+		}
+	}
+
+	if (ii < in + in_len)
+		op = lzo_store_literals(op, out, ii, in + in_len - ii);
+
+	/* End of stream marker */
+	*op++ = M4_MARKER | 1;
+	*op++ = 0;
+	*op++ = 0;
+
+	return op - out;
+}
+
+static int lzo_load_count(const unsigned char **ipp,
+			  const unsigned char *ip_end, size_t *t, size_t base)
+{
+	const unsigned char *ip = *ipp;
+
+	while (*ip == 0) {
+		*t += 255;
+		++ip;
+		if (ip >= ip_end)
+			return -EIO;
+	}
+
+	*t += base + *ip++;
+	*ipp = ip;
+
+	return 0;
+}
+
+/*
+ * Checks every access against the input and output buffer bounds, so that
+ * corrupt flash contents cannot overrun the buffers.
+ */
+static int lzo1x_decompress_safe(const unsigned char *in, size_t in_len,
+				 unsigned char *out, size_t out_len)
+{
+	const unsigned char *ip = in;
+	const unsigned char * const ip_end = in + in_len;
+	unsigned char *op = out;
+	unsigned char * const op_end = out + out_len;
+	const unsigned char *m_pos;
+	size_t state = 0;
+	size_t next;
+	size_t t;
+
+	if (in_len < 3)
+		return -EIO;
+
+	if (*ip > 17) {
+		t = *ip++ - 17;
+		if (t < 4) {
+			next = t;
+			goto match_next;
+		}
+		goto copy_literal_run;
+	}
+
+	for (;;) {
+		/* Each instruction is followed at least by the end of stream marker */
+		if (ip_end - ip < 3)
+			return -EIO;
+
+		t = *ip++;
+
+		if (t < 16) {
+			if (state == 0) {
+				if (t == 0 &&
+				    lzo_load_count(&ip, ip_end, &t, 15) != 0)
+					return -EIO;
+				t += 3;
+copy_literal_run:
+				if ((size_t) (ip_end - ip) < t + 3 ||
+				    (size_t) (op_end - op) < t)
+					return -EIO;
+				memcpy(op, ip, t);
+				op += t;
+				ip += t;
+				state = 4;
+				continue;
+			} else if (state != 4) {
+				next = t & 3;
+				m_pos = op - 1 - (t >> 2) - (*ip++ << 2);
+				if (m_pos < out || op_end - op < 2)
+					return -EIO;
+				op[0] = m_pos[0];
+				op[1] = m_pos[1];
+				op += 2;
+				goto match_next;
+			} else {
+				next = t & 3;
+				m_pos = op - (1 + M2_MAX_OFFSET) - (t >> 2) -
+				    (*ip++ << 2);
+				t = 3;
+			}
+		} else if (t >= 64) {
+			next = t & 3;
+			m_pos = op - 1 - ((t >> 2) & 7) - (*ip++ << 3);
+			t = (t >> 5) - 1 + 2;
+		} else if (t >= 32) {
+			t = (t & 31) + 2;
+			if (t == 2 &&
+			    lzo_load_count(&ip, ip_end, &t, 31) != 0)
+				return -EIO;
+			if (ip_end - ip < 2)
+				return -EIO;
+			next = ip[0] | (ip[1] << 8);
+			ip += 2;
+			m_pos = op - 1 - (next >> 2);
+			next &= 3;
+		} else {
+			m_pos = op - ((t & 8) << 11);
+			t = (t & 7) + 2;
+			if (t == 2 &&
+			    lzo_load_count(&ip, ip_end, &t, 7) != 0)
+				return -EIO;
+			if (ip_end - ip < 2)
+				return -EIO;
+			next = ip[0] | (ip[1] << 8);
+			ip += 2;
+			m_pos -= next >> 2;
+			next &= 3;
+			if (m_pos == op) {
+				if (t != 3 || ip != ip_end || op != op_end)
+					return -EIO;
+				return 0;
+			}
+			m_pos -= 0x4000;
+		}
+
+		if (m_pos < out || (size_t) (op_end - op) < t)
+			return -EIO;
+
+		/* The match may overlap the output */
+		do {
+			*op++ = *m_pos++;
+		} while (--t > 0);
+
+match_next:
+		state = next;
+		t = next;
+		if (t != 0) {
+			if ((size_t) (ip_end - ip) < t + 3 ||
+			    (size_t) (op_end - op) < t)
+				return -EIO;
+			memcpy(op, ip, t);
+			op += t;
+			ip += t;
+		}
+	}
+}
+
+uint16_t rtems_jffs2_compressor_lzo_compress(
+	rtems_jffs2_compressor_control *super,
+	unsigned char *data_in,
+	unsigned char *cpage_out,
+	uint32_t *sourcelen,
+	uint32_t *dstlen
+)
+{
+	rtems_jffs2_compressor_lzo_control *self = get_lzo_control(super);
+	size_t compress_size;
+
+	if (*sourcelen > PAGE_SIZE) {
+		return JFFS2_COMPR_NONE;
+	}
+
+	compress_size = lzo1x_1_compress(data_in, *sourcelen,
+	    &self->work[0], &self->dict[0]);
+
+	if (compress_size >= *sourcelen || compress_size > *dstlen) {
+		return JFFS2_COMPR_NONE;
+	}
+
+	memcpy(cpage_out, &self->work[0], compress_size);
+	*dstlen = compress_size;
+
+	return JFFS2_COMPR_LZO;
+}
+
+int rtems_jffs2_compressor_lzo_decompress(
+	rtems_jffs2_compressor_control *super,
+	uint16_t comprtype,
+	unsigned char *data_in,
+	unsigned char *cpage_out,
+	uint32_t srclen,
+	uint32_t destlen
+)
+{
+	(void) super;
+
+	if (comprtype != JFFS2_COMPR_LZO) {
+		return -EIO;
+	}
+
+	return lzo1x_decompress_safe(data_in, srclen, cpage_out, destlen);
+}
@@ -29,7 +29,7 @@ int jffs2_flash_read(struct jffs2_sb_info * c,
 	return (*fc->read)(fc, read_buffer_offset, write_buffer, size);
 }
 
-int jffs2_flash_write(struct jffs2_sb_info * c,
+static int jffs2_flash_direct_write(struct jffs2_sb_info * c,
 			   cyg_uint32 write_buffer_offset, const size_t size,
 			   size_t * return_size, unsigned char *read_buffer)
 {
@@ -41,6 +41,31 @@ int jffs2_flash_write(struct jffs2_sb_info * c,
 	return (*fc->write)(fc, write_buffer_offset, read_buffer, size);
 }
 
+int jffs2_flash_write(struct jffs2_sb_info * c,
+			   cyg_uint32 write_buffer_offset, const size_t size,
+			   size_t * return_size, unsigned char *read_buffer)
+{
+	int ret;
+
+	ret = jffs2_flash_direct_write(c, write_buffer_offset, size,
+				       return_size, read_buffer);
+
+	if (jffs2_sum_active()) {
+		struct kvec vecs[1];
+		int res;
+
+		vecs[0].iov_base = read_buffer;
+		vecs[0].iov_len = size;
+
+		res = jffs2_sum_add_kvec(c, vecs, 1, write_buffer_offset);
+		if (res) {
+			return res;
+		}
+	}
+
+	return ret;
+}
+
 int
 jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 		   unsigned long count, loff_t to, size_t * retlen)
@@ -84,7 +109,7 @@ jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 					cbufptr += vecs[j].iov_len;
 				}
 				ret =
-				    jffs2_flash_write(c, to, sizetomalloc,
+				    jffs2_flash_direct_write(c, to, sizetomalloc,
 						      &thislen, cbuf);
 				if (thislen > totvecsize)	// in case it was aligned up
 					thislen = totvecsize;
@@ -103,14 +128,14 @@ jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 				memcpy(buf, vecs[i].iov_base, lentowrite);
 
 				ret =
-				    jffs2_flash_write(c, to, lentowrite,
+				    jffs2_flash_direct_write(c, to, lentowrite,
 						      &thislen, (char *) &buf);
 				if (thislen > vecs[i].iov_len)
 					thislen = vecs[i].iov_len;
 			}	// else
 		} else
 			ret =
-			    jffs2_flash_write(c, to, vecs[i].iov_len, &thislen,
+			    jffs2_flash_direct_write(c, to, vecs[i].iov_len, &thislen,
 					      vecs[i].iov_base);
 		totlen += thislen;
 		if (ret || thislen != vecs[i].iov_len)
@@ -124,12 +149,33 @@ jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 	return ret;
 }
 
+int jffs2_flash_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
+		       unsigned long count, loff_t to, size_t *retlen, uint32_t ino)
+{
+	if (jffs2_sum_active()) {
+		int res;
+
+		res = jffs2_sum_add_kvec(c, vecs, count, (uint32_t) to);
+		if (res) {
+			return res;
+		}
+	}
+
+	return jffs2_flash_direct_writev(c, vecs, count, to, retlen);
+}
+
 int jffs2_flash_erase(struct jffs2_sb_info * c,
 			   struct jffs2_eraseblock * jeb)
 {
-	const struct super_block *sb = OFNI_BS_2SFFJ(c);
+	struct super_block *sb = OFNI_BS_2SFFJ(c);
 	rtems_jffs2_flash_control *fc = sb->s_flash_control;
+	int err;
+
+	err = (*fc->erase)(fc, jeb->offset);
+	if (err == 0) {
+		++sb->s_statistics.erased_blocks;
+	}
 
-	return (*fc->erase)(fc, jeb->offset);
+	return err;
 }
 
@@ -27,6 +27,7 @@
 #include <errno.h>
 #include <string.h>
 #include <assert.h>
+#include <rtems.h>
 #include <rtems/libio.h>
 #include <rtems/libio_.h>
 
@@ -358,9 +359,15 @@ static void rtems_jffs2_free_fs_info(rtems_jffs2_fs_info *fs_info, bool do_mount
 	struct super_block *sb = &fs_info->sb;
 	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
 
+	/* The task was created, but not started, if the mount failed */
+	if (sb->s_gc_task != 0) {
+		(void) rtems_task_delete(sb->s_gc_task);
+	}
+
 	if (do_mount_fs_was_successful) {
 		jffs2_free_ino_caches(c);
 		jffs2_free_raw_node_refs(c);
+		jffs2_sum_exit(c);
 		free(c->blocks);
 	}
 
@@ -520,7 +527,7 @@ static uint32_t rtems_jffs2_count_blocks(const struct list_head *list)
 }
 
 static void rtems_jffs2_get_info(
-	const struct jffs2_sb_info *c,
+	struct jffs2_sb_info       *c,
 	rtems_jffs2_info           *info
 )
 {
@@ -545,6 +552,7 @@ static void rtems_jffs2_get_info(
 	info->free_blocks = rtems_jffs2_count_blocks(&c->free_list);
 	info->free_blocks += c->nextblock != NULL;
 	info->bad_blocks = rtems_jffs2_count_blocks(&c->bad_list);
+	info->statistics = OFNI_BS_2SFFJ(c)->s_statistics;
 }
 
 static int rtems_jffs2_on_demand_garbage_collection(struct jffs2_sb_info *c)
@@ -604,7 +612,8 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_directory_handlers = {
 	.mmap_h = rtems_filesystem_default_mmap,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
-	.writev_h = rtems_filesystem_default_writev
+	.writev_h = rtems_filesystem_default_writev,
+	.sendfile_h = rtems_filesystem_default_sendfile
 };
 
 static ssize_t rtems_jffs2_file_read(rtems_libio_t *iop, void *buf, size_t len)
@@ -647,6 +656,19 @@ static ssize_t rtems_jffs2_file_read(rtems_libio_t *iop, void *buf, size_t len)
 	}
 }
 
+static void rtems_jffs2_record_write_stall(struct super_block *sb, uint64_t begin)
+{
+	uint64_t us = (rtems_clock_get_uptime_nanoseconds() - begin) / 1000;
+	size_t bin = 0;
+
+	while (us > 1 && bin < RTEMS_JFFS2_WRITE_STALL_BINS - 1) {
+		us >>= 1;
+		++bin;
+	}
+
+	++sb->s_statistics.write_stalls[bin];
+}
+
 static ssize_t rtems_jffs2_file_write(rtems_libio_t *iop, const void *buf, size_t len)
 {
 	struct _inode *inode = rtems_jffs2_get_inode_by_iop(iop);
@@ -655,6 +677,7 @@ static ssize_t rtems_jffs2_file_write(rtems_libio_t *iop, const void *buf, size_
 	struct jffs2_raw_inode ri;
 	uint32_t writtenlen;
 	off_t pos;
+	uint64_t begin;
 	int eno = 0;
 
 	memset(&ri, 0, sizeof(ri));
@@ -665,6 +688,7 @@ static ssize_t rtems_jffs2_file_write(rtems_libio_t *iop, const void *buf, size_
 	ri.gid = cpu_to_je16(inode->i_gid);
 	ri.atime = ri.ctime = ri.mtime = cpu_to_je32(get_seconds());
 
+	begin = rtems_clock_get_uptime_nanoseconds();
 	rtems_jffs2_do_lock(inode->i_sb);
 
 	if (rtems_libio_iop_is_append(iop)) {
@@ -700,6 +724,7 @@ static ssize_t rtems_jffs2_file_write(rtems_libio_t *iop, const void *buf, size_
 		}
 	}
 
+	rtems_jffs2_record_write_stall(inode->i_sb, begin);
 	rtems_jffs2_do_unlock(inode->i_sb);
 
 	if (eno == 0) {
@@ -747,7 +772,8 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_file_handlers = {
 	.mmap_h = rtems_filesystem_default_mmap,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
-	.writev_h = rtems_filesystem_default_writev
+	.writev_h = rtems_filesystem_default_writev,
+	.sendfile_h = rtems_filesystem_default_sendfile
 };
 
 static const rtems_filesystem_file_handlers_r rtems_jffs2_link_handlers = {
@@ -766,7 +792,8 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_link_handlers = {
 	.mmap_h = rtems_filesystem_default_mmap,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
-	.writev_h = rtems_filesystem_default_writev
+	.writev_h = rtems_filesystem_default_writev,
+	.sendfile_h = rtems_filesystem_default_sendfile
 };
 
 static void rtems_jffs2_set_location(rtems_filesystem_location_info_t *loc, struct _inode *inode)
@@ -1049,11 +1076,229 @@ static void rtems_jffs2_freenode(const rtems_filesystem_location_info_t *loc)
 	jffs2_iput(inode);
 }
 
+//==========================================================================
+//
+// Garbage collection task
+//
+//==========================================================================
+
+#define RTEMS_JFFS2_GC_EVENT RTEMS_EVENT_0
+
+static bool rtems_jffs2_gc_has_erase_work(struct jffs2_sb_info *c)
+{
+	return !list_empty(&c->erase_complete_list) ||
+	    !list_empty(&c->erase_pending_list);
+}
+
+static bool rtems_jffs2_gc_has_collect_work(const struct super_block *sb)
+{
+	const struct jffs2_sb_info *c = &sb->jffs2_sb;
+	uint32_t watermark;
+	uint32_t dirty;
+
+	if (c->unchecked_size != 0) {
+		return true;
+	}
+
+	/*
+	 * Once started, continue up to the high watermark so that the task does
+	 * not wake up for each block which drops below the low watermark.
+	 */
+	if (sb->s_gc_collecting) {
+		watermark = sb->s_gc_config.free_blocks_high;
+	} else {
+		watermark = sb->s_gc_config.free_blocks_low;
+	}
+
+	/* See jffs2_thread_should_wake() */
+	dirty = c->dirty_size + c->erasing_size - c->nr_erasing_blocks * c->sector_size;
+
+	return c->nr_free_blocks + c->nr_erasing_blocks < watermark &&
+	    dirty > c->nospc_dirty_size;
+}
+
+static bool rtems_jffs2_gc_has_work(struct super_block *sb)
+{
+	return (sb->s_gc_config.pre_erase &&
+	    rtems_jffs2_gc_has_erase_work(&sb->jffs2_sb)) ||
+	    rtems_jffs2_gc_has_collect_work(sb);
+}
+
+/*
+ * Carries out garbage collection passes and block erasures until the step
+ * time is used up.  Returns true, if there is more work to do.
+ */
+static bool rtems_jffs2_gc_step(struct super_block *sb)
+{
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+	rtems_jffs2_statistics *stats = &sb->s_statistics;
+	uint64_t budget = (uint64_t) sb->s_gc_config.step_time * 1000;
+	uint64_t begin = rtems_clock_get_uptime_nanoseconds();
+	uint64_t delta;
+	bool more = true;
+	bool work = false;
+
+	do {
+		if (sb->s_gc_config.pre_erase && rtems_jffs2_gc_has_erase_work(c)) {
+			uint32_t erased_blocks = stats->erased_blocks;
+
+			jffs2_erase_pending_blocks(c, 1);
+			stats->pre_erased_blocks += stats->erased_blocks - erased_blocks;
+		} else if (rtems_jffs2_gc_has_collect_work(sb)) {
+			sb->s_gc_collecting = true;
+
+			if (jffs2_garbage_collect_pass(c) == 0) {
+				++stats->gc_passes;
+			} else {
+				sb->s_gc_collecting = false;
+				more = false;
+			}
+		} else {
+			sb->s_gc_collecting = false;
+			more = false;
+		}
+
+		delta = rtems_clock_get_uptime_nanoseconds() - begin;
+		work = work || more;
+	} while (more && delta < budget);
+
+	if (work) {
+		++stats->gc_steps;
+		stats->gc_time += delta;
+	}
+
+	return more && rtems_jffs2_gc_has_work(sb);
+}
+
+static void rtems_jffs2_gc_task(rtems_task_argument arg)
+{
+	struct super_block *sb = (struct super_block *) arg;
+	rtems_interval interval = sb->s_gc_config.step_interval;
+
+	if (interval == 0) {
+		interval = RTEMS_YIELD_PROCESSOR;
+	}
+
+	while (true) {
+		rtems_event_set events;
+		bool more;
+
+		(void) rtems_event_receive(
+			RTEMS_JFFS2_GC_EVENT,
+			RTEMS_EVENT_ALL | RTEMS_WAIT,
+			RTEMS_NO_TIMEOUT,
+			&events
+		);
+
+		do {
+			rtems_jffs2_do_lock(sb);
+
+			if (sb->s_gc_stop) {
+				rtems_id stopper = sb->s_gc_stopper;
+
+				rtems_jffs2_do_unlock(sb);
+				(void) rtems_event_transient_send(stopper);
+				rtems_task_exit();
+			}
+
+			more = rtems_jffs2_gc_step(sb);
+			rtems_jffs2_do_unlock(sb);
+
+			if (more) {
+				(void) rtems_task_wake_after(interval);
+			}
+		} while (more);
+	}
+}
+
+void jffs2_gc_task_wake(struct jffs2_sb_info *c)
+{
+	struct super_block *sb = OFNI_BS_2SFFJ(c);
+
+	if (rtems_jffs2_gc_has_work(sb)) {
+		(void) rtems_event_send(sb->s_gc_task, RTEMS_JFFS2_GC_EVENT);
+	}
+}
+
+static int rtems_jffs2_gc_task_create(
+	struct super_block *sb,
+	const rtems_jffs2_gc_task_config *config
+)
+{
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+	rtems_status_code sc;
+	size_t stack_size;
+	rtems_id id;
+
+	sb->s_gc_config = *config;
+
+	if (sb->s_gc_config.free_blocks_low == 0) {
+		sb->s_gc_config.free_blocks_low = c->resv_blocks_gctrigger;
+	}
+
+	if (sb->s_gc_config.free_blocks_high < sb->s_gc_config.free_blocks_low) {
+		sb->s_gc_config.free_blocks_high = sb->s_gc_config.free_blocks_low;
+	}
+
+	stack_size = config->stack_size;
+	if (stack_size == 0) {
+		stack_size = RTEMS_MINIMUM_STACK_SIZE;
+	}
+
+	sc = rtems_task_create(
+		rtems_build_name('J', 'F', 'G', 'C'),
+		config->priority,
+		stack_size,
+		RTEMS_DEFAULT_MODES,
+		RTEMS_DEFAULT_ATTRIBUTES,
+		&id
+	);
+	if (sc != RTEMS_SUCCESSFUL) {
+		return -rtems_status_code_to_errno(sc);
+	}
+
+	sb->s_gc_task = id;
+
+	return 0;
+}
+
+static void rtems_jffs2_gc_task_start(struct super_block *sb)
+{
+	if (sb->s_gc_task != 0) {
+		rtems_status_code sc;
+
+		sc = rtems_task_start(
+			sb->s_gc_task,
+			rtems_jffs2_gc_task,
+			(rtems_task_argument) sb
+		);
+		assert(sc == RTEMS_SUCCESSFUL);
+
+		(void) rtems_event_send(sb->s_gc_task, RTEMS_JFFS2_GC_EVENT);
+	}
+}
+
+static void rtems_jffs2_gc_task_stop(struct super_block *sb)
+{
+	if (sb->s_gc_task != 0) {
+		rtems_jffs2_do_lock(sb);
+		sb->s_gc_stop = true;
+		sb->s_gc_stopper = rtems_task_self();
+		rtems_jffs2_do_unlock(sb);
+
+		(void) rtems_event_send(sb->s_gc_task, RTEMS_JFFS2_GC_EVENT);
+		(void) rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+		sb->s_gc_task = 0;
+	}
+}
+
 static void rtems_jffs2_fsunmount(rtems_filesystem_mount_table_entry_t *mt_entry)
 {
 	rtems_jffs2_fs_info *fs_info = mt_entry->fs_info;
 	struct _inode *root_i = mt_entry->mt_fs_root->location.node_access;
 
+	rtems_jffs2_gc_task_stop(&fs_info->sb);
+
 	icache_evict(root_i, NULL);
 	assert(root_i->i_cache_next == NULL);
 	assert(root_i->i_count == 1);
@@ -1262,6 +1507,9 @@ int rtems_jffs2_initialize(
 		sb->s_is_readonly = !mt_entry->writeable;
 		sb->s_flash_control = fc;
 		sb->s_compressor_control = jffs2_mount_data->compressor_control;
+		sb->s_compressor_min_saving = jffs2_mount_data->compressor_min_saving;
+		sb->s_compressor_backoff = jffs2_mount_data->compressor_backoff;
+		sb->s_summary = jffs2_mount_data->summary;
 
 		c->inocache_hashsize = inocache_hashsize;
 		c->inocache_list = &fs_info->inode_cache[0];
@@ -1275,6 +1523,12 @@ int rtems_jffs2_initialize(
 	if (err == 0) {
 		do_mount_fs_was_successful = true;
 
+		if (jffs2_mount_data->gc_task != NULL && !jffs2_is_readonly(c)) {
+			err = rtems_jffs2_gc_task_create(sb, jffs2_mount_data->gc_task);
+		}
+	}
+
+	if (err == 0) {
 		sb->s_root = jffs2_iget(sb, 1);
 		if (IS_ERR(sb->s_root)) {
 			err = PTR_ERR(sb->s_root);
@@ -1284,10 +1538,13 @@ int rtems_jffs2_initialize(
 	if (err == 0) {
 		sb->s_root->i_parent = sb->s_root;
 
-		if (!jffs2_is_readonly(c)) {
+		/* The garbage collection task erases the pending blocks later */
+		if (!jffs2_is_readonly(c) && !sb->s_gc_config.pre_erase) {
 			jffs2_erase_pending_blocks(c, 0);
 		}
 
+		rtems_jffs2_gc_task_start(sb);
+
 		mt_entry->fs_info = fs_info;
 		mt_entry->ops = &rtems_jffs2_ops;
 		mt_entry->mt_fs_root->location.node_access = sb->s_root;
@@ -50,6 +50,8 @@ struct jffs2_inode_info {
 
 	uint16_t flags;
 	uint8_t usercompr;
+	/* Data nodes to write uncompressed, see jffs2_compress() */
+	uint8_t compr_backoff;
 #if !defined (__ECOS)
 	struct inode vfs_inode;
 #endif
@@ -104,9 +104,18 @@ struct super_block {
 	struct _inode *		s_root;
 	rtems_jffs2_flash_control	*s_flash_control;
 	rtems_jffs2_compressor_control	*s_compressor_control;
+	uint8_t			s_compressor_min_saving;
+	uint8_t			s_compressor_backoff;
 	bool			s_is_readonly;
 	unsigned char		s_gc_buffer[PAGE_CACHE_SIZE]; // Avoids malloc when user may be under memory pressure
 	rtems_recursive_mutex	s_mutex;
+	bool			s_summary;
+	rtems_jffs2_gc_task_config	s_gc_config;
+	rtems_id		s_gc_task;
+	rtems_id		s_gc_stopper;
+	bool			s_gc_collecting;
+	bool			s_gc_stop;
+	rtems_jffs2_statistics	s_statistics;
 	char			s_name_buf[JFFS2_MAX_NAME_LEN];
 };
 
@@ -120,11 +129,24 @@ static inline bool jffs2_is_readonly(struct jffs2_sb_info *c)
 	return sb->s_is_readonly;
 }
 
+static inline bool jffs2_sum_enabled(struct jffs2_sb_info *c)
+{
+	const struct super_block *sb = OFNI_BS_2SFFJ(c);
+
+	return sb->s_summary;
+}
+
+void jffs2_gc_task_wake(struct jffs2_sb_info *c);
+
 static inline void jffs2_garbage_collect_trigger(struct jffs2_sb_info *c)
 {
 	const struct super_block *sb = OFNI_BS_2SFFJ(c);
 	rtems_jffs2_flash_control *fc = sb->s_flash_control;
 
+	if (sb->s_gc_task != 0) {
+		jffs2_gc_task_wake(c);
+	}
+
 	if (fc->trigger_garbage_collection != NULL) {
 		(*fc->trigger_garbage_collection)(fc);
 	}
@@ -160,6 +182,8 @@ int jffs2_flash_write(struct jffs2_sb_info *c, cyg_uint32 write_buffer_offset,
 			   const size_t size, size_t * return_size, unsigned char * read_buffer);
 int jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 			      unsigned long count, loff_t to, size_t *retlen);
+int jffs2_flash_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
+		       unsigned long count, loff_t to, size_t *retlen, uint32_t ino);
 int jffs2_flash_erase(struct jffs2_sb_info *c, struct jffs2_eraseblock *jeb);
 
 // dir-rtems.c
@@ -190,7 +214,6 @@ static inline void jffs2_erase_pending_trigger(struct jffs2_sb_info *c)
 #define jffs2_flash_setup(c) (0)
 #define jffs2_nand_flash_cleanup(c) do {} while(0)
 #define jffs2_wbuf_dirty(c) (0)
-#define jffs2_flash_writev(a,b,c,d,e,f) jffs2_flash_direct_writev(a,b,c,d,e)
 #define jffs2_wbuf_timeout NULL
 #define jffs2_wbuf_process NULL
 #define jffs2_nor_ecc(c) (0)
@@ -53,8 +53,14 @@ static rtems_mutex pipe_mutex = RTEMS_MUTEX_INITIALIZER("Pipes");
 #define PIPE_WAKEUPREADERS(_pipe) \
   rtems_condition_variable_broadcast(&(_pipe)->readBarrier)
 
+/* The woken writers register their need again if they have to wait */
 #define PIPE_WAKEUPWRITERS(_pipe) \
-  rtems_condition_variable_broadcast(&(_pipe)->writeBarrier)
+  do { \
+    (_pipe)->writerNeed = UINT_MAX; \
+    rtems_condition_variable_broadcast(&(_pipe)->writeBarrier); \
+  } while (0)
+
+#define PIPE_BATCHING(_pipe) ((_pipe)->Capacity > PIPE_DEFAULT_CAPACITY)
 
 /*
  * Alloc pipe control structure, buffer, and resources.
@@ -74,6 +80,8 @@ static int pipe_alloc(
   memset(pipe, 0, sizeof(pipe_control_t));
 
   pipe->Size = PIPE_BUF;
+  pipe->Capacity = PIPE_DEFAULT_CAPACITY;
+  pipe->writerNeed = UINT_MAX;
   pipe->Buffer = malloc(pipe->Size);
   if (pipe->Buffer == NULL) {
     free(pipe);
@@ -102,6 +110,50 @@ static inline void pipe_free(
   free(pipe);
 }
 
+/*
+ * Replace the pipe buffer with a buffer of the specified size and move the
+ * pipe contents to its start.  Called with the pipe locked.
+ */
+static int pipe_resize(
+  pipe_control_t *pipe,
+  unsigned int    size
+)
+{
+  char *buffer;
+  unsigned int chunk1;
+
+  buffer = malloc(size);
+  if (buffer == NULL)
+    return -ENOMEM;
+
+  chunk1 = MIN(pipe->Length, pipe->Size - pipe->Start);
+  memcpy(buffer, pipe->Buffer + pipe->Start, chunk1);
+  memcpy(buffer + chunk1, pipe->Buffer, pipe->Length - chunk1);
+
+  free(pipe->Buffer);
+  pipe->Buffer = buffer;
+  pipe->Size = size;
+  pipe->Start = 0;
+  return 0;
+}
+
+/*
+ * Grow the pipe buffer so that it can take count more bytes, at least double
+ * it, and at most up to the pipe capacity.  If this fails, then the writer
+ * just waits for space as usual.  Called with the pipe locked.
+ */
+static void pipe_grow(
+  pipe_control_t *pipe,
+  size_t          count
+)
+{
+  size_t size;
+
+  size = MAX(2 * (size_t) pipe->Size, pipe->Length + count);
+  size = MIN(size, pipe->Capacity);
+  (void) pipe_resize(pipe, roundup(size, PIPE_BUF));
+}
+
 static void pipe_lock(void)
 {
   rtems_mutex_lock(&pipe_mutex);
@@ -277,7 +329,7 @@ ssize_t pipe_read(
 
   PIPE_LOCK(pipe);
 
-  while (PIPE_EMPTY(pipe)) {
+  while (PIPE_EMPTY(pipe) && pipe->DirectLength == 0) {
     /* Not an error */
     if (pipe->Writers == 0)
       goto out_locked;
@@ -293,25 +345,40 @@ ssize_t pipe_read(
     pipe->waitingReaders --;
   }
 
-  /* Read chunk bytes */
-  chunk = MIN(count - read,  pipe->Length);
-  chunk1 = pipe->Size - pipe->Start;
-  if (chunk > chunk1) {
-    memcpy(buffer + read, pipe->Buffer + pipe->Start, chunk1);
-    memcpy(buffer + read + chunk1, pipe->Buffer, chunk - chunk1);
-  }
-  else
-    memcpy(buffer + read, pipe->Buffer + pipe->Start, chunk);
+  if (PIPE_EMPTY(pipe)) {
+    /* Copy directly from the buffer lent by a blocked writer */
+    chunk = MIN(count - read, pipe->DirectLength);
+    memcpy(buffer + read, pipe->DirectBuffer, chunk);
+    pipe->DirectBuffer += chunk;
+    pipe->DirectLength -= chunk;
 
-  pipe->Start += chunk;
-  pipe->Start %= pipe->Size;
-  pipe->Length -= chunk;
-  /* For buffering optimization */
-  if (PIPE_EMPTY(pipe))
-    pipe->Start = 0;
+    /* The writer is only interested in the completion */
+    if (pipe->DirectLength == 0)
+      PIPE_WAKEUPWRITERS(pipe);
+  }
+  else {
+    /* Read chunk bytes */
+    chunk = MIN(count - read,  pipe->Length);
+    chunk1 = pipe->Size - pipe->Start;
+    if (chunk > chunk1) {
+      memcpy(buffer + read, pipe->Buffer + pipe->Start, chunk1);
+      memcpy(buffer + read + chunk1, pipe->Buffer, chunk - chunk1);
+    }
+    else
+      memcpy(buffer + read, pipe->Buffer + pipe->Start, chunk);
+
+    pipe->Start += chunk;
+    pipe->Start %= pipe->Size;
+    pipe->Length -= chunk;
+    /* For buffering optimization */
+    if (PIPE_EMPTY(pipe))
+      pipe->Start = 0;
+
+    /* Wake up the writers once a waiting writer can make use of the space */
+    if (pipe->waitingWriters > 0 && PIPE_SPACE(pipe) >= pipe->writerNeed)
+      PIPE_WAKEUPWRITERS(pipe);
+  }
 
-  if (pipe->waitingWriters > 0)
-    PIPE_WAKEUPWRITERS(pipe);
   read += chunk;
 
 out_locked:
@@ -322,6 +389,40 @@ out_locked:
   return ret;
 }
 
+/*
+ * Lend the buffer of the writer to the readers instead of copying it into the
+ * pipe buffer.  The writer waits until the readers consumed everything or no
+ * reader exists.  Called with the pipe locked and empty.  Returns the count
+ * of consumed bytes.
+ */
+static size_t pipe_write_direct(
+  pipe_control_t *pipe,
+  const void     *buffer,
+  size_t          count
+)
+{
+  pipe->DirectBuffer = buffer;
+  pipe->DirectLength = count;
+
+  if (pipe->waitingReaders > 0)
+    PIPE_WAKEUPREADERS(pipe);
+
+  pipe->waitingWriters ++;
+  while (pipe->DirectLength > 0 && pipe->Readers > 0)
+    PIPE_WRITEWAIT(pipe);
+  pipe->waitingWriters --;
+
+  count -= pipe->DirectLength;
+  pipe->DirectBuffer = NULL;
+  pipe->DirectLength = 0;
+
+  /* Other writers wait until the direct write is done */
+  if (pipe->waitingWriters > 0)
+    PIPE_WAKEUPWRITERS(pipe);
+
+  return count;
+}
+
 ssize_t pipe_write(
   pipe_control_t *pipe,
   const void     *buffer,
@@ -330,6 +431,7 @@ ssize_t pipe_write(
 )
 {
   int chunk, chunk1, written = 0, ret = 0;
+  unsigned int need;
 
   /* Write nothing */
   if (count == 0)
@@ -343,16 +445,42 @@ ssize_t pipe_write(
   }
 
   /* Write of PIPE_BUF bytes or less shall not be interleaved */
-  chunk = count <= pipe->Size ? count : 1;
+  chunk = count <= PIPE_BUF ? count : 1;
 
   while (written < count) {
-    while (PIPE_SPACE(pipe) < chunk) {
+    /*
+     * Pass writes which do not fit into the pipe directly to the readers,
+     * unless the writer must not block.
+     */
+    if (PIPE_BATCHING(pipe) && !LIBIO_NODELAY(iop) &&
+        count - written > pipe->Capacity && PIPE_EMPTY(pipe) &&
+        pipe->DirectBuffer == NULL) {
+      written += pipe_write_direct(pipe, buffer + written, count - written);
+      if (written < count)
+        ret = -EPIPE;
+      break;
+    }
+
+    if (PIPE_SPACE(pipe) < count - written && pipe->Size < pipe->Capacity)
+      pipe_grow(pipe, count - written);
+
+    if (PIPE_SPACE(pipe) < chunk || pipe->DirectBuffer != NULL) {
       if (LIBIO_NODELAY(iop)) {
         ret = -EAGAIN;
         goto out_locked;
       }
 
-      /* Wait until there is chunk bytes space or no reader exists */
+      /*
+       * Wait until there is chunk bytes space or no reader exists.  With
+       * batching, wait for half of the buffer unless less space completes
+       * the write.
+       */
+      need = chunk;
+      if (PIPE_BATCHING(pipe))
+        need = MAX(need, MIN(count - written, pipe->Size / 2));
+      if (need < pipe->writerNeed)
+        pipe->writerNeed = need;
+
       pipe->waitingWriters ++;
       PIPE_WRITEWAIT(pipe);
       pipe->waitingWriters --;
@@ -361,6 +489,9 @@ ssize_t pipe_write(
         ret = -EPIPE;
         goto out_locked;
       }
+
+      /* The pipe may be empty now, so check for a direct write again */
+      continue;
     }
 
     chunk = MIN(count - written, PIPE_SPACE(pipe));
@@ -408,10 +539,57 @@ int pipe_ioctl(
     PIPE_LOCK(pipe);
 
     /* Return length of pipe */
-    *(unsigned int *)buffer = pipe->Length;
+    *(unsigned int *)buffer = pipe->Length + pipe->DirectLength;
     PIPE_UNLOCK(pipe);
     return 0;
   }
 
+  if (cmd == RTEMS_IO_GET_PIPE_SIZE) {
+    if (buffer == NULL)
+      return -EFAULT;
+
+    PIPE_LOCK(pipe);
+    *(int *)buffer = (int) pipe->Capacity;
+    PIPE_UNLOCK(pipe);
+    return 0;
+  }
+
+  if (cmd == RTEMS_IO_SET_PIPE_SIZE) {
+    unsigned int capacity;
+    int size;
+    int err = 0;
+
+    if (buffer == NULL)
+      return -EFAULT;
+
+    size = *(int *)buffer;
+    if (size < 0)
+      return -EINVAL;
+
+    if (size > PIPE_MAX_CAPACITY)
+      return -EPERM;
+
+    capacity = roundup(MAX((unsigned int) size, PIPE_BUF), PIPE_BUF);
+
+    PIPE_LOCK(pipe);
+
+    if (capacity < pipe->Length)
+      err = -EBUSY;
+    else if (capacity < pipe->Size)
+      err = pipe_resize(pipe, capacity);
+
+    if (err == 0) {
+      pipe->Capacity = capacity;
+      *(int *)buffer = (int) capacity;
+
+      /* Waiting writers may now grow the pipe buffer */
+      if (pipe->waitingWriters > 0)
+        PIPE_WAKEUPWRITERS(pipe);
+    }
+
+    PIPE_UNLOCK(pipe);
+    return err;
+  }
+
   return -EINVAL;
 }
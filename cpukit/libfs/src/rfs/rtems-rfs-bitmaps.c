@@ -8,7 +8,8 @@
  * These functions manage bit maps. A bit map consists of the map of bit
  * allocated in a block and a search map where a bit represents 32 actual
  * bits. The search map allows for a faster search for an available bit as 32
- * search bits can checked in a test.
+ * search bits can checked in a test. The bits in an element are searched with
+ * the count leading and trailing zero instructions rather than one at a time.
  */
 
 /*
@@ -140,6 +141,90 @@ rtems_rfs_bitmap_match_masked (rtems_rfs_bitmap_element mask,
 }
 #endif
 
+/**
+ * Return a mask of the clear bits in an element. The mask has a 1 for each
+ * clear bit.
+ *
+ * @param bits The element.
+ * @return The mask of the clear bits.
+ */
+static rtems_rfs_bitmap_element
+rtems_rfs_bitmap_free_bits (rtems_rfs_bitmap_element bits)
+{
+#if RTEMS_RFS_BITMAP_CLEAR_ZERO
+  return RTEMS_RFS_BITMAP_INVERT_MASK (bits);
+#else
+  return bits;
+#endif
+}
+
+/**
+ * Return the lowest bit set in a mask. The mask cannot be 0.
+ */
+static int
+rtems_rfs_bitmap_first_bit (rtems_rfs_bitmap_element mask)
+{
+  return __builtin_ctz (mask);
+}
+
+/**
+ * Return the highest bit set in a mask. The mask cannot be 0.
+ */
+static int
+rtems_rfs_bitmap_last_bit (rtems_rfs_bitmap_element mask)
+{
+  return (rtems_rfs_bitmap_element_bits () - 1) - __builtin_clz (mask);
+}
+
+/**
+ * Return the length of the longest run of set bits in a mask. Each step
+ * shortens every run by 1 bit.
+ */
+static int
+rtems_rfs_bitmap_longest_run (rtems_rfs_bitmap_element mask)
+{
+  int length = 0;
+  while (mask)
+  {
+    mask &= mask >> 1;
+    length++;
+  }
+  return length;
+}
+
+/**
+ * Set the clear bits of a mask in an element of the map and update the free
+ * count, the search map and the free run limit.
+ *
+ * @param control The bitmap control.
+ * @param map The bitmap map data.
+ * @param index The index of the element.
+ * @param mask The bits to set. The bits must be clear.
+ */
+static void
+rtems_rfs_bitmap_set_element (rtems_rfs_bitmap_control* control,
+                              rtems_rfs_bitmap_map      map,
+                              int                       index,
+                              rtems_rfs_bitmap_element  mask)
+{
+  map[index] = rtems_rfs_bitmap_set (map[index], mask);
+  control->free -= __builtin_popcount (mask);
+  if (control->free_run > control->free)
+    control->free_run = control->free;
+
+  if (rtems_rfs_bitmap_match (map[index], RTEMS_RFS_BITMAP_ELEMENT_SET))
+  {
+    rtems_rfs_bitmap_map search_map = control->search_bits;
+    int                  search_index = rtems_rfs_bitmap_map_index (index);
+    int                  search_offset = rtems_rfs_bitmap_map_offset (index);
+    search_map[search_index] = rtems_rfs_bitmap_set (search_map[search_index],
+                                                     1 << search_offset);
+    rtems_rfs_bitmap_check(control, &search_map[search_index]);
+  }
+
+  rtems_rfs_buffer_mark_dirty (control->buffer);
+}
+
 /**
  * Return the map after loading from disk if not already loaded.
  *
@@ -218,6 +303,8 @@ rtems_rfs_bitmap_map_set (rtems_rfs_bitmap_control* control,
       return 0;
 
   control->free--;
+  if (control->free_run > control->free)
+    control->free_run = control->free;
 
   rtems_rfs_buffer_mark_dirty (control->buffer);
   if (rtems_rfs_bitmap_match(map[index], RTEMS_RFS_BITMAP_ELEMENT_SET))
@@ -271,6 +358,16 @@ rtems_rfs_bitmap_map_clear (rtems_rfs_bitmap_control* control,
   rtems_rfs_buffer_mark_dirty (control->buffer);
   control->free++;
 
+  /*
+   * The clear bit can join the runs either side of it so the longest run is
+   * at most twice the old limit plus the bit.
+   */
+  if (control->free_run < control->free)
+  {
+    size_t free_run = (control->free_run * 2) + 1;
+    control->free_run = free_run < control->free ? free_run : control->free;
+  }
+
   return 0;
 }
 
@@ -307,6 +404,7 @@ rtems_rfs_bitmap_map_set_all (rtems_rfs_bitmap_control* control)
   elements = rtems_rfs_bitmap_elements (control->size);
 
   control->free = 0;
+  control->free_run = 0;
 
   for (e = 0; e < elements; e++)
     map[e] = RTEMS_RFS_BITMAP_ELEMENT_SET;
@@ -337,6 +435,7 @@ rtems_rfs_bitmap_map_clear_all (rtems_rfs_bitmap_control* control)
   elements = rtems_rfs_bitmap_elements (control->size);
 
   control->free = control->size;
+  control->free_run = control->size;
 
   for (e = 0; e < elements; e++)
     map[e] = RTEMS_RFS_BITMAP_ELEMENT_CLEAR;
@@ -376,11 +475,9 @@ rtems_rfs_search_map_for_clear_bit (rtems_rfs_bitmap_control* control,
   rtems_rfs_bitmap_bit      test_bit;
   rtems_rfs_bitmap_bit      end_bit;
   rtems_rfs_bitmap_element* search_bits;
+  rtems_rfs_bitmap_element  bits;
   int                       search_index;
-  int                       search_offset;
-  rtems_rfs_bitmap_element* map_bits;
   int                       map_index;
-  int                       map_offset;
   int                       rc;
 
   *found = false;
@@ -403,112 +500,94 @@ rtems_rfs_search_map_for_clear_bit (rtems_rfs_bitmap_control* control,
   else if (end_bit >= control->size)
     end_bit = control->size - 1;
 
-  map_index     = rtems_rfs_bitmap_map_index (test_bit);
-  map_offset    = rtems_rfs_bitmap_map_offset (test_bit);
-  search_index  = rtems_rfs_bitmap_map_index (map_index);
-  search_offset = rtems_rfs_bitmap_map_offset (map_index);
-
-  search_bits = &control->search_bits[search_index];
-  map_bits    = &map[map_index];
+  search_bits = control->search_bits;
 
   /*
-   * Check each bit from the search map offset for a clear bit.
+   * Mask off the search bits and map bits behind the test bit then take the
+   * nearest clear bit left in the direction of the search. A search element
+   * with no clear bits skips all the map elements it covers.
    */
-  do
+  while (((direction > 0) && (test_bit <= end_bit))
+         || ((direction < 0) && (test_bit >= end_bit)))
   {
-    /*
-     * If any bit is clear find that bit and then search the map element. If
-     * all bits are set there are no map bits so move to the next search
-     * element.
-     */
-    if (!rtems_rfs_bitmap_match (*search_bits, RTEMS_RFS_BITMAP_ELEMENT_SET))
-    {
-      while ((search_offset >= 0)
-             && (search_offset < rtems_rfs_bitmap_element_bits ()))
-      {
-        if (!rtems_rfs_bitmap_test (*search_bits, search_offset))
-        {
-          /*
-           * Find the clear bit in the map. Update the search map and map if
-           * found. We may find none are spare if searching up from the seed.
-           */
-          while ((map_offset >= 0)
-                 && (map_offset < rtems_rfs_bitmap_element_bits ()))
-          {
-            if (!rtems_rfs_bitmap_test (*map_bits, map_offset))
-            {
-              *map_bits = rtems_rfs_bitmap_set (*map_bits, 1 << map_offset);
-              if (rtems_rfs_bitmap_match(*map_bits,
-                                         RTEMS_RFS_BITMAP_ELEMENT_SET))
-                *search_bits = rtems_rfs_bitmap_set (*search_bits,
-                                                     1 << search_offset);
-              control->free--;
-              *bit = test_bit;
-              *found = true;
-              rtems_rfs_buffer_mark_dirty (control->buffer);
-              return 0;
-            }
+    int found_index;
+    int offset;
 
-            if (test_bit == end_bit)
-              break;
+    map_index    = rtems_rfs_bitmap_map_index (test_bit);
+    search_index = rtems_rfs_bitmap_map_index (map_index);
+    offset       = rtems_rfs_bitmap_map_offset (map_index);
 
-            map_offset += direction;
-            test_bit   += direction;
-          }
-        }
-
-        map_bits  += direction;
-        map_index += direction;
-        map_offset = direction > 0 ? 0 : rtems_rfs_bitmap_element_bits () - 1;
+    bits = rtems_rfs_bitmap_free_bits (search_bits[search_index]);
+    if (direction > 0)
+      bits &= rtems_rfs_bitmap_mask_section (offset,
+                                             rtems_rfs_bitmap_element_bits ());
+    else
+      bits &= rtems_rfs_bitmap_mask (offset + 1);
 
-        test_bit = (map_index * rtems_rfs_bitmap_element_bits ()) + map_offset;
+    if (bits == 0)
+    {
+      test_bit = search_index * rtems_rfs_bitmap_search_element_bits ();
+      if (direction > 0)
+        test_bit += rtems_rfs_bitmap_search_element_bits ();
+      else
+        test_bit -= 1;
+      continue;
+    }
 
-        search_offset += direction;
+    if (direction > 0)
+      found_index = rtems_rfs_bitmap_first_bit (bits);
+    else
+      found_index = rtems_rfs_bitmap_last_bit (bits);
+    found_index += search_index * rtems_rfs_bitmap_element_bits ();
 
-        if (((direction < 0) && (test_bit <= end_bit))
-            || ((direction > 0) && (test_bit >= end_bit)))
-          break;
-      }
+    if (found_index != map_index)
+    {
+      map_index = found_index;
+      test_bit = map_index * rtems_rfs_bitmap_element_bits ();
+      if (direction < 0)
+        test_bit += rtems_rfs_bitmap_element_bits () - 1;
+      else if (test_bit > end_bit)
+        break;
     }
+
+    offset = rtems_rfs_bitmap_map_offset (test_bit);
+
+    bits = rtems_rfs_bitmap_free_bits (map[map_index]);
+    if (direction > 0)
+      bits &= rtems_rfs_bitmap_mask_section (offset,
+                                             rtems_rfs_bitmap_element_bits ());
     else
+      bits &= rtems_rfs_bitmap_mask (offset + 1);
+
+    if (bits != 0)
     {
-      /*
-       * Move to the next search element. We need to determine the number of
-       * bits in the search offset that are being skipped so the map bits
-       * pointer can be updated. If we are moving down and we have a search
-       * offset of 0 then the search map adjustment is to the top bit of the
-       * pervious search bit's value.
-       *
-       * Align test_bit either up or down depending on the direction to next 32
-       * bit boundary.
-       */
-      rtems_rfs_bitmap_bit bits_skipped;
-      test_bit &= ~((1 << RTEMS_RFS_ELEMENT_BITS_POWER_2) - 1);
       if (direction > 0)
-      {
-        bits_skipped = rtems_rfs_bitmap_element_bits () - search_offset;
-        test_bit += bits_skipped * rtems_rfs_bitmap_element_bits ();
-        map_offset = 0;
-      }
+        offset = rtems_rfs_bitmap_first_bit (bits);
       else
-      {
-        bits_skipped = search_offset + 1;
-        /*
-         * Need to remove 1 for the rounding up. The above rounds down and
-         * adds 1. Remember the logic is for subtraction.
-         */
-        test_bit -= ((bits_skipped - 1) * rtems_rfs_bitmap_element_bits ()) + 1;
-        map_offset = rtems_rfs_bitmap_element_bits () - 1;
-      }
-      map_bits += direction * bits_skipped;
-      map_index += direction * bits_skipped;
+        offset = rtems_rfs_bitmap_last_bit (bits);
+
+      test_bit = (map_index * rtems_rfs_bitmap_element_bits ()) + offset;
+
+      if (((direction > 0) && (test_bit > end_bit))
+          || ((direction < 0) && (test_bit < end_bit)))
+        break;
+
+      rtems_rfs_bitmap_set_element (control, map, map_index, 1 << offset);
+      *bit = test_bit;
+      *found = true;
+      return 0;
     }
 
-    search_bits  += direction;
-    search_offset = direction > 0 ? 0 : rtems_rfs_bitmap_element_bits () - 1;
+    /*
+     * The clear bits in the element are behind the test bit. Move to the next
+     * element.
+     */
+    test_bit = map_index * rtems_rfs_bitmap_element_bits ();
+    if (direction > 0)
+      test_bit += rtems_rfs_bitmap_element_bits ();
+    else
+      test_bit -= 1;
   }
-  while (((direction < 0) && (test_bit >= end_bit))
-         || ((direction > 0) && (test_bit <= end_bit)));
 
   return 0;
 }
@@ -589,12 +668,257 @@ rtems_rfs_bitmap_map_alloc (rtems_rfs_bitmap_control* control,
   return 0;
 }
 
+/**
+ * Search a range of the map for a run of clear bits. The longest run found is
+ * returned if there is no run of the requested length.
+ *
+ * @param control The bitmap control.
+ * @param map The bitmap map data.
+ * @param from The first bit of the range.
+ * @param to The bit after the end of the range.
+ * @param count The length of the run.
+ * @param start The first bit of the run if found.
+ * @param longest The longest run found is updated if no run is found.
+ * @retval true A run was found.
+ * @retval false No run was found.
+ */
+static bool
+rtems_rfs_bitmap_search_run (rtems_rfs_bitmap_control* control,
+                             rtems_rfs_bitmap_map      map,
+                             rtems_rfs_bitmap_bit      from,
+                             rtems_rfs_bitmap_bit      to,
+                             size_t                    count,
+                             rtems_rfs_bitmap_bit*     start,
+                             size_t*                   longest)
+{
+  rtems_rfs_bitmap_bit test_bit = from;
+  size_t               length = 0;
+
+  while (test_bit < to)
+  {
+    rtems_rfs_bitmap_element bits;
+    rtems_rfs_bitmap_element used;
+    int                      map_index;
+    int                      offset;
+    int                      end;
+
+    map_index = rtems_rfs_bitmap_map_index (test_bit);
+    offset    = rtems_rfs_bitmap_map_offset (test_bit);
+
+    /*
+     * Outside a run full elements are skipped using the search map.
+     */
+    if (length == 0)
+    {
+      rtems_rfs_bitmap_element search;
+
+      search = control->search_bits[rtems_rfs_bitmap_map_index (map_index)];
+
+      if (rtems_rfs_bitmap_match (search, RTEMS_RFS_BITMAP_ELEMENT_SET))
+      {
+        test_bit = (rtems_rfs_bitmap_map_index (map_index) + 1) *
+          rtems_rfs_bitmap_search_element_bits ();
+        continue;
+      }
+
+      if (rtems_rfs_bitmap_test (search,
+                                 rtems_rfs_bitmap_map_offset (map_index)))
+      {
+        test_bit = (map_index + 1) * rtems_rfs_bitmap_element_bits ();
+        continue;
+      }
+    }
+
+    bits = rtems_rfs_bitmap_free_bits (map[map_index]);
+    bits &= rtems_rfs_bitmap_mask_section (offset,
+                                           rtems_rfs_bitmap_element_bits ());
+    if ((to - (map_index * rtems_rfs_bitmap_element_bits ()))
+        < rtems_rfs_bitmap_element_bits ())
+      bits &= rtems_rfs_bitmap_mask (to - (map_index *
+                                           rtems_rfs_bitmap_element_bits ()));
+
+    if (length == 0)
+    {
+      if (bits == 0)
+      {
+        test_bit = (map_index + 1) * rtems_rfs_bitmap_element_bits ();
+        continue;
+      }
+      offset = rtems_rfs_bitmap_first_bit (bits);
+      *start = (map_index * rtems_rfs_bitmap_element_bits ()) + offset;
+    }
+
+    /*
+     * The run ends at the first set bit after the offset.
+     */
+    used = RTEMS_RFS_BITMAP_INVERT_MASK (bits) &
+      rtems_rfs_bitmap_mask_section (offset, rtems_rfs_bitmap_element_bits ());
+    if (used)
+      end = rtems_rfs_bitmap_first_bit (used);
+    else
+      end = rtems_rfs_bitmap_element_bits ();
+
+    length += end - offset;
+    if (length >= count)
+      return true;
+
+    if (end < rtems_rfs_bitmap_element_bits ())
+    {
+      if (length > *longest)
+        *longest = length;
+      length = 0;
+    }
+
+    test_bit = (map_index * rtems_rfs_bitmap_element_bits ()) + end;
+  }
+
+  if (length > *longest)
+    *longest = length;
+
+  return false;
+}
+
+int
+rtems_rfs_bitmap_map_alloc_run (rtems_rfs_bitmap_control* control,
+                                rtems_rfs_bitmap_bit      seed,
+                                size_t                    count,
+                                bool*                     allocated,
+                                rtems_rfs_bitmap_bit*     bit)
+{
+  rtems_rfs_bitmap_map map;
+  rtems_rfs_bitmap_bit start;
+  rtems_rfs_bitmap_bit end;
+  size_t               longest;
+  bool                 found;
+  int                  rc;
+
+  *allocated = false;
+
+  /*
+   * The free run limit avoids searching maps that cannot hold the run.
+   */
+  if ((count == 0) || (count > control->free_run))
+    return 0;
+
+  rc = rtems_rfs_bitmap_load_map (control, &map);
+  if (rc > 0)
+    return rc;
+
+  if ((seed < 0) || (seed >= control->size))
+    seed = 0;
+
+  longest = 0;
+
+  found = rtems_rfs_bitmap_search_run (control, map, seed, control->size,
+                                       count, &start, &longest);
+
+  /*
+   * Wrap to the start of the map. A run that starts before the seed can cross
+   * it so search up to the last bit such a run can end on.
+   */
+  if (!found && (seed > 0))
+  {
+    end = seed + count - 1;
+    if (end > control->size)
+      end = control->size;
+    found = rtems_rfs_bitmap_search_run (control, map, 0, end,
+                                         count, &start, &longest);
+  }
+
+  if (!found)
+  {
+    /*
+     * The whole map has been searched so the longest run is known.
+     */
+    control->free_run = longest;
+    return 0;
+  }
+
+  *bit = start;
+  *allocated = true;
+
+  end = start + count;
+  while (start < end)
+  {
+    int offset = rtems_rfs_bitmap_map_offset (start);
+    int bits = rtems_rfs_bitmap_element_bits () - offset;
+
+    if (bits > (end - start))
+      bits = end - start;
+
+    rtems_rfs_bitmap_set_element (control, map,
+                                  rtems_rfs_bitmap_map_index (start),
+                                  rtems_rfs_bitmap_mask_section (offset,
+                                                                 offset + bits));
+    start += bits;
+  }
+
+  return 0;
+}
+
+int
+rtems_rfs_bitmap_map_set_run (rtems_rfs_bitmap_control* control,
+                              rtems_rfs_bitmap_bit      bit,
+                              size_t                    count,
+                              size_t*                   set)
+{
+  rtems_rfs_bitmap_map map;
+  int                  rc;
+
+  *set = 0;
+
+  rc = rtems_rfs_bitmap_load_map (control, &map);
+  if (rc > 0)
+    return rc;
+
+  if (bit >= control->size)
+    return EINVAL;
+
+  while ((*set < count) && (bit < control->size))
+  {
+    rtems_rfs_bitmap_element mask;
+    rtems_rfs_bitmap_element used;
+    int                      index = rtems_rfs_bitmap_map_index (bit);
+    int                      offset = rtems_rfs_bitmap_map_offset (bit);
+    size_t                   bits = rtems_rfs_bitmap_element_bits () - offset;
+    size_t                   length;
+
+    if (bits > (count - *set))
+      bits = count - *set;
+    if (bits > (control->size - bit))
+      bits = control->size - bit;
+
+    mask = rtems_rfs_bitmap_mask_section (offset, offset + bits);
+    used = RTEMS_RFS_BITMAP_INVERT_MASK (rtems_rfs_bitmap_free_bits (map[index]));
+    used &= mask;
+
+    if (used)
+      length = rtems_rfs_bitmap_first_bit (used) - offset;
+    else
+      length = bits;
+
+    if (length > 0)
+      rtems_rfs_bitmap_set_element (control, map, index,
+                                    rtems_rfs_bitmap_mask_section (offset,
+                                                                   offset + length));
+
+    *set += length;
+    bit += length;
+
+    if (length < bits)
+      break;
+  }
+
+  return 0;
+}
+
 int
 rtems_rfs_bitmap_create_search (rtems_rfs_bitmap_control* control)
 {
   rtems_rfs_bitmap_map search_map;
   rtems_rfs_bitmap_map map;
   size_t               size;
+  size_t               run;
   rtems_rfs_bitmap_bit bit;
   int                  rc;
 
@@ -603,9 +927,11 @@ rtems_rfs_bitmap_create_search (rtems_rfs_bitmap_control* control)
     return rc;
 
   control->free = 0;
+  control->free_run = 0;
   search_map = control->search_bits;
   size = control->size;
   bit = 0;
+  run = 0;
 
   rtems_rfs_bitmap_check(control, search_map);
   *search_map = RTEMS_RFS_BITMAP_ELEMENT_CLEAR;
@@ -627,13 +953,31 @@ rtems_rfs_bitmap_create_search (rtems_rfs_bitmap_control* control)
     }
 
     if (rtems_rfs_bitmap_match (bits, RTEMS_RFS_BITMAP_ELEMENT_SET))
-      rtems_rfs_bitmap_set (*search_map, bit);
+      *search_map = rtems_rfs_bitmap_set (*search_map, 1 << bit);
+
+    /*
+     * Count the clear bits and track the run of clear bits that crosses the
+     * element boundaries as well as any run inside the element.
+     */
+    bits = rtems_rfs_bitmap_free_bits (bits);
+    control->free += __builtin_popcount (bits);
+
+    if (rtems_rfs_bitmap_match (bits, RTEMS_RFS_BITMAP_ELEMENT_FULL_MASK))
+      run += rtems_rfs_bitmap_element_bits ();
     else
     {
-      int b;
-      for (b = 0; b < available; b++)
-        if (!rtems_rfs_bitmap_test (bits, b))
-          control->free++;
+      rtems_rfs_bitmap_element used = RTEMS_RFS_BITMAP_INVERT_MASK (bits);
+      run += rtems_rfs_bitmap_first_bit (used);
+      if (run > control->free_run)
+        control->free_run = run;
+      if ((size_t) __builtin_popcount (bits) > control->free_run)
+      {
+        size_t longest = rtems_rfs_bitmap_longest_run (bits);
+        if (longest > control->free_run)
+          control->free_run = longest;
+      }
+      run = (rtems_rfs_bitmap_element_bits () - 1) -
+        rtems_rfs_bitmap_last_bit (used);
     }
 
     size -= available;
@@ -654,6 +998,9 @@ rtems_rfs_bitmap_create_search (rtems_rfs_bitmap_control* control)
     map++;
   }
 
+  if (run > control->free_run)
+    control->free_run = run;
+
   return 0;
 }
 
@@ -107,6 +107,8 @@ rtems_rfs_block_map_open (rtems_rfs_file_system*  fs,
 
   map->dirty = false;
   map->inode = NULL;
+  map->reserved = 0;
+  map->reserved_count = 0;
   rtems_rfs_block_set_size_zero (&map->size);
   rtems_rfs_block_set_bpos_zero (&map->bpos);
 
@@ -142,6 +144,27 @@ rtems_rfs_block_map_open (rtems_rfs_file_system*  fs,
   return rc;
 }
 
+int
+rtems_rfs_block_map_release_reserve (rtems_rfs_file_system* fs,
+                                     rtems_rfs_block_map*   map)
+{
+  int rc = 0;
+
+  while (map->reserved_count)
+  {
+    int brc;
+
+    brc = rtems_rfs_group_bitmap_free (fs, false, map->reserved);
+    if ((brc > 0) && (rc == 0))
+      rc = brc;
+
+    map->reserved++;
+    map->reserved_count--;
+  }
+
+  return rc;
+}
+
 int
 rtems_rfs_block_map_close (rtems_rfs_file_system* fs,
                            rtems_rfs_block_map*   map)
@@ -176,6 +199,10 @@ rtems_rfs_block_map_close (rtems_rfs_file_system* fs,
 
   map->inode = NULL;
 
+  brc = rtems_rfs_block_map_release_reserve (fs, map);
+  if ((brc > 0) && (rc == 0))
+    rc = brc;
+
   brc = rtems_rfs_buffer_handle_close (fs, &map->singly_buffer);
   if ((brc > 0) && (rc == 0))
     rc = brc;
@@ -402,6 +429,44 @@ rtems_rfs_block_map_indirect_alloc (rtems_rfs_file_system*   fs,
   return 0;
 }
 
+int
+rtems_rfs_block_map_reserve (rtems_rfs_file_system* fs,
+                             rtems_rfs_block_map*   map,
+                             size_t                 blocks)
+{
+  rtems_rfs_bitmap_bit block;
+  size_t               count;
+  int                  rc;
+
+  if (map->reserved_count)
+    return 0;
+
+  /*
+   * Only reserve the blocks asked for. Blocks reserved ahead of the map would
+   * be marked as used on disk and lost if the system stopped before they are
+   * released.
+   */
+  count = blocks;
+  if (count > (rtems_rfs_fs_max_block_map_blocks (fs) - map->size.count))
+    count = rtems_rfs_fs_max_block_map_blocks (fs) - map->size.count;
+  if (count == 0)
+    count = 1;
+
+  rc = rtems_rfs_group_bitmap_alloc_run (fs, map->last_data_block,
+                                         count, &block, &count);
+  if (rc > 0)
+    return rc;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_BLOCK_MAP_GROW))
+    printf ("rtems-rfs: block-map-reserve: block=%" PRIu32 " count=%zu\n",
+            block, count);
+
+  map->reserved = block;
+  map->reserved_count = count;
+
+  return 0;
+}
+
 int
 rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
                           rtems_rfs_block_map*   map,
@@ -418,7 +483,7 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
     return EFBIG;
 
   /*
-   * Allocate a block at a time. The buffer handles hold the blocks so adding
+   * Add a block at a time. The buffer handles hold the blocks so adding
    * this way does not thrash the cache with lots of requests.
    */
   for (b = 0; b < blocks; b++)
@@ -427,14 +492,20 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
     int                  rc;
 
     /*
-     * Allocate the block. If an indirect block is needed and cannot be
-     * allocated free this block.
+     * Take the block from the reservation reserving a run of blocks if none
+     * are left. If an indirect block is needed and cannot be allocated free
+     * this block.
      */
+    if (map->reserved_count == 0)
+    {
+      rc = rtems_rfs_block_map_reserve (fs, map, blocks - b);
+      if (rc > 0)
+        return rc;
+    }
 
-    rc = rtems_rfs_group_bitmap_alloc (fs, map->last_data_block,
-                                       false, &block);
-    if (rc > 0)
-      return rc;
+    block = map->reserved;
+    map->reserved++;
+    map->reserved_count--;
 
     if (map->size.count < RTEMS_RFS_INODE_BLOCKS)
       map->blocks[map->size.count] = block;
@@ -650,10 +721,20 @@ rtems_rfs_block_map_shrink (rtems_rfs_file_system* fs,
                             rtems_rfs_block_map*   map,
                             size_t                 blocks)
 {
+  int rc;
+
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_BLOCK_MAP_SHRINK))
     printf ("rtems-rfs: block-map-shrink: entry: blocks=%zd count=%" PRIu32 "\n",
             blocks, map->size.count);
 
+  /*
+   * The reserved blocks follow the end of the map and a shrunk map has a new
+   * end.
+   */
+  rc = rtems_rfs_block_map_release_reserve (fs, map);
+  if (rc > 0)
+    return rc;
+
   if (map->size.count == 0)
     return 0;
 
@@ -664,7 +745,6 @@ rtems_rfs_block_map_shrink (rtems_rfs_file_system* fs,
   {
     rtems_rfs_block_no block;
     rtems_rfs_block_no block_to_free;
-    int                rc;
 
     block = map->size.count - 1;
 
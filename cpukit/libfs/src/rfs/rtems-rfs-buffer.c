@@ -27,6 +27,52 @@
 #include <rtems/rfs/rtems-rfs-buffer.h>
 #include <rtems/rfs/rtems-rfs-file-system.h>
 
+/**
+ * A block requested from the I/O layer. The buffer lock is released while the
+ * I/O layer is called. Requests of the same block wait on the waiters list
+ * until the request has finished so a block is only ever requested from the
+ * I/O layer once.
+ */
+typedef struct
+{
+  rtems_chain_node       link;
+  rtems_rfs_buffer_block block;
+  rtems_chain_control    waiters;
+} rtems_rfs_buffer_io_request_control;
+
+/**
+ * A request waiting for the I/O request of the same block.
+ */
+typedef struct
+{
+  rtems_chain_node       link;
+#if __rtems__
+  rtems_binary_semaphore done;
+#endif
+} rtems_rfs_buffer_io_waiter;
+
+/**
+ * Lock the buffer lists.
+ *
+ * @param fs The file system data.
+ */
+static void
+rtems_rfs_buffer_lock (rtems_rfs_file_system* fs)
+{
+  rtems_rfs_mutex_lock (&fs->buffer_lock);
+}
+
+/**
+ * Unlock the buffer lists.
+ *
+ * @param fs The file system data.
+ */
+static void
+rtems_rfs_buffer_unlock (rtems_rfs_file_system* fs)
+{
+  rtems_rfs_mutex_unlock (&fs->buffer_lock);
+}
+
 /**
  * Scan the chain for a buffer that matches the block number.
  *
@@ -75,6 +121,85 @@ rtems_rfs_scan_chain (rtems_chain_control*   chain,
   return NULL;
 }
 
+/**
+ * Find the I/O request of a block.
+ *
+ * @param fs The file system data.
+ * @param block The block number to find.
+ * @return rtems_rfs_buffer_io_request_control* The request if found else NULL.
+ */
+static rtems_rfs_buffer_io_request_control*
+rtems_rfs_buffer_find_io_request (rtems_rfs_file_system* fs,
+                                  rtems_rfs_buffer_block block)
+{
+  rtems_chain_node* node;
+
+  node = rtems_chain_first (&fs->buffer_io_requests);
+
+  while (!rtems_chain_is_tail (&fs->buffer_io_requests, node))
+  {
+    rtems_rfs_buffer_io_request_control* request;
+
+    request = (rtems_rfs_buffer_io_request_control*) node;
+    if (request->block == block)
+      return request;
+
+    node = rtems_chain_next (node);
+  }
+
+  return NULL;
+}
+
+/**
+ * Wait for the I/O request of a block to finish. The buffer lock is released
+ * while waiting and held again on return.
+ *
+ * @param fs The file system data.
+ * @param request The I/O request to wait for.
+ */
+static void
+rtems_rfs_buffer_wait_for_io_request (rtems_rfs_file_system*               fs,
+                                      rtems_rfs_buffer_io_request_control* request)
+{
+  rtems_rfs_buffer_io_waiter waiter;
+
+#if __rtems__
+  rtems_binary_semaphore_init (&waiter.done, "RFS Buffer");
+#endif
+  rtems_chain_append_unprotected (&request->waiters, &waiter.link);
+  rtems_rfs_buffer_unlock (fs);
+#if __rtems__
+  rtems_binary_semaphore_wait (&waiter.done);
+  rtems_binary_semaphore_destroy (&waiter.done);
+#endif
+  rtems_rfs_buffer_lock (fs);
+}
+
+/**
+ * Finish the I/O request of a block and wake up the waiting requests. The
+ * buffer lock shall be held.
+ *
+ * @param request The finished I/O request.
+ */
+static void
+rtems_rfs_buffer_finish_io_request (rtems_rfs_buffer_io_request_control* request)
+{
+  rtems_chain_extract_unprotected (&request->link);
+
+  while (!rtems_chain_is_empty (&request->waiters))
+  {
+    rtems_rfs_buffer_io_waiter* waiter;
+
+    waiter = (rtems_rfs_buffer_io_waiter*)
+      rtems_chain_get_first_unprotected (&request->waiters);
+#if __rtems__
+    rtems_binary_semaphore_post (&waiter->done);
+#else
+    (void) waiter;
+#endif
+  }
+}
+
 int
 rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
                                  rtems_rfs_buffer_handle* handle,
@@ -109,6 +234,10 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
     printf ("rtems-rfs: buffer-request: block=%" PRIu32 "\n", block);
 
+  rtems_rfs_buffer_lock (fs);
+
+ again:
+
   /*
    * First check to see if the buffer has already been requested and is
    * currently attached to a handle. If it is share the access. A buffer could
@@ -161,17 +290,40 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
   }
 
   /*
-   * If not located we request the buffer from the I/O layer.
+   * If not located we request the buffer from the I/O layer. The buffer lock
+   * is released while the I/O layer is called. If another request of the
+   * block is in progress wait for it to finish and scan the lists again since
+   * the block is now attached to a handle or held in the local cache.
    */
   if (!rtems_rfs_buffer_handle_has_block (handle))
   {
+    rtems_rfs_buffer_io_request_control* request;
+    rtems_rfs_buffer_io_request_control  own_request;
+
+    request = rtems_rfs_buffer_find_io_request (fs, block);
+    if (request != NULL)
+    {
+      rtems_rfs_buffer_wait_for_io_request (fs, request);
+      goto again;
+    }
+
+    own_request.block = block;
+    rtems_chain_initialize_empty (&own_request.waiters);
+    rtems_chain_append_unprotected (&fs->buffer_io_requests,
+                                    &own_request.link);
+    rtems_rfs_buffer_unlock (fs);
+
     rc = rtems_rfs_buffer_io_request (fs, block, read, &handle->buffer);
 
+    rtems_rfs_buffer_lock (fs);
+    rtems_rfs_buffer_finish_io_request (&own_request);
+
     if (rc > 0)
     {
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
         printf ("rtems-rfs: buffer-request: block=%" PRIu32 ": bdbuf-%s: %d: %s\n",
                 block, read ? "read" : "get", rc, strerror (rc));
+      rtems_rfs_buffer_unlock (fs);
       return rc;
     }
 
@@ -194,6 +346,8 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
             block, read ? "read" : "get", handle->buffer->block,
             handle->buffer->references);
 
+  rtems_rfs_buffer_unlock (fs);
+
   return 0;
 }
 
@@ -205,6 +359,8 @@ rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
 
   if (rtems_rfs_buffer_handle_has_block (handle))
   {
+    rtems_rfs_buffer_lock (fs);
+
     if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_RELEASE))
       printf ("rtems-rfs: buffer-release: block=%" PRIu32 " %s refs=%d %s\n",
               rtems_rfs_buffer_bnum (handle),
@@ -280,6 +436,8 @@ rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
       }
     }
     handle->buffer = NULL;
+
+    rtems_rfs_buffer_unlock (fs);
   }
 
   return rc;
@@ -468,6 +626,8 @@ rtems_rfs_buffers_release (rtems_rfs_file_system* fs)
   int rrc = 0;
   int rc;
 
+  rtems_rfs_buffer_lock (fs);
+
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_RELEASE))
     printf ("rtems-rfs: buffers-release: active:%" PRIu32 " "
             "release:%" PRIu32 " release-modified:%" PRIu32 "\n",
@@ -484,5 +644,7 @@ rtems_rfs_buffers_release (rtems_rfs_file_system* fs)
   if ((rc > 0) && (rrc == 0))
     rrc = rc;
 
+  rtems_rfs_buffer_unlock (fs);
+
   return rrc;
 }
@@ -0,0 +1,327 @@
+/**
+ * @file
+ *
+ * @ingroup rtems_rfs
+ *
+ * @brief RTEMS File Systems Directory Index Routines
+ *
+ * The index is an open addressed hash table using linear probing. Removal
+ * shifts the following entries of a probe sequence back so no tombstones are
+ * needed and the table never needs to be cleaned.
+ */
+
+/*
+ *  Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/rfs/rtems-rfs-dir-index.h>
+#include <rtems/rfs/rtems-rfs-trace.h>
+
+/**
+ * The initial number of slots in the hash table. Must be a power of 2.
+ */
+#define RTEMS_RFS_DIR_INDEX_INITIAL_SLOTS (256)
+
+static void
+rtems_rfs_dir_index_free (rtems_rfs_dir_index* index)
+{
+  free (index->slots);
+  free (index->used);
+  free (index);
+}
+
+static void
+rtems_rfs_dir_index_release (rtems_rfs_file_system* fs,
+                             rtems_rfs_dir_index*   index)
+{
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+    printf ("rtems-rfs: dir-index: release: ino=%" PRIu32 " entries=%" PRIu32 "\n",
+            index->ino, index->entries);
+  rtems_chain_extract_unprotected (&index->link);
+  --fs->dir_index_count;
+  rtems_rfs_dir_index_free (index);
+}
+
+rtems_rfs_dir_index*
+rtems_rfs_dir_index_find (rtems_rfs_file_system* fs,
+                          rtems_rfs_ino          ino)
+{
+  rtems_chain_node* node;
+
+  ++fs->dir_index_clock;
+
+  node = rtems_chain_first (&fs->dir_indexes);
+
+  while (!rtems_chain_is_tail (&fs->dir_indexes, node))
+  {
+    rtems_rfs_dir_index* index = (rtems_rfs_dir_index*) node;
+
+    if (index->ino == ino)
+    {
+      if (!rtems_chain_is_first (node))
+      {
+        rtems_chain_extract_unprotected (node);
+        rtems_chain_prepend_unprotected (&fs->dir_indexes, node);
+      }
+      index->last_used = fs->dir_index_clock;
+      return index;
+    }
+
+    node = rtems_chain_next (node);
+  }
+
+  return NULL;
+}
+
+rtems_rfs_dir_index*
+rtems_rfs_dir_index_create (rtems_rfs_file_system* fs,
+                            rtems_rfs_ino          ino)
+{
+  rtems_rfs_dir_index* index;
+
+  if (fs->max_dir_indexes == 0)
+    return NULL;
+
+  if (fs->dir_index_count >= fs->max_dir_indexes)
+  {
+    index = (rtems_rfs_dir_index*) rtems_chain_last (&fs->dir_indexes);
+
+    /*
+     * If the least recently used index has been used recently the working
+     * set of large directories is bigger than the indexes. Releasing it would
+     * have indexes built and released over and over so do not index the
+     * directory.
+     */
+    if ((fs->dir_index_clock - index->last_used) <
+        (fs->max_dir_indexes * RTEMS_RFS_DIR_INDEX_REUSE_FACTOR))
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+        printf ("rtems-rfs: dir-index: create: ino=%" PRIu32 ": all in use\n",
+                ino);
+      return NULL;
+    }
+
+    rtems_rfs_dir_index_release (fs, index);
+  }
+
+  index = calloc (1, sizeof (rtems_rfs_dir_index));
+  if (!index)
+    return NULL;
+
+  index->slots = calloc (RTEMS_RFS_DIR_INDEX_INITIAL_SLOTS,
+                         sizeof (rtems_rfs_dir_index_slot));
+  if (!index->slots)
+  {
+    free (index);
+    return NULL;
+  }
+
+  index->ino = ino;
+  index->last_used = fs->dir_index_clock;
+  index->mask = RTEMS_RFS_DIR_INDEX_INITIAL_SLOTS - 1;
+
+  rtems_chain_prepend_unprotected (&fs->dir_indexes, &index->link);
+  ++fs->dir_index_count;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+    printf ("rtems-rfs: dir-index: create: ino=%" PRIu32 "\n", ino);
+
+  return index;
+}
+
+void
+rtems_rfs_dir_index_drop (rtems_rfs_file_system* fs, rtems_rfs_ino ino)
+{
+  rtems_rfs_dir_index* index;
+
+  index = rtems_rfs_dir_index_find (fs, ino);
+  if (index)
+    rtems_rfs_dir_index_release (fs, index);
+}
+
+void
+rtems_rfs_dir_index_drop_all (rtems_rfs_file_system* fs)
+{
+  while (!rtems_chain_is_empty (&fs->dir_indexes))
+    rtems_rfs_dir_index_release (fs,
+      (rtems_rfs_dir_index*) rtems_chain_first (&fs->dir_indexes));
+}
+
+static void
+rtems_rfs_dir_index_insert (rtems_rfs_dir_index_slot* slots,
+                            uint32_t                  mask,
+                            uint32_t                  hash,
+                            uint32_t                  bno)
+{
+  uint32_t s = hash & mask;
+
+  while (slots[s].bno != 0)
+    s = (s + 1) & mask;
+
+  slots[s].hash = hash;
+  slots[s].bno = bno;
+}
+
+int
+rtems_rfs_dir_index_add (rtems_rfs_dir_index* index,
+                         uint32_t             hash,
+                         rtems_rfs_block_no   bno)
+{
+  /*
+   * Keep the load below 3/4 so the probe sequences stay short.
+   */
+  if (((index->entries + 1) * 4) > ((index->mask + 1) * 3))
+  {
+    rtems_rfs_dir_index_slot* slots;
+    uint32_t                  mask;
+    uint32_t                  s;
+
+    mask = (index->mask << 1) | 1;
+    slots = calloc (mask + 1, sizeof (rtems_rfs_dir_index_slot));
+    if (!slots)
+      return ENOMEM;
+
+    for (s = 0; s <= index->mask; s++)
+      if (index->slots[s].bno != 0)
+        rtems_rfs_dir_index_insert (slots, mask,
+                                    index->slots[s].hash,
+                                    index->slots[s].bno);
+
+    free (index->slots);
+    index->slots = slots;
+    index->mask = mask;
+  }
+
+  rtems_rfs_dir_index_insert (index->slots, index->mask, hash, bno + 1);
+  ++index->entries;
+
+  return 0;
+}
+
+bool
+rtems_rfs_dir_index_remove (rtems_rfs_dir_index* index,
+                            uint32_t             hash,
+                            rtems_rfs_block_no   bno)
+{
+  rtems_rfs_dir_index_slot* slots = index->slots;
+  uint32_t                  mask = index->mask;
+  uint32_t                  s = hash & mask;
+  uint32_t                  n;
+
+  while ((slots[s].bno != 0) &&
+         ((slots[s].hash != hash) || (slots[s].bno != (bno + 1))))
+    s = (s + 1) & mask;
+
+  if (slots[s].bno == 0)
+    return false;
+
+  /*
+   * Shift back any entry in the rest of the probe sequence that would not be
+   * found with the hole in the sequence.
+   */
+  n = (s + 1) & mask;
+
+  while (slots[n].bno != 0)
+  {
+    uint32_t home = slots[n].hash & mask;
+
+    if (((n - home) & mask) >= ((n - s) & mask))
+    {
+      slots[s] = slots[n];
+      s = n;
+    }
+
+    n = (n + 1) & mask;
+  }
+
+  slots[s].bno = 0;
+  --index->entries;
+
+  return true;
+}
+
+bool
+rtems_rfs_dir_index_next (const rtems_rfs_dir_index* index,
+                          uint32_t                   hash,
+                          uint32_t*                  iterator,
+                          rtems_rfs_block_no*        bno)
+{
+  const rtems_rfs_dir_index_slot* slots = index->slots;
+  uint32_t                        mask = index->mask;
+
+  while (*iterator <= mask)
+  {
+    uint32_t s = (hash + *iterator) & mask;
+
+    ++(*iterator);
+
+    if (slots[s].bno == 0)
+      break;
+
+    if (slots[s].hash == hash)
+    {
+      *bno = slots[s].bno - 1;
+      return true;
+    }
+  }
+
+  *iterator = mask + 1;
+  return false;
+}
+
+int
+rtems_rfs_dir_index_set_used (rtems_rfs_dir_index* index,
+                              rtems_rfs_block_no   bno,
+                              uint32_t             used)
+{
+  if (bno >= index->used_size)
+  {
+    uint32_t  size;
+    uint32_t* table;
+
+    size = index->used_size ? index->used_size * 2 : 64;
+    while (size <= bno)
+      size *= 2;
+
+    table = realloc (index->used, size * sizeof (uint32_t));
+    if (!table)
+      return ENOMEM;
+
+    index->used = table;
+    index->used_size = size;
+  }
+
+  index->used[bno] = used;
+
+  if (bno >= index->blocks)
+    index->blocks = bno + 1;
+
+  return 0;
+}
+
+rtems_rfs_block_no
+rtems_rfs_dir_index_space (const rtems_rfs_dir_index* index,
+                           size_t                     block_size,
+                           size_t                     size)
+{
+  rtems_rfs_block_no bno;
+
+  for (bno = 0; bno < index->blocks; bno++)
+    if (size < (block_size - index->used[bno]))
+      break;
+
+  return bno;
+}
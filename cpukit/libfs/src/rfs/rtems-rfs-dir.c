@@ -38,6 +38,7 @@
 #include <rtems/rfs/rtems-rfs-trace.h>
 #include <rtems/rfs/rtems-rfs-dir.h>
 #include <rtems/rfs/rtems-rfs-dir-hash.h>
+#include <rtems/rfs/rtems-rfs-dir-index.h>
 
 /**
  * Validate the directory entry data.
@@ -46,6 +47,165 @@
   (((_l) <= RTEMS_RFS_DIR_ENTRY_SIZE) || ((_l) >= rtems_rfs_fs_max_name (_f)) \
    || (_i < RTEMS_RFS_ROOT_INO) || (_i > rtems_rfs_fs_inodes (_f)))
 
+/**
+ * Search the directory block held in the buffer handle for an entry. The
+ * block position of the map is left at the entry if found.
+ */
+static int
+rtems_rfs_dir_search_block (rtems_rfs_file_system*   fs,
+                            rtems_rfs_inode_handle*  inode,
+                            rtems_rfs_block_map*     map,
+                            rtems_rfs_buffer_handle* entries,
+                            uint32_t                 hash,
+                            const char*              name,
+                            int                      length,
+                            rtems_rfs_ino*           ino)
+{
+  uint8_t* entry;
+
+  /*
+   * Search the block to see if the name matches. A hash of 0xffff or 0x0
+   * means the entry is empty.
+   */
+
+  entry = rtems_rfs_buffer_data (entries);
+
+  map->bpos.boff = 0;
+
+  while (map->bpos.boff < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+  {
+    rtems_rfs_ino eino;
+    uint32_t      ehash;
+    int           elength;
+
+    ehash  = rtems_rfs_dir_entry_hash (entry);
+    elength = rtems_rfs_dir_entry_length (entry);
+    eino = rtems_rfs_dir_entry_ino (entry);
+
+    if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+      break;
+
+    if (rtems_rfs_dir_entry_valid (fs, elength, eino))
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
+        printf ("rtems-rfs: dir-lookup-ino: "
+                "bad length or ino for ino %" PRIu32 ": %u/%" PRId32 " @ %04" PRIx32 "\n",
+                rtems_rfs_inode_ino (inode), elength, eino, map->bpos.boff);
+      return EIO;
+    }
+
+    if ((ehash == hash) && ((elength - RTEMS_RFS_DIR_ENTRY_SIZE) == length))
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO_CHECK))
+        printf ("rtems-rfs: dir-lookup-ino: "
+                "checking entry for ino %" PRId32 ": bno=%04" PRIx32 "/off=%04" PRIx32
+                " length:%d ino:%" PRId32 "\n",
+                rtems_rfs_inode_ino (inode), map->bpos.bno, map->bpos.boff,
+                elength, eino);
+
+      if (memcmp (entry + RTEMS_RFS_DIR_ENTRY_SIZE, name, length) == 0)
+      {
+        *ino = eino;
+        return 0;
+      }
+    }
+
+    map->bpos.boff += elength;
+    entry += elength;
+  }
+
+  return ENOENT;
+}
+
+/**
+ * Return the index of the directory building it if the directory is large
+ * enough to be indexed and is not indexed. The block position of the map is
+ * not defined after this call.
+ */
+static rtems_rfs_dir_index*
+rtems_rfs_dir_get_index (rtems_rfs_file_system*   fs,
+                         rtems_rfs_inode_handle*  dir,
+                         rtems_rfs_block_map*     map,
+                         rtems_rfs_buffer_handle* buffer)
+{
+  rtems_rfs_dir_index* index;
+  rtems_rfs_block_no   bno;
+  int                  rc = 0;
+
+  index = rtems_rfs_dir_index_find (fs, rtems_rfs_inode_ino (dir));
+  if (index)
+    return index;
+
+  if (rtems_rfs_block_map_count (map) < RTEMS_RFS_DIR_INDEX_MIN_BLOCKS)
+    return NULL;
+
+  index = rtems_rfs_dir_index_create (fs, rtems_rfs_inode_ino (dir));
+  if (!index)
+    return NULL;
+
+  for (bno = 0; (rc == 0) && (bno < rtems_rfs_block_map_count (map)); bno++)
+  {
+    rtems_rfs_block_pos bpos;
+    rtems_rfs_block_no  block;
+    uint8_t*            entry;
+    int                 offset;
+
+    bpos.bno = bno;
+    bpos.boff = 0;
+    bpos.block = 0;
+
+    rc = rtems_rfs_block_map_find (fs, map, &bpos, &block);
+    if (rc > 0)
+      break;
+
+    rc = rtems_rfs_buffer_handle_request (fs, buffer, block, true);
+    if (rc > 0)
+      break;
+
+    entry  = rtems_rfs_buffer_data (buffer);
+    offset = 0;
+
+    while (offset < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+    {
+      rtems_rfs_ino eino;
+      int           elength;
+
+      elength = rtems_rfs_dir_entry_length (entry);
+      eino    = rtems_rfs_dir_entry_ino (entry);
+
+      if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+        break;
+
+      if (rtems_rfs_dir_entry_valid (fs, elength, eino))
+      {
+        rc = EIO;
+        break;
+      }
+
+      rc = rtems_rfs_dir_index_add (index, rtems_rfs_dir_entry_hash (entry), bno);
+      if (rc > 0)
+        break;
+
+      entry  += elength;
+      offset += elength;
+    }
+
+    if (rc == 0)
+      rc = rtems_rfs_dir_index_set_used (index, bno, offset);
+  }
+
+  if (rc > 0)
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+      printf ("rtems-rfs: dir-index: load failed for ino %" PRIu32 ": %d: %s\n",
+              rtems_rfs_inode_ino (dir), rc, strerror (rc));
+    rtems_rfs_dir_index_drop (fs, rtems_rfs_inode_ino (dir));
+    return NULL;
+  }
+
+  return index;
+}
+
 int
 rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
                           rtems_rfs_inode_handle* inode,
@@ -91,8 +251,10 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
   }
   else
   {
-    rtems_rfs_block_no block;
-    uint32_t           hash;
+    rtems_rfs_dir_index* index;
+    rtems_rfs_block_pos  bpos;
+    rtems_rfs_block_no   block;
+    uint32_t             hash;
 
     /*
      * Calculate the hash of the look up string.
@@ -100,10 +262,61 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
     hash = rtems_rfs_dir_hash (name, length);
 
     /*
-     * Locate the first block. The map points to the start after open so just
-     * seek 0. If an error the block will be 0.
+     * If the directory is indexed only the blocks holding entries with the
+     * same hash need to be searched.
+     */
+    index = rtems_rfs_dir_get_index (fs, inode, &map, &entries);
+    if (index)
+    {
+      uint32_t           iterator = 0;
+      rtems_rfs_block_no bno;
+
+      rc = ENOENT;
+
+      while ((rc == ENOENT) &&
+             rtems_rfs_dir_index_next (index, hash, &iterator, &bno))
+      {
+        bpos.bno = bno;
+        bpos.boff = 0;
+        bpos.block = 0;
+
+        rc = rtems_rfs_block_map_find (fs, &map, &bpos, &block);
+        if (rc == 0)
+          rc = rtems_rfs_buffer_handle_request (fs, &entries, block, true);
+        if (rc == 0)
+          rc = rtems_rfs_dir_search_block (fs, inode, &map, &entries,
+                                           hash, name, length, ino);
+      }
+
+      if ((rc == 0) || (rc == ENOENT))
+      {
+        if (rc == 0)
+        {
+          *offset = rtems_rfs_block_map_pos (fs, &map);
+
+          if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO_FOUND))
+            printf ("rtems-rfs: dir-lookup-ino: "
+                    "entry found in ino %" PRIu32 ", ino=%" PRIu32 " offset=%" PRIu32 "\n",
+                    rtems_rfs_inode_ino (inode), *ino, *offset);
+        }
+
+        rtems_rfs_buffer_handle_close (fs, &entries);
+        rtems_rfs_block_map_close (fs, &map);
+        return rc;
+      }
+
+      /*
+       * Release the index and let the search of all the blocks report the
+       * error.
+       */
+      rtems_rfs_dir_index_drop (fs, rtems_rfs_inode_ino (inode));
+    }
+
+    /*
+     * Locate the first block. If an error the block will be 0.
      */
-    rc = rtems_rfs_block_map_seek (fs, &map, 0, &block);
+    rtems_rfs_block_set_bpos_zero (&bpos);
+    rc = rtems_rfs_block_map_find (fs, &map, &bpos, &block);
     if (rc > 0)
     {
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
@@ -118,8 +331,6 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
 
     while ((rc == 0) && block)
     {
-      uint8_t* entry;
-
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
         printf ("rtems-rfs: dir-lookup-ino: block read, ino=%" PRIu32 " bno=%" PRId32 "\n",
                 rtems_rfs_inode_ino (inode), map.bpos.bno);
@@ -133,66 +344,23 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
         break;
       }
 
-      /*
-       * Search the block to see if the name matches. A hash of 0xffff or 0x0
-       * means the entry is empty.
-       */
-
-      entry = rtems_rfs_buffer_data (&entries);
-
-      map.bpos.boff = 0;
-
-      while (map.bpos.boff < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+      rc = rtems_rfs_dir_search_block (fs, inode, &map, &entries,
+                                       hash, name, length, ino);
+      if (rc == 0)
       {
-        uint32_t ehash;
-        int      elength;
-
-        ehash  = rtems_rfs_dir_entry_hash (entry);
-        elength = rtems_rfs_dir_entry_length (entry);
-        *ino = rtems_rfs_dir_entry_ino (entry);
+        *offset = rtems_rfs_block_map_pos (fs, &map);
 
-        if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
-          break;
+        if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO_FOUND))
+          printf ("rtems-rfs: dir-lookup-ino: "
+                  "entry found in ino %" PRIu32 ", ino=%" PRIu32 " offset=%" PRIu32 "\n",
+                  rtems_rfs_inode_ino (inode), *ino, *offset);
 
-        if (rtems_rfs_dir_entry_valid (fs, elength, *ino))
-        {
-          if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
-            printf ("rtems-rfs: dir-lookup-ino: "
-                    "bad length or ino for ino %" PRIu32 ": %u/%" PRId32 " @ %04" PRIx32 "\n",
-                    rtems_rfs_inode_ino (inode), elength, *ino, map.bpos.boff);
-          rc = EIO;
-          break;
-        }
-
-        if (ehash == hash)
-        {
-          if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO_CHECK))
-            printf ("rtems-rfs: dir-lookup-ino: "
-                    "checking entry for ino %" PRId32 ": bno=%04" PRIx32 "/off=%04" PRIx32
-                    " length:%d ino:%" PRId32 "\n",
-                    rtems_rfs_inode_ino (inode), map.bpos.bno, map.bpos.boff,
-                    elength, rtems_rfs_dir_entry_ino (entry));
-
-          if (memcmp (entry + RTEMS_RFS_DIR_ENTRY_SIZE, name, length) == 0)
-          {
-            *offset = rtems_rfs_block_map_pos (fs, &map);
-
-            if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO_FOUND))
-              printf ("rtems-rfs: dir-lookup-ino: "
-                      "entry found in ino %" PRIu32 ", ino=%" PRIu32 " offset=%" PRIu32 "\n",
-                      rtems_rfs_inode_ino (inode), *ino, *offset);
-
-            rtems_rfs_buffer_handle_close (fs, &entries);
-            rtems_rfs_block_map_close (fs, &map);
-            return 0;
-          }
-        }
-
-        map.bpos.boff += elength;
-        entry += elength;
+        rtems_rfs_buffer_handle_close (fs, &entries);
+        rtems_rfs_block_map_close (fs, &map);
+        return 0;
       }
 
-      if (rc == 0)
+      if (rc == ENOENT)
       {
         rc = rtems_rfs_block_map_next_block (fs, &map, &block);
         if ((rc > 0) && (rc != ENXIO))
@@ -231,6 +399,7 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
   rtems_rfs_block_map     map;
   rtems_rfs_block_pos     bpos;
   rtems_rfs_buffer_handle buffer;
+  rtems_rfs_dir_index*    index;
   int                     rc;
 
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_ADD_ENTRY))
@@ -254,6 +423,96 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
     return rc;
   }
 
+  /*
+   * If the directory is indexed go to the first block with enough space.
+   */
+  index = rtems_rfs_dir_get_index (fs, dir, &map, &buffer);
+  if (index)
+  {
+    rtems_rfs_block_no bno;
+    rtems_rfs_block_no block;
+    uint32_t           used;
+    bool               read = true;
+
+    bno = rtems_rfs_dir_index_space (index, rtems_rfs_fs_block_size (fs),
+                                     length + RTEMS_RFS_DIR_ENTRY_SIZE);
+
+    if (bno < rtems_rfs_dir_index_blocks (index))
+    {
+      bpos.bno = bno;
+      bpos.boff = 0;
+      bpos.block = 0;
+      used = rtems_rfs_dir_index_used (index, bno);
+      rc = rtems_rfs_block_map_find (fs, &map, &bpos, &block);
+    }
+    else if (bno == rtems_rfs_block_map_count (&map))
+    {
+      used = 0;
+      read = false;
+      rc = rtems_rfs_block_map_grow (fs, &map, 1, &block);
+    }
+    else
+    {
+      used = 0;
+      rc = EIO;
+    }
+
+    if (rc == 0)
+      rc = rtems_rfs_buffer_handle_request (fs, &buffer, block, read);
+
+    if (rc == 0)
+    {
+      uint8_t* entry;
+
+      entry = rtems_rfs_buffer_data (&buffer);
+
+      if (!read)
+        memset (entry, 0xff, rtems_rfs_fs_block_size (fs));
+
+      entry += used;
+
+      if (rtems_rfs_dir_entry_length (entry) == RTEMS_RFS_DIR_ENTRY_EMPTY)
+      {
+        uint32_t hash;
+        hash = rtems_rfs_dir_hash (name, length);
+        rtems_rfs_dir_set_entry_hash (entry, hash);
+        rtems_rfs_dir_set_entry_ino (entry, ino);
+        rtems_rfs_dir_set_entry_length (entry,
+                                        RTEMS_RFS_DIR_ENTRY_SIZE + length);
+        memcpy (entry + RTEMS_RFS_DIR_ENTRY_SIZE, name, length);
+        rtems_rfs_buffer_mark_dirty (&buffer);
+
+        rc = rtems_rfs_dir_index_set_used (index, bno,
+                                           used + RTEMS_RFS_DIR_ENTRY_SIZE + length);
+        if (rc == 0)
+          rc = rtems_rfs_dir_index_add (index, hash, bno);
+        if (rc > 0)
+          rtems_rfs_dir_index_drop (fs, rtems_rfs_inode_ino (dir));
+
+        rtems_rfs_buffer_handle_close (fs, &buffer);
+        rtems_rfs_block_map_close (fs, &map);
+        return 0;
+      }
+    }
+
+    /*
+     * A grow or read error is returned. Anything else means the index does not
+     * match the directory so release it and search the directory.
+     */
+    if ((rc > 0) && !read)
+    {
+      rtems_rfs_buffer_handle_close (fs, &buffer);
+      rtems_rfs_block_map_close (fs, &map);
+      return rc;
+    }
+
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+      printf ("rtems-rfs: dir-index: add entry mismatch for ino %" PRIu32 "\n",
+              rtems_rfs_inode_ino (dir));
+
+    rtems_rfs_dir_index_drop (fs, rtems_rfs_inode_ino (dir));
+  }
+
   /*
    * Search the map from the beginning to find any empty space.
    */
@@ -459,7 +718,34 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
 
       if (ino == rtems_rfs_dir_entry_ino (entry))
       {
-        uint32_t remaining;
+        rtems_rfs_dir_index* index;
+        uint32_t             remaining;
+
+        /*
+         * Keep the directory's index in step with the block. Entries only move
+         * within the block so only the removed entry changes.
+         */
+        index = rtems_rfs_dir_index_find (fs, rtems_rfs_inode_ino (dir));
+        if (index)
+        {
+          rtems_rfs_block_no bno = map.bpos.bno;
+
+          if ((bno >= rtems_rfs_dir_index_blocks (index)) ||
+              !rtems_rfs_dir_index_remove (index,
+                                           rtems_rfs_dir_entry_hash (entry),
+                                           bno))
+          {
+            rtems_rfs_dir_index_drop (fs, rtems_rfs_inode_ino (dir));
+            index = NULL;
+          }
+          else
+          {
+            rtems_rfs_dir_index_set_used (index, bno,
+                                          rtems_rfs_dir_index_used (index, bno) -
+                                          elength);
+          }
+        }
+
         remaining = rtems_rfs_fs_block_size (fs) - (eoffset + elength);
         memmove (entry, entry + elength, remaining);
         memset (entry + remaining, 0xff, elength);
@@ -491,6 +777,10 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
                       "block map shrink failed for ino %" PRIu32 ": %d: %s\n",
                       rtems_rfs_inode_ino (dir), rc, strerror (rc));
           }
+          else if (index)
+          {
+            rtems_rfs_dir_index_set_blocks (index, rtems_rfs_block_map_count (&map));
+          }
         }
 
         rtems_rfs_buffer_mark_dirty (&buffer);
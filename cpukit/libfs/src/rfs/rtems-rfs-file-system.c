@@ -24,6 +24,7 @@
 #include <string.h>
 
 #include <rtems/rfs/rtems-rfs-data.h>
+#include <rtems/rfs/rtems-rfs-dir-index.h>
 #include <rtems/rfs/rtems-rfs-file-system.h>
 #include <rtems/rfs/rtems-rfs-inode.h>
 #include <rtems/rfs/rtems-rfs-trace.h>
@@ -226,8 +227,12 @@ rtems_rfs_fs_open (const char*             name,
   rtems_chain_initialize_empty (&(*fs)->release);
   rtems_chain_initialize_empty (&(*fs)->release_modified);
   rtems_chain_initialize_empty (&(*fs)->file_shares);
+  rtems_chain_initialize_empty (&(*fs)->dir_indexes);
+  rtems_rfs_mutex_create (&(*fs)->buffer_lock);
+  rtems_chain_initialize_empty (&(*fs)->buffer_io_requests);
 
   (*fs)->max_held_buffers = max_held_buffers;
+  (*fs)->max_dir_indexes = RTEMS_RFS_DIR_INDEX_MAX;
   (*fs)->buffers_count = 0;
   (*fs)->release_count = 0;
   (*fs)->release_modified_count = 0;
@@ -314,11 +319,15 @@ rtems_rfs_fs_close (rtems_rfs_file_system* fs)
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_CLOSE))
     printf ("rtems-rfs: close\n");
 
+  rtems_rfs_dir_index_drop_all (fs);
+
   for (group = 0; group < fs->group_count; group++)
     rtems_rfs_group_close (fs, &fs->groups[group]);
 
   rtems_rfs_buffer_close (fs);
 
+  rtems_rfs_mutex_destroy (&fs->buffer_lock);
+
   free (fs);
   return 0;
 }
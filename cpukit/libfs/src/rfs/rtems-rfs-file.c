@@ -125,6 +125,8 @@ rtems_rfs_file_open (rtems_rfs_file_system*  fs,
     shared->ctime = rtems_rfs_inode_get_ctime (&shared->inode);
     shared->fs = fs;
 
+    rtems_rfs_mutex_create (&shared->lock);
+
     rtems_chain_append_unprotected (&fs->file_shares, &shared->link);
 
     rtems_rfs_inode_unload (fs, &shared->inode, false);
@@ -200,6 +202,7 @@ rtems_rfs_file_close (rtems_rfs_file_system* fs,
     }
 
     rtems_chain_extract_unprotected (&handle->shared->link);
+    rtems_rfs_mutex_destroy (&handle->shared->lock);
     free (handle->shared);
   }
 
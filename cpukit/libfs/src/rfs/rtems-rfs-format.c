@@ -552,6 +552,8 @@ rtems_rfs_format (const char* name, const rtems_rfs_format_config* config)
   rtems_chain_initialize_empty (&fs.release);
   rtems_chain_initialize_empty (&fs.release_modified);
   rtems_chain_initialize_empty (&fs.file_shares);
+  rtems_rfs_mutex_create (&fs.buffer_lock);
+  rtems_chain_initialize_empty (&fs.buffer_io_requests);
 
   fs.max_held_buffers = RTEMS_RFS_FS_MAX_HELD_BUFFERS;
 
@@ -650,6 +652,9 @@ rtems_rfs_format (const char* name, const rtems_rfs_format_config* config)
     printf ("\n");
 
   rc = rtems_rfs_buffer_close (&fs);
+
+  rtems_rfs_mutex_destroy (&fs.buffer_lock);
+
   if (rc != 0)
   {
     printf ("rtems-rfs: format: buffer close failed: %d: %s\n",
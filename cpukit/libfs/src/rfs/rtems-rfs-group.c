@@ -116,6 +116,8 @@ rtems_rfs_group_open (rtems_rfs_file_system* fs,
     rtems_rfs_bitmap_release_buffer (fs, &group->inode_bitmap);
   }
 
+  rtems_rfs_mutex_create (&group->lock);
+
   return 0;
 }
 
@@ -146,6 +148,8 @@ rtems_rfs_group_close (rtems_rfs_file_system* fs, rtems_rfs_group* group)
   if (rc > 0)
     result = rc;
 
+  rtems_rfs_mutex_destroy (&group->lock);
+
   return result;
 }
 
@@ -224,13 +228,18 @@ rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
     else
       bitmap = &fs->groups[group].block_bitmap;
 
+    rtems_rfs_group_lock (&fs->groups[group]);
+
     rc = rtems_rfs_bitmap_map_alloc (bitmap, bit, &allocated, &bit);
-    if (rc > 0)
-      return rc;
 
     if (rtems_rfs_fs_release_bitmaps (fs))
       rtems_rfs_bitmap_release_buffer (fs, bitmap);
 
+    rtems_rfs_group_unlock (&fs->groups[group]);
+
+    if (rc > 0)
+      return rc;
+
     if (allocated)
     {
       if (inode)
@@ -269,6 +278,109 @@ rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
   return ENOSPC;
 }
 
+int
+rtems_rfs_group_bitmap_alloc_run (rtems_rfs_file_system* fs,
+                                  rtems_rfs_bitmap_bit   goal,
+                                  size_t                 count,
+                                  rtems_rfs_bitmap_bit*  result,
+                                  size_t*                allocated)
+{
+  rtems_rfs_bitmap_control* bitmap;
+  rtems_rfs_group*          group;
+  rtems_rfs_bitmap_bit      bit;
+  rtems_rfs_bitmap_bit      start;
+  rtems_rfs_bitmap_bit      no;
+  size_t                    set;
+  int                       group_start;
+  int                       g;
+  int                       rc;
+
+  *allocated = 0;
+
+  start = goal;
+  if (start >= RTEMS_RFS_ROOT_INO)
+    start -= RTEMS_RFS_ROOT_INO;
+
+  group_start = start / fs->group_blocks;
+  if (group_start >= fs->group_count)
+    group_start = 0;
+
+  /*
+   * Look for the whole run starting at the goal and then in the groups
+   * following the goal's group. The free run limit of a group's bitmap skips
+   * groups that cannot hold the run without loading the bitmap.
+   */
+  for (g = 0; (count > 1) && (g < fs->group_count); g++)
+  {
+    int  group = (group_start + g) % fs->group_count;
+    bool found = false;
+
+    bitmap = &fs->groups[group].block_bitmap;
+
+    if (rtems_rfs_bitmap_map_free_run (bitmap) < count)
+      continue;
+
+    bit = g == 0 ? (rtems_rfs_bitmap_bit) (start % fs->group_blocks) : 0;
+
+    rtems_rfs_group_lock (&fs->groups[group]);
+
+    rc = rtems_rfs_bitmap_map_alloc_run (bitmap, bit, count, &found, &bit);
+
+    if (rtems_rfs_fs_release_bitmaps (fs))
+      rtems_rfs_bitmap_release_buffer (fs, bitmap);
+
+    rtems_rfs_group_unlock (&fs->groups[group]);
+
+    if (rc > 0)
+      return rc;
+
+    if (found)
+    {
+      *result = rtems_rfs_group_block (&fs->groups[group], bit);
+      *allocated = count;
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_GROUP_BITMAPS))
+        printf ("rtems-rfs: group-bitmap-alloc-run: allocated: %" PRId32 " (%zu)\n",
+                *result, *allocated);
+      return 0;
+    }
+  }
+
+  /*
+   * No group has a free run long enough. Take the free block nearest the goal
+   * and any free blocks that follow it.
+   */
+  rc = rtems_rfs_group_bitmap_alloc (fs, goal, false, result);
+  if (rc > 0)
+    return rc;
+
+  *allocated = 1;
+
+  no = *result - RTEMS_RFS_SUPERBLOCK_SIZE;
+  group = &fs->groups[no / fs->group_blocks];
+  bitmap = &group->block_bitmap;
+  bit = (rtems_rfs_bitmap_bit) (no % fs->group_blocks);
+
+  rtems_rfs_group_lock (group);
+
+  if ((count > 1) && ((bit + 1) < bitmap->size))
+  {
+    rc = rtems_rfs_bitmap_map_set_run (bitmap, bit + 1, count - 1, &set);
+    if (rc == 0)
+      *allocated += set;
+  }
+
+  if (rtems_rfs_fs_release_bitmaps (fs))
+    rtems_rfs_bitmap_release_buffer (fs, bitmap);
+
+  rtems_rfs_group_unlock (group);
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_GROUP_BITMAPS))
+    printf ("rtems-rfs: group-bitmap-alloc-run: allocated: %" PRId32 " (%zu)\n",
+            *result, *allocated);
+
+  return 0;
+}
+
 int
 rtems_rfs_group_bitmap_free (rtems_rfs_file_system* fs,
                              bool                   inode,
@@ -303,10 +415,14 @@ rtems_rfs_group_bitmap_free (rtems_rfs_file_system* fs,
   else
     bitmap = &fs->groups[group].block_bitmap;
 
+  rtems_rfs_group_lock (&fs->groups[group]);
+
   rc = rtems_rfs_bitmap_map_clear (bitmap, bit);
 
   rtems_rfs_bitmap_release_buffer (fs, bitmap);
 
+  rtems_rfs_group_unlock (&fs->groups[group]);
+
   return rc;
 }
 
@@ -349,10 +465,14 @@ rtems_rfs_group_bitmap_test (rtems_rfs_file_system* fs,
   else
     bitmap = &fs->groups[group].block_bitmap;
 
+  rtems_rfs_group_lock (&fs->groups[group]);
+
   rc = rtems_rfs_bitmap_map_test (bitmap, bit, state);
 
   rtems_rfs_bitmap_release_buffer (fs, bitmap);
 
+  rtems_rfs_group_unlock (&fs->groups[group]);
+
   return rc;
 }
 
@@ -369,12 +489,14 @@ rtems_rfs_group_usage (rtems_rfs_file_system* fs,
   for (g = 0; g < fs->group_count; g++)
   {
     rtems_rfs_group* group = &fs->groups[g];
+    rtems_rfs_group_lock (group);
     *blocks +=
       rtems_rfs_bitmap_map_size(&group->block_bitmap) -
       rtems_rfs_bitmap_map_free (&group->block_bitmap);
     *inodes +=
       rtems_rfs_bitmap_map_size (&group->inode_bitmap) -
       rtems_rfs_bitmap_map_free (&group->inode_bitmap);
+    rtems_rfs_group_unlock (group);
   }
 
   if (*blocks > rtems_rfs_fs_blocks (fs))
@@ -27,6 +27,7 @@
 #include <rtems/rfs/rtems-rfs-file-system.h>
 #include <rtems/rfs/rtems-rfs-inode.h>
 #include <rtems/rfs/rtems-rfs-dir.h>
+#include <rtems/rfs/rtems-rfs-dir-index.h>
 
 int
 rtems_rfs_inode_alloc (rtems_rfs_file_system* fs,
@@ -331,6 +332,11 @@ rtems_rfs_inode_delete (rtems_rfs_file_system*  fs,
   {
     rtems_rfs_block_map map;
 
+    /*
+     * A deleted directory cannot be indexed and the ino may be reused.
+     */
+    rtems_rfs_dir_index_drop (fs, handle->ino);
+
     /*
      * Free the ino number.
      */
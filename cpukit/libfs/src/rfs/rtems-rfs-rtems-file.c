@@ -120,7 +120,7 @@ rtems_rfs_rtems_file_read (rtems_libio_t* iop,
   if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_READ))
     printf("rtems-rfs: file-read: handle:%p count:%zd\n", file, count);
 
-  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_lock (file);
 
   pos = iop->offset;
 
@@ -161,7 +161,7 @@ rtems_rfs_rtems_file_read (rtems_libio_t* iop,
   if (read >= 0)
     iop->offset = pos + read;
 
-  rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_unlock (file);
 
   return read;
 }
@@ -189,7 +189,7 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
   if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_WRITE))
     printf("rtems-rfs: file-write: handle:%p count:%zd\n", file, count);
 
-  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_lock (file);
 
   pos = iop->offset;
   file_size = rtems_rfs_file_size (file);
@@ -203,7 +203,7 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
     rc = rtems_rfs_file_set_size (file, pos);
     if (rc)
     {
-      rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+      rtems_rfs_rtems_file_unlock (file);
       return rtems_rfs_rtems_error ("file-write: write extend", rc);
     }
 
@@ -215,11 +215,34 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
     rc = rtems_rfs_file_seek (file, pos, &pos);
     if (rc)
     {
-      rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+      rtems_rfs_rtems_file_unlock (file);
       return rtems_rfs_rtems_error ("file-write: write append seek", rc);
     }
   }
 
+  /*
+   * Reserve the blocks a write past the allocated blocks needs in one go so
+   * the data is contiguous and the bitmaps are only searched once. An error
+   * is reported by rtems_rfs_file_io_start() when it grows the file. The
+   * blocks not used are released before returning so reserved blocks are
+   * never held on disk between requests.
+   */
+  if (count)
+  {
+    rtems_rfs_file_system* fs = rtems_rfs_file_fs (file);
+    rtems_rfs_block_map*   map = rtems_rfs_file_map (file);
+    rtems_rfs_pos          allocated;
+
+    allocated = (rtems_rfs_pos) rtems_rfs_block_map_count (map) *
+      rtems_rfs_fs_block_size (fs);
+
+    if ((pos + count) > allocated)
+      rtems_rfs_block_map_reserve (fs, map,
+                                   ((pos + count - allocated) +
+                                    rtems_rfs_fs_block_size (fs) - 1) /
+                                   rtems_rfs_fs_block_size (fs));
+  }
+
   while (count)
   {
     size_t size = count;
@@ -254,10 +277,15 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
     }
   }
 
+  rc = rtems_rfs_block_map_release_reserve (rtems_rfs_file_fs (file),
+                                            rtems_rfs_file_map (file));
+  if (rc && (write >= 0))
+    write = rtems_rfs_rtems_error ("file-write: release reserve", rc);
+
   if (write >= 0)
     iop->offset = pos + write;
 
-  rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_unlock (file);
 
   return write;
 }
@@ -282,7 +310,7 @@ rtems_rfs_rtems_file_lseek (rtems_libio_t* iop,
   if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_LSEEK))
     printf("rtems-rfs: file-lseek: handle:%p offset:%" PRIdoff_t "\n", file, offset);
 
-  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_lock (file);
 
   old_offset = iop->offset;
   new_offset = rtems_filesystem_default_lseek_file (iop, offset, whence);
@@ -299,7 +327,7 @@ rtems_rfs_rtems_file_lseek (rtems_libio_t* iop,
     }
   }
 
-  rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_unlock (file);
 
   return new_offset;
 }
@@ -321,13 +349,13 @@ rtems_rfs_rtems_file_ftruncate (rtems_libio_t* iop,
   if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_FTRUNC))
     printf("rtems-rfs: file-ftrunc: handle:%p length:%" PRIdoff_t "\n", file, length);
 
-  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_lock (file);
 
   rc = rtems_rfs_file_set_size (file, length);
   if (rc)
     rc = rtems_rfs_rtems_error ("file_ftruncate: set size", rc);
 
-  rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_unlock (file);
 
   return rc;
 }
@@ -352,5 +380,6 @@ const rtems_filesystem_file_handlers_r rtems_rfs_rtems_file_handlers = {
   .mmap_h      = rtems_filesystem_default_mmap,
   .poll_h      = rtems_filesystem_default_poll,
   .readv_h     = rtems_filesystem_default_readv,
-  .writev_h    = rtems_filesystem_default_writev
+  .writev_h    = rtems_filesystem_default_writev,
+  .sendfile_h = rtems_filesystem_default_sendfile
 };
@@ -30,6 +30,7 @@
 
 #include <rtems/rfs/rtems-rfs-file.h>
 #include <rtems/rfs/rtems-rfs-dir.h>
+#include <rtems/rfs/rtems-rfs-dir-index.h>
 #include <rtems/rfs/rtems-rfs-link.h>
 #include "rtems-rfs-rtems.h"
 
@@ -102,6 +103,81 @@ static void rtems_rfs_rtems_follow_link(
   }
 }
 
+static void
+rtems_rfs_rtems_set_cache_location (
+  rtems_filesystem_eval_path_cache_location* location,
+  rtems_rfs_ino                              ino,
+  uint32_t                                   doff
+)
+{
+  memset (location, 0, sizeof (*location));
+  location->values[0] = ino;
+  location->values[1] = doff;
+}
+
+/**
+ * Move the evaluation from the directory open in the inode handle to its
+ * entry found by a directory search or in the path component cache.
+ */
+static rtems_filesystem_eval_path_generic_status
+rtems_rfs_rtems_eval_entry(
+  rtems_filesystem_eval_path_context_t *ctx,
+  rtems_rfs_inode_handle* inode,
+  rtems_rfs_ino entry_ino,
+  uint32_t entry_doff
+)
+{
+  rtems_filesystem_eval_path_generic_status status =
+    RTEMS_FILESYSTEM_EVAL_PATH_GENERIC_DONE;
+  rtems_filesystem_location_info_t *currentloc =
+    rtems_filesystem_eval_path_get_currentloc( ctx );
+  rtems_rfs_file_system* fs = rtems_rfs_rtems_pathloc_dev (currentloc);
+  int rc;
+
+  rc = rtems_rfs_inode_close (fs, inode);
+  if (rc == 0) {
+    rc = rtems_rfs_inode_open (fs, entry_ino, inode, true);
+  }
+
+  if (rc != 0) {
+    /*
+     * This prevents the rtems_rfs_inode_close() from doing something in
+     * rtems_rfs_rtems_eval_path().
+     */
+    memset (inode, 0, sizeof(*inode));
+  }
+
+  if (rc == 0) {
+    bool is_sym_link = S_ISLNK (rtems_rfs_inode_get_mode (inode));
+    int eval_flags = rtems_filesystem_eval_path_get_flags (ctx);
+    bool follow_sym_link = (eval_flags & RTEMS_FS_FOLLOW_SYM_LINK) != 0;
+    bool terminal = !rtems_filesystem_eval_path_has_path (ctx);
+
+    rtems_filesystem_eval_path_clear_token (ctx);
+
+    if (is_sym_link && (follow_sym_link || !terminal)) {
+      rtems_rfs_rtems_follow_link (ctx, fs, entry_ino);
+    } else {
+      rc = rtems_rfs_rtems_set_handlers (currentloc, inode) ? 0 : EIO;
+      if (rc == 0) {
+        rtems_rfs_rtems_set_pathloc_ino (currentloc, entry_ino);
+        rtems_rfs_rtems_set_pathloc_doff (currentloc, entry_doff);
+
+        if (!terminal) {
+          status = RTEMS_FILESYSTEM_EVAL_PATH_GENERIC_CONTINUE;
+        }
+      } else {
+        rtems_filesystem_eval_path_error (
+          ctx,
+          rtems_rfs_rtems_error ("eval_path: set handlers", rc)
+        );
+      }
+    }
+  }
+
+  return status;
+}
+
 static rtems_filesystem_eval_path_generic_status
 rtems_rfs_rtems_eval_token(
   rtems_filesystem_eval_path_context_t *ctx,
@@ -122,6 +198,8 @@ rtems_rfs_rtems_eval_token(
       rtems_filesystem_location_info_t *currentloc =
         rtems_filesystem_eval_path_get_currentloc( ctx );
       rtems_rfs_file_system* fs = rtems_rfs_rtems_pathloc_dev (currentloc);
+      rtems_filesystem_eval_path_cache_location dir_location;
+      rtems_filesystem_eval_path_cache_location entry_location;
       rtems_rfs_ino entry_ino;
       uint32_t entry_doff;
       int rc = rtems_rfs_dir_lookup_ino (
@@ -133,51 +211,64 @@ rtems_rfs_rtems_eval_token(
         &entry_doff
       );
 
-      if (rc == 0) {
-        rc = rtems_rfs_inode_close (fs, inode);
-        if (rc == 0) {
-          rc = rtems_rfs_inode_open (fs, entry_ino, inode, true);
-        }
+      /*
+       * Only a search result is entered, an I/O error may not persist.
+       */
+      if (rc == 0 || rc == ENOENT) {
+        rtems_rfs_rtems_set_cache_location (&dir_location,
+                                            rtems_rfs_inode_ino (inode), 0);
+        rtems_rfs_rtems_set_cache_location (&entry_location,
+                                            entry_ino, entry_doff);
+        rtems_filesystem_eval_path_cache_enter (
+          currentloc->mt_entry,
+          &dir_location,
+          token,
+          tokenlen,
+          rc == 0 ? &entry_location : NULL
+        );
+      }
 
-        if (rc != 0) {
-          /*
-           * This prevents the rtems_rfs_inode_close() from doing something in
-           * rtems_rfs_rtems_eval_path().
-           */
-          memset (inode, 0, sizeof(*inode));
-        }
+      if (rc == 0) {
+        status = rtems_rfs_rtems_eval_entry (ctx, inode, entry_ino, entry_doff);
       } else {
         status = RTEMS_FILESYSTEM_EVAL_PATH_GENERIC_NO_ENTRY;
-        rc = -1;
       }
+    }
+  }
 
-      if (rc == 0) {
-        bool is_sym_link = S_ISLNK (rtems_rfs_inode_get_mode (inode));
-        int eval_flags = rtems_filesystem_eval_path_get_flags (ctx);
-        bool follow_sym_link = (eval_flags & RTEMS_FS_FOLLOW_SYM_LINK) != 0;
-        bool terminal = !rtems_filesystem_eval_path_has_path (ctx);
-
-        rtems_filesystem_eval_path_clear_token (ctx);
-
-        if (is_sym_link && (follow_sym_link || !terminal)) {
-          rtems_rfs_rtems_follow_link (ctx, fs, entry_ino);
-        } else {
-          rc = rtems_rfs_rtems_set_handlers (currentloc, inode) ? 0 : EIO;
-          if (rc == 0) {
-            rtems_rfs_rtems_set_pathloc_ino (currentloc, entry_ino);
-            rtems_rfs_rtems_set_pathloc_doff (currentloc, entry_doff);
-
-            if (!terminal) {
-              status = RTEMS_FILESYSTEM_EVAL_PATH_GENERIC_CONTINUE;
-            }
-          } else {
-            rtems_filesystem_eval_path_error (
-              ctx,
-              rtems_rfs_rtems_error ("eval_path: set handlers", rc)
-            );
-          }
-        }
-      }
+  return status;
+}
+
+static void
+rtems_rfs_rtems_eval_get_key(
+  rtems_filesystem_eval_path_context_t *ctx,
+  void *arg,
+  rtems_filesystem_eval_path_cache_location *dir
+)
+{
+  rtems_rfs_inode_handle* inode = arg;
+
+  rtems_rfs_rtems_set_cache_location (dir, rtems_rfs_inode_ino (inode), 0);
+}
+
+static rtems_filesystem_eval_path_generic_status
+rtems_rfs_rtems_eval_cached_entry(
+  rtems_filesystem_eval_path_context_t *ctx,
+  void *arg,
+  const rtems_filesystem_eval_path_cache_location *entry
+)
+{
+  rtems_filesystem_eval_path_generic_status status =
+    RTEMS_FILESYSTEM_EVAL_PATH_GENERIC_DONE;
+  rtems_rfs_inode_handle* inode = arg;
+  bool access_ok = rtems_rfs_rtems_eval_perms (ctx, RTEMS_FS_PERMS_EXEC, inode);
+
+  if (access_ok) {
+    if (entry != NULL) {
+      status = rtems_rfs_rtems_eval_entry (ctx, inode, entry->values[0],
+                                           entry->values[1]);
+    } else {
+      status = RTEMS_FILESYSTEM_EVAL_PATH_GENERIC_NO_ENTRY;
     }
   }
 
@@ -187,7 +278,9 @@ rtems_rfs_rtems_eval_token(
 static const rtems_filesystem_eval_path_generic_config
 rtems_rfs_rtems_eval_config = {
   .is_directory = rtems_rfs_rtems_is_directory,
-  .eval_token = rtems_rfs_rtems_eval_token
+  .eval_token = rtems_rfs_rtems_eval_token,
+  .get_key = rtems_rfs_rtems_eval_get_key,
+  .eval_entry = rtems_rfs_rtems_eval_cached_entry
 };
 
 static void
@@ -454,6 +547,8 @@ rtems_rfs_rtems_fstat (const rtems_filesystem_location_info_t* pathloc,
 
   if (shared)
   {
+    rtems_rfs_file_shared_lock (shared);
+
     buf->st_atime   = rtems_rfs_file_shared_get_atime (shared);
     buf->st_mtime   = rtems_rfs_file_shared_get_mtime (shared);
     buf->st_ctime   = rtems_rfs_file_shared_get_ctime (shared);
@@ -463,6 +558,8 @@ rtems_rfs_rtems_fstat (const rtems_filesystem_location_info_t* pathloc,
       buf->st_size = rtems_rfs_file_shared_get_block_offset (shared);
     else
       buf->st_size = rtems_rfs_file_shared_get_size (fs, shared);
+
+    rtems_rfs_file_shared_unlock (shared);
   }
   else
   {
@@ -565,13 +662,26 @@ rtems_rfs_rtems_rmnod (const rtems_filesystem_location_info_t* parent_pathloc,
   rtems_rfs_ino          parent = rtems_rfs_rtems_get_pathloc_ino (parent_pathloc);
   rtems_rfs_ino          ino = rtems_rfs_rtems_get_pathloc_ino (pathloc);
   uint32_t               doff = rtems_rfs_rtems_get_pathloc_doff (pathloc);
+  rtems_rfs_file_shared* shared;
   int                    rc;
 
   if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_RMNOD))
     printf ("rtems-rfs: rmnod: parent:%" PRId32 " doff:%" PRIu32 ", ino:%" PRId32 "\n",
             parent, doff, ino);
 
+  /*
+   * An open file can be read or written without the file system lock so hold
+   * the file's lock while its blocks may be released.
+   */
+  shared = rtems_rfs_file_get_shared (fs, ino);
+  if (shared)
+    rtems_rfs_file_shared_lock (shared);
+
   rc = rtems_rfs_unlink (fs, parent, ino, doff, rtems_rfs_unlink_dir_if_empty);
+
+  if (shared)
+    rtems_rfs_file_shared_unlock (shared);
+
   if (rc)
   {
     return rtems_rfs_rtems_error ("rmnod: unlinking", rc);
@@ -703,7 +813,8 @@ const rtems_filesystem_file_handlers_r rtems_rfs_rtems_link_handlers =
   .mmap_h      = rtems_filesystem_default_mmap,
   .poll_h      = rtems_filesystem_default_poll,
   .readv_h     = rtems_filesystem_default_readv,
-  .writev_h    = rtems_filesystem_default_writev
+  .writev_h    = rtems_filesystem_default_writev,
+  .sendfile_h = rtems_filesystem_default_sendfile
 };
 
 /**
@@ -752,6 +863,7 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
   rtems_rfs_file_system*   fs;
   uint32_t                 flags = 0;
   uint32_t                 max_held_buffers = RTEMS_RFS_FS_MAX_HELD_BUFFERS;
+  uint32_t                 max_dir_indexes = RTEMS_RFS_DIR_INDEX_MAX;
   const char*              options = data;
   int                      rc;
 
@@ -772,6 +884,11 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
     {
       max_held_buffers = strtoul (options + sizeof ("max-held-bufs"), 0, 0);
     }
+    else if (strncmp (options, "max-dir-indexes",
+                      sizeof ("max-dir-indexes") - 1) == 0)
+    {
+      max_dir_indexes = strtoul (options + sizeof ("max-dir-indexes"), 0, 0);
+    }
     else
       return rtems_rfs_rtems_error ("initialise: invalid option", EINVAL);
 
@@ -814,6 +931,8 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
     return rtems_rfs_rtems_error ("initialise: open", errno);
   }
 
+  fs->max_dir_indexes = max_dir_indexes;
+
   mt_entry->fs_info                          = fs;
   mt_entry->ops                              = &rtems_rfs_ops;
   mt_entry->mt_fs_root->location.node_access = (void*) RTEMS_RFS_ROOT_INO;
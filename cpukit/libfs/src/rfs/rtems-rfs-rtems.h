@@ -132,6 +132,7 @@ int rtems_rfs_rtems_trace_shell_command (int argc, char *argv[]);
 #endif
 
 #include <rtems/rfs/rtems-rfs-file-system.h>
+#include <rtems/rfs/rtems-rfs-file.h>
 #include <rtems/rfs/rtems-rfs-inode.h>
 #include <rtems/rfs/rtems-rfs-mutex.h>
 #include <rtems/libio_.h>
@@ -278,6 +279,27 @@ static inline void
   rtems_rfs_mutex_unlock (&rtems->access);
 }
 
+/**
+ * Lock an open RFS file. Reads and writes of a file only lock the file's
+ * shared data so different files can be accessed in parallel. The file system
+ * lock must not be taken while holding a file lock.
+ */
+static inline void
+ rtems_rfs_rtems_file_lock (rtems_rfs_file_handle* file)
+{
+  rtems_rfs_file_shared_lock (file->shared);
+}
+
+/**
+ * Unlock an open RFS file.
+ */
+static inline void
+ rtems_rfs_rtems_file_unlock (rtems_rfs_file_handle* file)
+{
+  rtems_rfs_buffers_release (rtems_rfs_file_fs (file));
+  rtems_rfs_file_shared_unlock (file->shared);
+}
+
 /**
  * The handlers.
  */
@@ -34,6 +34,27 @@ __FBSDID("$FreeBSD$");
 
 #include "sha256.h"
 
+/*
+ * The block compression back end is selected at build time by the
+ * instruction set extensions enabled for the target.
+ */
+#if defined(__ARM_FEATURE_SHA2) && defined(__ARM_NEON) && \
+    !defined(__ARM_BIG_ENDIAN)
+#define	SHA256_TRANSFORM_ARMV8
+#include <arm_neon.h>
+#elif defined(__SHA__) && defined(__SSE4_1__)
+#define	SHA256_TRANSFORM_X86_SHA
+#include <immintrin.h>
+#elif defined(__riscv_zknh)
+#define	SHA256_TRANSFORM_RISCV_ZKNH
+#endif
+
+/*
+ * Number of messages hashed interleaved by SHA256_Update_Multi(), so that
+ * the words of all lanes fit into a 128-bit vector register.
+ */
+#define	SHA256_LANES	4
+
 #if BYTE_ORDER == BIG_ENDIAN
 
 /* Copy a vector of big-endian uint32_t into a vector of bytes */
@@ -59,6 +80,7 @@ be32enc_vect(unsigned char *dst, const uint32_t *src, size_t len)
 		be32enc(dst + i * 4, src[i]);
 }
 
+#if !defined(SHA256_TRANSFORM_ARMV8) && !defined(SHA256_TRANSFORM_X86_SHA)
 /*
  * Decode a big-endian length len vector of (unsigned char) into a length
  * len/4 vector of (uint32_t).  Assumes len is a multiple of 4.
@@ -71,6 +93,7 @@ be32dec_vect(uint32_t *dst, const unsigned char *src, size_t len)
 	for (i = 0; i < len / 4; i++)
 		dst[i] = be32dec(src + i * 4);
 }
+#endif
 
 #endif /* BYTE_ORDER != BIG_ENDIAN */
 
@@ -84,6 +107,50 @@ be32dec_vect(uint32_t *dst, const unsigned char *src, size_t len)
 #define s0(x)		(ROTR(x, 7) ^ ROTR(x, 18) ^ SHR(x, 3))
 #define s1(x)		(ROTR(x, 17) ^ ROTR(x, 19) ^ SHR(x, 10))
 
+#ifdef SHA256_TRANSFORM_RISCV_ZKNH
+/* The scalar cryptography extension provides the sigma functions */
+#define	SHA256_ZKNH_OP(op)					\
+static inline uint32_t							\
+sha256_##op(uint32_t x)							\
+{									\
+	unsigned long r;						\
+									\
+	__asm__ ("sha256" #op " %0, %1" : "=r" (r) : "r" ((unsigned long)x)); \
+	return ((uint32_t)r);						\
+}
+SHA256_ZKNH_OP(sum0)
+SHA256_ZKNH_OP(sum1)
+SHA256_ZKNH_OP(sig0)
+SHA256_ZKNH_OP(sig1)
+#undef S0
+#undef S1
+#undef s0
+#undef s1
+#define S0(x)		sha256_sum0(x)
+#define S1(x)		sha256_sum1(x)
+#define s0(x)		sha256_sig0(x)
+#define s1(x)		sha256_sig1(x)
+#endif /* SHA256_TRANSFORM_RISCV_ZKNH */
+
+static const uint32_t K256[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+	0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+	0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+	0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+	0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+	0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
 /* SHA256 round function */
 #define RND(a, b, c, d, e, f, g, h, k)			\
 	t0 = h + S1(e) + Ch(e, f, g) + k;		\
@@ -99,6 +166,95 @@ be32dec_vect(uint32_t *dst, const unsigned char *src, size_t len)
 	    S[(70 - i) % 8], S[(71 - i) % 8],	\
 	    W[i] + k)
 
+#if defined(SHA256_TRANSFORM_ARMV8)
+
+/*
+ * SHA256 block compression function using the ARMv8 cryptographic
+ * extension.  Each step performs four rounds and the message schedule for
+ * the four rounds twelve rounds ahead.
+ */
+static void
+SHA256_Transform(uint32_t * state, const unsigned char block[64])
+{
+	uint32x4_t abcd, efgh, abcd_save, efgh_save, tmp;
+	uint32x4_t msg[4];
+	int i;
+
+	abcd = abcd_save = vld1q_u32(&state[0]);
+	efgh = efgh_save = vld1q_u32(&state[4]);
+
+	for (i = 0; i < 4; i++)
+		msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(block + i * 16)));
+
+	for (i = 0; i < 16; i++) {
+		uint32x4_t abcd_prev = abcd;
+
+		tmp = vaddq_u32(msg[i & 3], vld1q_u32(&K256[i * 4]));
+		if (i < 12)
+			msg[i & 3] = vsha256su1q_u32(
+			    vsha256su0q_u32(msg[i & 3], msg[(i + 1) & 3]),
+			    msg[(i + 2) & 3], msg[(i + 3) & 3]);
+		abcd = vsha256hq_u32(abcd, efgh, tmp);
+		efgh = vsha256h2q_u32(efgh, abcd_prev, tmp);
+	}
+
+	vst1q_u32(&state[0], vaddq_u32(abcd, abcd_save));
+	vst1q_u32(&state[4], vaddq_u32(efgh, efgh_save));
+}
+
+#elif defined(SHA256_TRANSFORM_X86_SHA)
+
+/*
+ * SHA256 block compression function using the x86 SHA extensions.  The
+ * instructions use the state in the ABEF and CDGH word order.  Each step
+ * performs four rounds and the message schedule for the four rounds twelve
+ * rounds ahead.
+ */
+static void
+SHA256_Transform(uint32_t * state, const unsigned char block[64])
+{
+	const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+	    0x0405060700010203ULL);
+	__m128i abef, cdgh, abef_save, cdgh_save, tmp;
+	__m128i msg[4];
+	int i;
+
+	tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]),
+	    0xb1);
+	cdgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]),
+	    0x1b);
+	abef = _mm_alignr_epi8(tmp, cdgh, 8);
+	cdgh = _mm_blend_epi16(cdgh, tmp, 0xf0);
+	abef_save = abef;
+	cdgh_save = cdgh;
+
+	for (i = 0; i < 4; i++)
+		msg[i] = _mm_shuffle_epi8(
+		    _mm_loadu_si128((const __m128i *)(block + i * 16)), bswap);
+
+	for (i = 0; i < 16; i++) {
+		tmp = _mm_add_epi32(msg[i & 3],
+		    _mm_loadu_si128((const __m128i *)&K256[i * 4]));
+		cdgh = _mm_sha256rnds2_epu32(cdgh, abef, tmp);
+		abef = _mm_sha256rnds2_epu32(abef, cdgh,
+		    _mm_shuffle_epi32(tmp, 0x0e));
+		if (i < 12)
+			msg[i & 3] = _mm_sha256msg2_epu32(_mm_add_epi32(
+			    _mm_sha256msg1_epu32(msg[i & 3], msg[(i + 1) & 3]),
+			    _mm_alignr_epi8(msg[(i + 3) & 3], msg[(i + 2) & 3], 4)),
+			    msg[(i + 3) & 3]);
+	}
+
+	abef = _mm_add_epi32(abef, abef_save);
+	cdgh = _mm_add_epi32(cdgh, cdgh_save);
+	tmp = _mm_shuffle_epi32(abef, 0x1b);
+	cdgh = _mm_shuffle_epi32(cdgh, 0xb1);
+	_mm_storeu_si128((__m128i *)&state[0], _mm_blend_epi16(tmp, cdgh, 0xf0));
+	_mm_storeu_si128((__m128i *)&state[4], _mm_alignr_epi8(cdgh, tmp, 8));
+}
+
+#else /* !SHA256_TRANSFORM_ARMV8 && !SHA256_TRANSFORM_X86_SHA */
+
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
  * the 512-bit input block to produce a new state.
@@ -190,6 +346,80 @@ SHA256_Transform(uint32_t * state, const unsigned char block[64])
 		state[i] += S[i];
 }
 
+#endif /* !SHA256_TRANSFORM_ARMV8 && !SHA256_TRANSFORM_X86_SHA */
+
+#if defined(SHA256_TRANSFORM_ARMV8) || defined(SHA256_TRANSFORM_X86_SHA) || \
+    defined(SHA256_TRANSFORM_RISCV_ZKNH)
+
+/* The instructions are faster than any interleaving of the messages */
+static void
+SHA256_Transform_Multi(uint32_t *state[], const unsigned char *block[],
+    size_t n)
+{
+	size_t j;
+
+	for (j = 0; j < n; j++)
+		SHA256_Transform(state[j], block[j]);
+}
+
+#else /* !SHA256_TRANSFORM_ARMV8 && !SHA256_TRANSFORM_X86_SHA && !ZKNH */
+
+/* One word of each interleaved message */
+typedef uint32_t sha256_lanes
+    __attribute__((__vector_size__(4 * SHA256_LANES)));
+
+/*
+ * SHA256 block compression function for up to SHA256_LANES independent
+ * messages.  The words of all messages are processed as a vector, so that
+ * targets with SIMD units execute the rounds of the messages in parallel and
+ * superscalar processors at least overlap the independent dependency chains.
+ * The message schedule is kept in a ring of sixteen words.
+ */
+static void
+SHA256_Transform_Multi(uint32_t *state[], const unsigned char *block[],
+    size_t n)
+{
+	sha256_lanes W[16];
+	sha256_lanes S[8];
+	sha256_lanes t0, t1;
+	size_t i, j;
+
+	/* Unused lanes process the first message and are discarded */
+	for (j = 0; j < SHA256_LANES; j++) {
+		const uint32_t *st = state[j < n ? j : 0];
+		const unsigned char *p = block[j < n ? j : 0];
+
+		for (i = 0; i < 16; i++)
+			W[i][j] = be32dec(p + i * 4);
+		for (i = 0; i < 8; i++)
+			S[i][j] = st[i];
+	}
+
+	for (i = 0; i < 64; i++) {
+		if (i >= 16)
+			W[i & 15] += s1(W[(i - 2) & 15]) + W[(i - 7) & 15] +
+			    s0(W[(i - 15) & 15]);
+
+		t0 = S[7] + S1(S[4]) + Ch(S[4], S[5], S[6]) + K256[i] +
+		    W[i & 15];
+		t1 = S0(S[0]) + Maj(S[0], S[1], S[2]);
+		S[7] = S[6];
+		S[6] = S[5];
+		S[5] = S[4];
+		S[4] = S[3] + t0;
+		S[3] = S[2];
+		S[2] = S[1];
+		S[1] = S[0];
+		S[0] = t0 + t1;
+	}
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < 8; i++)
+			state[j][i] += S[i][j];
+}
+
+#endif /* !SHA256_TRANSFORM_ARMV8 && !SHA256_TRANSFORM_X86_SHA && !ZKNH */
+
 static const unsigned char PAD[64] = {
 	0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -278,6 +508,58 @@ SHA256_Update(SHA256_CTX * ctx, const void *in, size_t len)
 	memcpy(ctx->buf, src, len);
 }
 
+/*
+ * Add the same number of bytes into each of count independent hashes.  The
+ * complete blocks of up to SHA256_LANES messages are compressed together.
+ */
+void
+SHA256_Update_Multi(SHA256_CTX * const *ctx, const void * const *in,
+    size_t len, size_t count)
+{
+	const unsigned char *src[SHA256_LANES];
+	uint32_t *state[SHA256_LANES];
+	size_t left[SHA256_LANES];
+	size_t blocks, b, i, n;
+
+	while (count > 0) {
+		n = count < SHA256_LANES ? count : SHA256_LANES;
+		blocks = len / 64;
+
+		/* Complete the partial blocks of previous updates */
+		for (i = 0; i < n; i++) {
+			uint32_t r = (ctx[i]->count >> 3) & 0x3f;
+			size_t head = r != 0 ? 64 - r : 0;
+
+			if (head > len)
+				head = len;
+
+			SHA256_Update(ctx[i], in[i], head);
+			src[i] = (const unsigned char *)in[i] + head;
+			state[i] = ctx[i]->state;
+			left[i] = len - head;
+
+			if (left[i] / 64 < blocks)
+				blocks = left[i] / 64;
+		}
+
+		for (b = 0; b < blocks; b++) {
+			SHA256_Transform_Multi(state, src, n);
+
+			for (i = 0; i < n; i++)
+				src[i] += 64;
+		}
+
+		for (i = 0; i < n; i++) {
+			ctx[i]->count += (uint64_t)blocks << 9;
+			SHA256_Update(ctx[i], src[i], left[i] - blocks * 64);
+		}
+
+		ctx += n;
+		in += n;
+		count -= n;
+	}
+}
+
 /*
  * SHA-256 finalization.  Pads the input data, exports the hash value,
  * and clears the context state.
@@ -34,6 +34,21 @@ __FBSDID("$FreeBSD$");
 
 #include "sha512.h"
 
+/*
+ * The scalar cryptography extension of 64-bit RISC-V targets provides the
+ * sigma functions.  There is no SHA-512 support in the ARMv8.0 and x86 SHA
+ * extensions.
+ */
+#if defined(__riscv_zknh) && __riscv_xlen == 64
+#define	SHA512_TRANSFORM_RISCV_ZKNH
+#endif
+
+/*
+ * Number of messages hashed interleaved by SHA512_Update_Multi(), so that
+ * the words of all lanes fit into a 128-bit vector register.
+ */
+#define	SHA512_LANES	2
+
 #if BYTE_ORDER == BIG_ENDIAN
 
 /* Copy a vector of big-endian uint64_t into a vector of bytes */
@@ -84,6 +99,73 @@ be64dec_vect(uint64_t *dst, const unsigned char *src, size_t len)
 #define s0(x)		(ROTR(x, 1) ^ ROTR(x, 8) ^ SHR(x, 7))
 #define s1(x)		(ROTR(x, 19) ^ ROTR(x, 61) ^ SHR(x, 6))
 
+#ifdef SHA512_TRANSFORM_RISCV_ZKNH
+#define	SHA512_ZKNH_OP(op)					\
+static inline uint64_t							\
+sha512_##op(uint64_t x)							\
+{									\
+	uint64_t r;							\
+									\
+	__asm__ ("sha512" #op " %0, %1" : "=r" (r) : "r" (x));		\
+	return (r);							\
+}
+SHA512_ZKNH_OP(sum0)
+SHA512_ZKNH_OP(sum1)
+SHA512_ZKNH_OP(sig0)
+SHA512_ZKNH_OP(sig1)
+#undef S0
+#undef S1
+#undef s0
+#undef s1
+#define S0(x)		sha512_sum0(x)
+#define S1(x)		sha512_sum1(x)
+#define s0(x)		sha512_sig0(x)
+#define s1(x)		sha512_sig1(x)
+#endif /* SHA512_TRANSFORM_RISCV_ZKNH */
+
+static const uint64_t K512[80] = {
+	0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL,
+	0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+	0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL,
+	0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+	0xd807aa98a3030242ULL, 0x12835b0145706fbeULL,
+	0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+	0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL,
+	0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+	0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL,
+	0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+	0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL,
+	0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+	0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL,
+	0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+	0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
+	0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+	0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL,
+	0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+	0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL,
+	0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+	0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL,
+	0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+	0xd192e819d6ef5218ULL, 0xd69906245565a910ULL,
+	0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+	0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL,
+	0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+	0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL,
+	0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+	0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL,
+	0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+	0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL,
+	0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+	0xca273eceea26619cULL, 0xd186b8c721c0c207ULL,
+	0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+	0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL,
+	0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+	0x28db77f523047d84ULL, 0x32caab7b40c72493ULL,
+	0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+	0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
+	0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
 /* SHA512 round function */
 #define RND(a, b, c, d, e, f, g, h, k)			\
 	t0 = h + S1(e) + Ch(e, f, g) + k;		\
@@ -206,6 +288,75 @@ SHA512_Transform(uint64_t * state, const unsigned char block[128])
 		state[i] += S[i];
 }
 
+#ifdef SHA512_TRANSFORM_RISCV_ZKNH
+
+/* The instructions are faster than any interleaving of the messages */
+static void
+SHA512_Transform_Multi(uint64_t *state[], const unsigned char *block[],
+    size_t n)
+{
+	size_t j;
+
+	for (j = 0; j < n; j++)
+		SHA512_Transform(state[j], block[j]);
+}
+
+#else /* !SHA512_TRANSFORM_RISCV_ZKNH */
+
+/* One word of each interleaved message */
+typedef uint64_t sha512_lanes
+    __attribute__((__vector_size__(8 * SHA512_LANES)));
+
+/*
+ * SHA512 block compression function for up to SHA512_LANES independent
+ * messages.  The words of all messages are processed as a vector, see
+ * SHA256_Transform_Multi().
+ */
+static void
+SHA512_Transform_Multi(uint64_t *state[], const unsigned char *block[],
+    size_t n)
+{
+	sha512_lanes W[16];
+	sha512_lanes S[8];
+	sha512_lanes t0, t1;
+	size_t i, j;
+
+	/* Unused lanes process the first message and are discarded */
+	for (j = 0; j < SHA512_LANES; j++) {
+		const uint64_t *st = state[j < n ? j : 0];
+		const unsigned char *p = block[j < n ? j : 0];
+
+		for (i = 0; i < 16; i++)
+			W[i][j] = be64dec(p + i * 8);
+		for (i = 0; i < 8; i++)
+			S[i][j] = st[i];
+	}
+
+	for (i = 0; i < 80; i++) {
+		if (i >= 16)
+			W[i & 15] += s1(W[(i - 2) & 15]) + W[(i - 7) & 15] +
+			    s0(W[(i - 15) & 15]);
+
+		t0 = S[7] + S1(S[4]) + Ch(S[4], S[5], S[6]) + K512[i] +
+		    W[i & 15];
+		t1 = S0(S[0]) + Maj(S[0], S[1], S[2]);
+		S[7] = S[6];
+		S[6] = S[5];
+		S[5] = S[4];
+		S[4] = S[3] + t0;
+		S[3] = S[2];
+		S[2] = S[1];
+		S[1] = S[0];
+		S[0] = t0 + t1;
+	}
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < 8; i++)
+			state[j][i] += S[i][j];
+}
+
+#endif /* !SHA512_TRANSFORM_RISCV_ZKNH */
+
 static const unsigned char PAD[128] = {
 	0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -301,6 +452,61 @@ SHA512_Update(SHA512_CTX * ctx, const void *in, size_t len)
 	memcpy(ctx->buf, src, len);
 }
 
+/*
+ * Add the same number of bytes into each of count independent hashes.  The
+ * complete blocks of up to SHA512_LANES messages are compressed together.
+ */
+void
+SHA512_Update_Multi(SHA512_CTX * const *ctx, const void * const *in,
+    size_t len, size_t count)
+{
+	const unsigned char *src[SHA512_LANES];
+	uint64_t *state[SHA512_LANES];
+	size_t left[SHA512_LANES];
+	size_t blocks, b, i, n;
+	uint64_t bitlen;
+
+	while (count > 0) {
+		n = count < SHA512_LANES ? count : SHA512_LANES;
+		blocks = len / 128;
+
+		/* Complete the partial blocks of previous updates */
+		for (i = 0; i < n; i++) {
+			uint64_t r = (ctx[i]->count[1] >> 3) & 0x7f;
+			size_t head = r != 0 ? 128 - r : 0;
+
+			if (head > len)
+				head = len;
+
+			SHA512_Update(ctx[i], in[i], head);
+			src[i] = (const unsigned char *)in[i] + head;
+			state[i] = ctx[i]->state;
+			left[i] = len - head;
+
+			if (left[i] / 128 < blocks)
+				blocks = left[i] / 128;
+		}
+
+		for (b = 0; b < blocks; b++) {
+			SHA512_Transform_Multi(state, src, n);
+
+			for (i = 0; i < n; i++)
+				src[i] += 128;
+		}
+
+		for (i = 0; i < n; i++) {
+			bitlen = (uint64_t)blocks << 10;
+			if ((ctx[i]->count[1] += bitlen) < bitlen)
+				ctx[i]->count[0]++;
+			SHA512_Update(ctx[i], src[i], left[i] - blocks * 128);
+		}
+
+		ctx += n;
+		in += n;
+		count -= n;
+	}
+}
+
 /*
  * SHA-512 finalization.  Pads the input data, exports the hash value,
  * and clears the context state.
@@ -23,6 +23,7 @@
 #include <inttypes.h>
 
 #include <rtems/score/schedulerimpl.h>
+#include <rtems/score/timestampimpl.h>
 
 static char bits_to_char( uint8_t bits )
 {
@@ -42,6 +43,7 @@ int rtems_cpu_info_report( const rtems_printer *printer )
 {
   uint32_t cpu_max;
   uint32_t cpu_index;
+  bool     tickless;
   int      n;
 
   cpu_max = rtems_configuration_get_maximum_processors();
@@ -82,5 +84,40 @@ int rtems_cpu_info_report( const rtems_printer *printer )
     );
   }
 
+  tickless = false;
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    tickless = tickless || _Per_CPU_Get_by_index( cpu_index )->Idle.tickless;
+  }
+
+  /* The idle statistics are only maintained in the tickless idle mode */
+  if ( !tickless ) {
+    return n;
+  }
+
+  n += rtems_printf(
+    printer,
+     "-------+-----------------+-----------------------------------------------------\n"
+     " INDEX | WAKEUPS AVOIDED | IDLE RESIDENCY [s]\n"
+     "-------+-----------------+-----------------------------------------------------\n"
+   );
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    const Per_CPU_Control *cpu;
+    struct timespec        residency;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    _Timestamp_To_timespec( &cpu->Idle.residency, &residency );
+
+    n += rtems_printf(
+      printer,
+      " %5" PRIu32 " | %15" PRIu64 " | %11" PRIuMAX ".%06ld\n",
+      cpu_index,
+      cpu->Idle.wakeups_avoided,
+      (uintmax_t) residency.tv_sec,
+      residency.tv_nsec / 1000
+    );
+  }
+
   return n;
 }
@@ -0,0 +1,184 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup libmisc_cpuuse
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_cpu_usage_latency_report() and rtems_cpu_usage_latency_reset().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/cpuuse.h>
+#include <rtems/printer.h>
+#include <rtems/score/schedulerlatencyimpl.h>
+#include <rtems/score/threadimpl.h>
+
+#if defined(RTEMS_PROFILING)
+static uint32_t latency_count( const Scheduler_Latency_histogram *histogram )
+{
+  uint32_t count;
+  size_t   i;
+
+  count = 0;
+
+  for ( i = 0; i < SCHEDULER_LATENCY_BUCKETS; ++i ) {
+    count += histogram->buckets[ i ];
+  }
+
+  return count;
+}
+
+static void latency_print_histogram(
+  const rtems_printer               *printer,
+  const Scheduler_Latency_histogram *histogram
+)
+{
+  size_t i;
+
+  rtems_printf( printer, "            |" );
+
+  for ( i = 0; i < SCHEDULER_LATENCY_BUCKETS; ++i ) {
+    uint32_t count;
+
+    count = histogram->buckets[ i ];
+
+    if ( count == 0 ) {
+      continue;
+    }
+
+    if ( i == 0 ) {
+      rtems_printf( printer, " <1us:%" PRIu32, count );
+    } else {
+      rtems_printf(
+        printer,
+        " %" PRIu32 "us:%" PRIu32,
+        ( UINT32_C( 1 ) << ( i + 9 ) ) / 1000,
+        count
+      );
+    }
+  }
+
+  rtems_printf( printer, "\n" );
+}
+
+static bool latency_visitor( Thread_Control *the_thread, void *arg )
+{
+  const rtems_printer               *printer;
+  const Scheduler_Latency_histogram *histogram;
+  char                               name[ 14 ];
+
+  printer = arg;
+  histogram = &the_thread->Latency.Histogram;
+
+  if ( latency_count( histogram ) == 0 ) {
+    return false;
+  }
+
+  _Thread_Get_name( the_thread, name, sizeof( name ) );
+
+  rtems_printf(
+    printer,
+    " 0x%08" PRIx32 " | %-13s | %9" PRIu32 " | %10" PRIu32
+      " | %10" PRIu32 " | %10" PRIu32 "\n",
+    the_thread->Object.id,
+    name,
+    latency_count( histogram ),
+    histogram->max,
+    the_thread->Latency.schedule_latency,
+    the_thread->Latency.dispatch_latency
+  );
+  latency_print_histogram( printer, histogram );
+
+  return false;
+}
+#endif
+
+void rtems_cpu_usage_latency_report( const rtems_printer *printer )
+{
+#if defined(RTEMS_PROFILING)
+  size_t i;
+
+  rtems_printf(
+     printer,
+     "-------------------------------------------------------------------------------\n"
+     "                            WAKEUP LATENCY BY THREAD\n"
+     "------------+---------------+-----------+------------+------------+-----------\n"
+     " ID         | NAME          | WAKEUPS   | MAX [ns]   | SCHED [ns] | DISP [ns]\n"
+     "------------+---------------+-----------+------------+------------+-----------\n"
+  );
+
+  rtems_task_iterate( latency_visitor, RTEMS_DECONST( rtems_printer *, printer ) );
+
+  rtems_printf(
+     printer,
+     "-------------------------------------------------------------------------------\n"
+     "                           WAKEUP LATENCY BY PRIORITY\n"
+     "------------+-----------+------------------------------------------------------\n"
+     " PRIORITY   | WAKEUPS   | MAX [ns]\n"
+     "------------+-----------+------------------------------------------------------\n"
+  );
+
+  for ( i = 0; i < SCHEDULER_LATENCY_PRIORITIES; ++i ) {
+    const Scheduler_Latency_histogram *histogram;
+
+    histogram = &_Scheduler_Latency_priorities[ i ];
+
+    if ( latency_count( histogram ) == 0 ) {
+      continue;
+    }
+
+    rtems_printf(
+      printer,
+      " %10zu | %9" PRIu32 " | %10" PRIu32 "\n",
+      i,
+      latency_count( histogram ),
+      histogram->max
+    );
+    latency_print_histogram( printer, histogram );
+  }
+#else
+  rtems_printf(
+    printer,
+    "wakeup latency statistics are only available if RTEMS is built with "
+      "profiling enabled\n"
+  );
+#endif
+}
+
+void rtems_cpu_usage_latency_reset( void )
+{
+  _Scheduler_Latency_reset();
+}
@@ -52,6 +52,7 @@ __FBSDID("$FreeBSD: src/bin/dd/dd.c,v 1.43 2004/08/15 19:10:05 rwatson Exp $");
 #endif
 
 #include <rtems.h>
+#include <rtems/libio.h>
 #include <rtems/shell.h>
 #include <rtems/shellconfig.h>
 
@@ -366,6 +367,32 @@ dd_in(rtems_shell_dd_globals* globals)
 			break;
 		}
 
+		/*
+		 * Without conversions, the bs blocks are output as they are
+		 * read, so let the file system pass them directly to the
+		 * output.
+		 */
+		if ((ddflags & (C_BS | C_NOERROR | C_PARITY | C_SPARSE |
+		    C_OSYNC | C_SYNC)) == C_BS && !(in.flags & ISTAPE) &&
+		    !(out.flags & ISTAPE)) {
+			n = rtems_sendfile(out.fd, in.fd, NULL, in.dbsz);
+			if (n == 0) {
+				in.dbrcnt = 0;
+				return;
+			}
+			if (n == -1)
+				err(exit_jump, 1, "%s", in.name);
+			st.bytes += n;
+			if ((size_t)n == in.dbsz) {
+				++st.in_full;
+				++st.out_full;
+			} else {
+				++st.in_part;
+				++st.out_part;
+			}
+			continue;
+		}
+
 		/*
 		 * Zero the buffer first if sync; if doing block operations,
 		 * use spaces.
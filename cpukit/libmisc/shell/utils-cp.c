@@ -62,6 +62,8 @@ __RCSID("$NetBSD: utils.c,v 1.29 2005/10/15 18:22:18 christos Exp $");
 #include <string.h>
 #include <unistd.h>
 
+#include <rtems/libio.h>
+
 #include "extern-cp.h"
 
 #define lchmod  chmod
@@ -69,6 +71,8 @@ __RCSID("$NetBSD: utils.c,v 1.29 2005/10/15 18:22:18 christos Exp $");
 
 #define cp_pct(x, y)    ((y == 0) ? 0 : (int)(100.0 * (x) / (y)))
 
+#define SENDFILE_CHUNK  (1024 * 1024)
+
 int
 set_utimes(const char *file, struct stat *fs)
 {
@@ -218,7 +222,28 @@ copy_file(rtems_shell_cp_globals* cp_globals RTEMS_UNUSED, FTSENT *entp, int dne
 			}
 		} else
 #endif
-		{
+		if (S_ISREG(fs->st_mode)) {
+			/*
+			 * Let the file system pass the data directly to the
+			 * destination.
+			 */
+			wtotal = 0;
+			while ((wcount = rtems_sendfile(to_fd, from_fd, NULL,
+			    SENDFILE_CHUNK)) > 0) {
+				wtotal += wcount;
+				if (info) {
+					info = 0;
+					(void)fprintf(stderr,
+					    "%s -> %s %3d%%\n",
+					    entp->fts_path, to.p_path,
+					    cp_pct(wtotal, fs->st_size));
+				}
+			}
+			if (wcount < 0) {
+				warn("%s", to.p_path);
+				rval = 1;
+			}
+		} else {
 			wtotal = 0;
 			while ((rcount = read(from_fd, buf, MAX_READ)) > 0) {
 				for (bufp = buf, wresid = rcount; ;
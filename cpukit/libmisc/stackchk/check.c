@@ -66,6 +66,26 @@
  */
 static bool Stack_check_Initialized;
 
+/*
+ *  Variable to indicate that the stack checker runs in the sampling mode.
+ *  In this mode, the thread stacks are not filled with the pattern.  The
+ *  stack usage is the maximum of the stack pointer samples taken at context
+ *  switches and the depth of the deepest overwritten guard word.
+ */
+static bool Stack_check_Sampling;
+
+/*
+ *  Object index of the user extension which samples the stack pointer.  The
+ *  deepest sample of a thread is stored in its extension slot with this index.
+ */
+static uint32_t Stack_check_Sampling_index;
+
+/*
+ *  Count of guard words which divide the usable stack of a thread into
+ *  equal parts in the sampling mode.
+ */
+#define GUARD_WORD_COUNT 7
+
 /*
  *  The "magic pattern" used to mark the end of the stack.
  */
@@ -154,6 +174,103 @@ static void Stack_check_Dope_stack( Stack_Control *stack )
   );
 }
 
+/*
+ *  Get the guard word with the specified index.  The index zero is the
+ *  guard word closest to the stack start.
+ */
+static uint32_t *Stack_check_Get_guard_word(
+  const Stack_Control *stack,
+  uint32_t             index
+)
+{
+  char   *low;
+  size_t  size;
+  size_t  depth;
+
+  low = Stack_check_Usable_stack_start( stack );
+  size = Stack_check_Usable_stack_size( stack );
+  depth = ( size / ( GUARD_WORD_COUNT + 1 ) ) * ( index + 1 );
+
+  #if (CPU_STACK_GROWS_UP == TRUE)
+    return (uint32_t *) RTEMS_ALIGN_DOWN(
+      (uintptr_t) low + depth,
+      sizeof( uint32_t )
+    );
+  #else
+    return (uint32_t *) RTEMS_ALIGN_DOWN(
+      (uintptr_t) low + size - depth,
+      sizeof( uint32_t )
+    );
+  #endif
+}
+
+static void Stack_check_Add_guard_words( Stack_Control *stack )
+{
+  uint32_t index;
+
+  for ( index = 0; index < GUARD_WORD_COUNT; ++index ) {
+    *Stack_check_Get_guard_word( stack, index ) = U32_PATTERN;
+  }
+}
+
+/*
+ *  Get the depth of the deepest overwritten guard word.  This catches the
+ *  stack usage between two context switches, for example by interrupts.
+ */
+static size_t Stack_check_Get_guard_word_usage( const Stack_Control *stack )
+{
+  uint32_t index;
+
+  index = GUARD_WORD_COUNT;
+
+  while ( index > 0 ) {
+    const uint32_t *guard;
+
+    --index;
+    guard = Stack_check_Get_guard_word( stack, index );
+
+    if ( *guard != U32_PATTERN ) {
+      return Stack_check_Calculate_used(
+        Stack_check_Usable_stack_start( stack ),
+        Stack_check_Usable_stack_size( stack ),
+        guard
+      );
+    }
+  }
+
+  return 0;
+}
+
+static size_t Stack_check_Get_sampled_usage( const Thread_Control *the_thread )
+{
+  return (size_t) (uintptr_t)
+    the_thread->extensions[ Stack_check_Sampling_index ];
+}
+
+/*
+ *  Record the current stack pointer of the thread as a high water mark
+ *  sample.  This must be called on the stack of the thread.
+ */
+static inline void Stack_check_Sample_stack_pointer(
+  Thread_Control *the_thread
+)
+{
+  const Stack_Control *stack;
+  size_t               used;
+
+  stack = &the_thread->Start.Initial_stack;
+  used = Stack_check_Calculate_used(
+    Stack_check_Usable_stack_start( stack ),
+    Stack_check_Usable_stack_size( stack ),
+    __builtin_frame_address( 0 )
+  );
+
+  if ( used > Stack_check_Get_sampled_usage( the_thread ) ) {
+    the_thread->extensions[ Stack_check_Sampling_index ] =
+      (void *) (uintptr_t) used;
+  }
+}
+
 static void Stack_check_Add_sanity_pattern( Stack_Control *stack )
 {
   memcpy(
@@ -188,6 +305,20 @@ bool rtems_stack_checker_create_extension(
   return true;
 }
 
+bool rtems_stack_checker_sampling_create_extension(
+  Thread_Control *running RTEMS_UNUSED,
+  Thread_Control *the_thread
+)
+{
+  Stack_check_Initialized = true;
+
+  /* The extension slot with the sampled usage starts zero-initialized */
+  Stack_check_Add_guard_words( &the_thread->Start.Initial_stack );
+  Stack_check_Add_sanity_pattern( &the_thread->Start.Initial_stack );
+
+  return true;
+}
+
 void rtems_stack_checker_begin_extension( Thread_Control *executing )
 {
   Per_CPU_Control *cpu_self;
@@ -342,6 +473,51 @@ void rtems_stack_checker_switch_extension(
   }
 }
 
+void rtems_stack_checker_sampling_switch_extension(
+  Thread_Control *running,
+  Thread_Control *heir
+)
+{
+  (void) running;
+  (void) heir;
+
+  /*
+   *  Sample the thread which owns the stack of this extension, see the
+   *  frame pointer check above.
+   */
+#if defined(RTEMS_SMP)
+  Stack_check_Sample_stack_pointer( heir );
+#else
+  Stack_check_Sample_stack_pointer( running );
+#endif
+}
+
+void rtems_stack_checker_sampling_initialize( void )
+{
+  static const rtems_extensions_table sampling_extensions = {
+    .thread_switch = rtems_stack_checker_sampling_switch_extension
+  };
+
+  rtems_status_code sc;
+  rtems_id          id;
+
+  sc = rtems_extension_create(
+    rtems_build_name( 'S', 'T', 'C', 'K' ),
+    &sampling_extensions,
+    &id
+  );
+
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    rtems_fatal(
+      RTEMS_FATAL_SOURCE_STACK_CHECKER,
+      rtems_build_name( 'S', 'A', 'M', 'P' )
+    );
+  }
+
+  Stack_check_Sampling_index = rtems_object_id_get_index( id );
+  Stack_check_Sampling = true;
+}
+
 /*
  *  Check if blown
  */
@@ -352,6 +528,10 @@ bool rtems_stack_checker_is_blown( void )
   executing = _Thread_Get_executing();
   rtems_stack_checker_switch_extension( executing, executing );
 
+  if ( Stack_check_Sampling ) {
+    Stack_check_Sample_stack_pointer( executing );
+  }
+
   /*
    * The Stack Pointer and the Pattern Area are OK so return false.
    */
@@ -397,88 +577,159 @@ static inline void *Stack_check_Find_high_water_mark(
   return (void *)0;
 }
 
-static bool Stack_check_Dump_stack_usage(
-  const Stack_Control *stack,
-  const void          *current,
-  const char          *name,
-  uint32_t             id,
-  const rtems_printer *printer
+static size_t Stack_check_Get_usage(
+  const Stack_Control  *stack,
+  const Thread_Control *the_thread
 )
 {
-  uint32_t  size;
-  uint32_t  used;
-  void     *low;
-  void     *high_water_mark;
+  void   *low;
+  size_t  size;
+  void   *high_water_mark;
 
-  /* This is likely to occur if the stack checker is not actually enabled */
-  if ( stack->area == NULL ) {
-    return false;
+  if ( the_thread != NULL && Stack_check_Sampling ) {
+    size_t sampled_usage = Stack_check_Get_sampled_usage( the_thread );
+    size_t guard_word_usage = Stack_check_Get_guard_word_usage( stack );
+
+    if ( sampled_usage > guard_word_usage ) {
+      return sampled_usage;
+    }
+
+    return guard_word_usage;
   }
 
   low  = Stack_check_Usable_stack_start(stack);
   size = Stack_check_Usable_stack_size(stack);
-
   high_water_mark = Stack_check_Find_high_water_mark(low, size);
 
   if ( high_water_mark )
-    used = Stack_check_Calculate_used( low, size, high_water_mark );
-  else
-    used = 0;
+    return Stack_check_Calculate_used( low, size, high_water_mark );
 
-  rtems_printf(
-    printer,
-    "0x%08" PRIx32 " %-21s 0x%08" PRIxPTR " 0x%08" PRIxPTR " 0x%08" PRIxPTR " %6" PRId32 " ",
-    id,
-    name,
-    (uintptr_t) stack->area,
-    (uintptr_t) stack->area + (uintptr_t) stack->size - 1,
-    (uintptr_t) current,
-    size
-  );
+  return 0;
+}
 
-  if (Stack_check_Initialized) {
-    rtems_printf( printer, "%6" PRId32 "\n", used );
-  } else {
-    rtems_printf( printer, "N/A\n" );
+static bool Stack_check_Visit_stack(
+  const Stack_Control         *stack,
+  const Thread_Control        *the_thread,
+  const void                  *current,
+  const char                  *name,
+  rtems_id                     id,
+  rtems_stack_checker_visitor  visit,
+  void                        *arg
+)
+{
+  rtems_stack_checker_info info;
+
+  /* This is likely to occur if the stack checker is not actually enabled */
+  if ( stack->area == NULL ) {
+    return false;
   }
 
-  return false;
+  info.id = id;
+  info.name = name;
+  info.current = current;
+  info.begin = stack->area;
+  info.size = stack->size;
+  info.available = Stack_check_Usable_stack_size( stack );
+  info.used = Stack_check_Get_usage( stack, the_thread );
+
+  return ( *visit )( &info, arg );
 }
 
-static bool Stack_check_Dump_threads_usage(
+typedef struct {
+  rtems_stack_checker_visitor  visit;
+  void                        *arg;
+  bool                         done;
+} Stack_check_Visitor_context;
+
+static bool Stack_check_Visit_thread(
   Thread_Control *the_thread,
   void           *arg
 )
 {
-  char                 name[ 22 ];
-  const rtems_printer *printer;
+  Stack_check_Visitor_context *ctx;
+  char                         name[ 22 ];
   uintptr_t sp = _CPU_Context_Get_SP( &the_thread->Registers );
 
-  printer = arg;
+  ctx = arg;
   _Thread_Get_name( the_thread, name, sizeof( name ) );
-  Stack_check_Dump_stack_usage(
+  ctx->done = Stack_check_Visit_stack(
     &the_thread->Start.Initial_stack,
+    the_thread,
     (void *) sp,
     name,
     the_thread->Object.id,
-    printer
+    ctx->visit,
+    ctx->arg
   );
-  return false;
+  return ctx->done;
 }
 
-static void Stack_check_Dump_interrupt_stack_usage(
-  const Stack_Control *stack,
-  uint32_t             id,
-  const rtems_printer *printer
+void rtems_stack_checker_iterate(
+  rtems_stack_checker_visitor  visit,
+  void                        *arg
+)
+{
+  Stack_check_Visitor_context ctx;
+  uint32_t                    cpu_max;
+  uint32_t                    cpu_index;
+
+  ctx.visit = visit;
+  ctx.arg = arg;
+  ctx.done = false;
+  rtems_task_iterate( Stack_check_Visit_thread, &ctx );
+
+  if ( ctx.done ) {
+    return;
+  }
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    bool done;
+
+    done = Stack_check_Visit_stack(
+      &Stack_check_Interrupt_stack[ cpu_index ],
+      NULL,
+      NULL,
+      "Interrupt Stack",
+      cpu_index,
+      visit,
+      arg
+    );
+
+    if ( done ) {
+      break;
+    }
+  }
+}
+
+static bool Stack_check_Dump_stack_usage(
+  const rtems_stack_checker_info *info,
+  void                           *arg
 )
 {
-  Stack_check_Dump_stack_usage(
-    stack,
-    NULL,
-    "Interrupt Stack",
-    id,
-    printer
+  const rtems_printer *printer;
+
+  printer = arg;
+
+  rtems_printf(
+    printer,
+    "0x%08" PRIx32 " %-21s 0x%08" PRIxPTR " 0x%08" PRIxPTR " 0x%08" PRIxPTR " %6" PRId32 " ",
+    info->id,
+    info->name,
+    (uintptr_t) info->begin,
+    (uintptr_t) info->begin + (uintptr_t) info->size - 1,
+    (uintptr_t) info->current,
+    (uint32_t) info->available
   );
+
+  if (Stack_check_Initialized) {
+    rtems_printf( printer, "%6" PRId32 "\n", (uint32_t) info->used );
+  } else {
+    rtems_printf( printer, "N/A\n" );
+  }
+
+  return false;
 }
 
 /*
@@ -489,30 +740,17 @@ void rtems_stack_checker_report_usage_with_plugin(
   const rtems_printer* printer
 )
 {
-  uint32_t cpu_max;
-  uint32_t cpu_index;
-
   rtems_printf(
      printer,
      "                             STACK USAGE BY THREAD\n"
      "ID         NAME                  LOW        HIGH       CURRENT     AVAIL   USED\n"
   );
 
-  /* iterate over all threads and dump the usage */
-  rtems_task_iterate(
-    Stack_check_Dump_threads_usage,
+  /* iterate over all threads and interrupt stacks and dump the usage */
+  rtems_stack_checker_iterate(
+    Stack_check_Dump_stack_usage,
     RTEMS_DECONST( rtems_printer *, printer )
   );
-
-  cpu_max = rtems_scheduler_get_processor_maximum();
-
-  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
-    Stack_check_Dump_interrupt_stack_usage(
-      &Stack_check_Interrupt_stack[ cpu_index ],
-      cpu_index,
-      printer
-    );
-  }
 }
 
 void rtems_stack_checker_report_usage( void )
@@ -65,6 +65,12 @@
 
 #define MAX_NAME_FIELD_SIZE      99
 
+/*
+ * Size of the data buffer used to extract from a file.  Files are read and
+ * written in pieces of this size, so that the file systems see large requests.
+ */
+#define UNTAR_FILE_BUFFER_SIZE   (32 * 1024)
+
 static int _rtems_tar_header_checksum(const char *bufr);
 
 /*
@@ -100,6 +106,49 @@ Print_Error(const rtems_printer *printer, const char* message, const char* path)
                message, path, errno, strerror(errno));
 }
 
+/*
+ * Read until the buffer is full or the end of file.  Returns the count of
+ * bytes read.
+ */
+static size_t
+Read_All(int fd, char *buf, size_t size)
+{
+  size_t done = 0;
+
+  while (done < size) {
+    ssize_t n = read(fd, &buf[done], size - done);
+
+    if (n <= 0) {
+      break;
+    }
+
+    done += (size_t) n;
+  }
+
+  return done;
+}
+
+/*
+ * Write the whole buffer to the file.  Returns the count of bytes written.
+ */
+static size_t
+Write_All(int fd, const char *buf, size_t size)
+{
+  size_t done = 0;
+
+  while (done < size) {
+    ssize_t n = write(fd, &buf[done], size - done);
+
+    if (n <= 0) {
+      break;
+    }
+
+    done += (size_t) n;
+  }
+
+  return done;
+}
+
 /*
  * Make the directory path for a file if it does not exist.
  */
@@ -312,27 +361,21 @@ Untar_FromMemory_Print(
         Print_Error(printer, "open", ctx.file_path);
         ptr += 512 * ctx.nblocks;
       } else {
-        unsigned long sizeToGo = ctx.file_size;
-        ssize_t       len;
-        ssize_t       i;
-        ssize_t       n;
-
         /*
-         * Read out the data.  There are nblocks of data where nblocks is the
-         * file_size rounded to the nearest 512-byte boundary.
+         * Write out the data with a single request.  There are nblocks of
+         * data where nblocks is the file_size rounded to the nearest 512-byte
+         * boundary.
          */
-        for (i = 0; i < ctx.nblocks; i++) {
-          len = ((sizeToGo < 512L) ? (sizeToGo) : (512L));
-          n = write(fd, &tar_ptr[ptr], len);
-          if (n != len) {
-            Print_Error(printer, "write", ctx.file_path);
-            retval  = UNTAR_FAIL;
-            break;
-          }
-          ptr += 512;
-          sizeToGo -= n;
+        if (ptr + ctx.file_size > size ||
+            Write_All(fd, &tar_ptr[ptr], ctx.file_size) != ctx.file_size) {
+          Print_Error(printer, "write", ctx.file_path);
+          retval = UNTAR_FAIL;
         }
+        ptr += 512 * ctx.nblocks;
         close(fd);
+
+        if (retval != UNTAR_SUCCESSFUL)
+          break;
       }
 
     }
@@ -400,7 +443,6 @@ Untar_FromFile_Print(
   char                *bufr;
   ssize_t              n;
   int                  retval;
-  unsigned long        i;
   char                 buf[UNTAR_FILE_NAME_SIZE];
   Untar_HeaderContext  ctx;
 
@@ -410,7 +452,7 @@ Untar_FromFile_Print(
     return UNTAR_FAIL;
   }
 
-  bufr = (char *)malloc(512);
+  bufr = (char *)malloc(UNTAR_FILE_BUFFER_SIZE);
   if (bufr == NULL) {
     close(fd);
     return(UNTAR_FAIL);
@@ -445,12 +487,31 @@ Untar_FromFile_Print(
         retval = UNTAR_FAIL;
         break;
       } else {
-        for (i = 0; i < ctx.nblocks; i++) {
-          n = read(fd, bufr, 512);
-          n = MIN(n, ctx.file_size - (i * 512UL));
-          (void) write(out_fd, bufr, n);
+        unsigned long sizeToGo = ctx.file_size;
+        unsigned long blocksToGo = ctx.nblocks;
+
+        /*
+         * Read and write the data in large pieces.  The last piece includes
+         * the padding of the last block.
+         */
+        while (blocksToGo > 0) {
+          size_t len = MIN(blocksToGo * 512UL, UNTAR_FILE_BUFFER_SIZE);
+
+          if (Read_All(fd, bufr, len) != len) {
+            break;
+          }
+
+          blocksToGo -= len / 512;
+          len = MIN(len, sizeToGo);
+          (void) Write_All(out_fd, bufr, len);
+          sizeToGo -= len;
         }
         close(out_fd);
+
+        if (blocksToGo > 0) {
+          /* The archive is truncated */
+          break;
+        }
       }
     }
   }
@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/untar.h>
+
+#define UNTAR_PIPE_TASK_STACK_SIZE (4 * RTEMS_MINIMUM_STACK_SIZE)
+
+static void Untar_PipeContext_Hand_over(Untar_PipeContext *ctx)
+{
+  rtems_mutex_lock(&ctx->mutex);
+  ctx->sizes[ctx->produce] = ctx->fill;
+  ctx->produce = (ctx->produce + 1) % UNTAR_PIPE_BUFFER_COUNT;
+  ++ctx->full;
+  ctx->fill = 0;
+  rtems_condition_variable_broadcast(&ctx->changed);
+  rtems_mutex_unlock(&ctx->mutex);
+}
+
+static rtems_task Untar_PipeContext_Worker(rtems_task_argument arg)
+{
+  Untar_PipeContext *ctx = (Untar_PipeContext *) arg;
+
+  rtems_mutex_lock(&ctx->mutex);
+
+  while (true) {
+    char *buf;
+    size_t size;
+    int status;
+
+    while (ctx->full == 0 && !ctx->done) {
+      rtems_condition_variable_wait(&ctx->changed, &ctx->mutex);
+    }
+
+    if (ctx->full == 0) {
+      rtems_id finisher = ctx->finisher;
+
+      rtems_mutex_unlock(&ctx->mutex);
+      rtems_event_transient_send(finisher);
+      rtems_task_exit();
+    }
+
+    buf = ctx->buffers[ctx->consume];
+    size = ctx->sizes[ctx->consume];
+    status = ctx->status;
+    rtems_mutex_unlock(&ctx->mutex);
+
+    /* After an error, drain the buffers so that the producer does not block */
+    if (status == UNTAR_SUCCESSFUL) {
+      status = Untar_FromChunk_Print(&ctx->base, buf, size, ctx->printer);
+    }
+
+    rtems_mutex_lock(&ctx->mutex);
+
+    if (ctx->status == UNTAR_SUCCESSFUL) {
+      ctx->status = status;
+    }
+
+    ctx->consume = (ctx->consume + 1) % UNTAR_PIPE_BUFFER_COUNT;
+    --ctx->full;
+    rtems_condition_variable_broadcast(&ctx->changed);
+  }
+}
+
+int Untar_PipeContext_Init(
+  Untar_PipeContext *ctx,
+  void *buffer,
+  size_t buffer_size,
+  rtems_task_priority priority,
+  const rtems_printer *printer
+)
+{
+  rtems_status_code sc;
+  size_t size;
+  size_t i;
+
+  size = buffer_size / UNTAR_PIPE_BUFFER_COUNT;
+  if (size == 0) {
+    return UNTAR_FAIL;
+  }
+
+  memset(ctx, 0, sizeof(*ctx));
+  Untar_ChunkContext_Init(&ctx->base);
+  ctx->printer = printer;
+  ctx->buffer_size = size;
+  ctx->status = UNTAR_SUCCESSFUL;
+
+  for (i = 0; i < UNTAR_PIPE_BUFFER_COUNT; ++i) {
+    ctx->buffers[i] = (char *) buffer + i * size;
+  }
+
+  if (priority == RTEMS_CURRENT_PRIORITY) {
+    sc = rtems_task_set_priority(RTEMS_SELF, RTEMS_CURRENT_PRIORITY, &priority);
+    if (sc != RTEMS_SUCCESSFUL) {
+      return UNTAR_FAIL;
+    }
+  }
+
+  sc = rtems_task_create(
+    rtems_build_name('U', 'T', 'A', 'R'),
+    priority,
+    UNTAR_PIPE_TASK_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  if (sc != RTEMS_SUCCESSFUL) {
+    return UNTAR_FAIL;
+  }
+
+  rtems_mutex_init(&ctx->mutex, "Untar Pipe");
+  rtems_condition_variable_init(&ctx->changed, "Untar Pipe");
+
+  sc = rtems_task_start(
+    ctx->worker,
+    Untar_PipeContext_Worker,
+    (rtems_task_argument) ctx
+  );
+  if (sc != RTEMS_SUCCESSFUL) {
+    rtems_task_delete(ctx->worker);
+    rtems_condition_variable_destroy(&ctx->changed);
+    rtems_mutex_destroy(&ctx->mutex);
+    return UNTAR_FAIL;
+  }
+
+  return UNTAR_SUCCESSFUL;
+}
+
+void *Untar_PipeContext_Get_buffer(Untar_PipeContext *ctx, size_t *size)
+{
+  rtems_mutex_lock(&ctx->mutex);
+
+  while (ctx->full == UNTAR_PIPE_BUFFER_COUNT) {
+    rtems_condition_variable_wait(&ctx->changed, &ctx->mutex);
+  }
+
+  rtems_mutex_unlock(&ctx->mutex);
+
+  *size = ctx->buffer_size - ctx->fill;
+  return ctx->buffers[ctx->produce] + ctx->fill;
+}
+
+int Untar_PipeContext_Commit(Untar_PipeContext *ctx, size_t size)
+{
+  int status;
+
+  ctx->fill += size;
+
+  if (ctx->fill == ctx->buffer_size) {
+    Untar_PipeContext_Hand_over(ctx);
+  }
+
+  rtems_mutex_lock(&ctx->mutex);
+  status = ctx->status;
+  rtems_mutex_unlock(&ctx->mutex);
+
+  return status;
+}
+
+int Untar_FromPipeChunk(
+  Untar_PipeContext *ctx,
+  const void *chunk,
+  size_t chunk_size
+)
+{
+  const char *buf = chunk;
+  int status = UNTAR_SUCCESSFUL;
+
+  while (chunk_size > 0 && status == UNTAR_SUCCESSFUL) {
+    void *out;
+    size_t size;
+
+    out = Untar_PipeContext_Get_buffer(ctx, &size);
+    size = chunk_size < size ? chunk_size : size;
+    memcpy(out, buf, size);
+    buf += size;
+    chunk_size -= size;
+    status = Untar_PipeContext_Commit(ctx, size);
+  }
+
+  return status;
+}
+
+int Untar_PipeContext_Finish(Untar_PipeContext *ctx)
+{
+  if (ctx->fill > 0) {
+    Untar_PipeContext_Hand_over(ctx);
+  }
+
+  rtems_mutex_lock(&ctx->mutex);
+  ctx->done = true;
+  ctx->finisher = rtems_task_self();
+  rtems_condition_variable_broadcast(&ctx->changed);
+  rtems_mutex_unlock(&ctx->mutex);
+
+  rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+
+  rtems_condition_variable_destroy(&ctx->changed);
+  rtems_mutex_destroy(&ctx->mutex);
+
+  /* The archive ended within a file */
+  if (ctx->base.out_fd >= 0) {
+    close(ctx->base.out_fd);
+    ctx->base.out_fd = -1;
+  }
+
+  return ctx->status;
+}
@@ -32,6 +32,7 @@ int Untar_GzChunkContext_Init(
   Untar_ChunkContext_Init(&ctx->base);
   ctx->inflateBuffer = inflateBuffer;
   ctx->inflateBufferSize = inflateBufferSize;
+  ctx->pipe = NULL;
   memset(&ctx->strm, 0, sizeof(ctx->strm));
   ret = inflateInit2(&ctx->strm, 32 + MAX_WBITS);
   if (ret != Z_OK){
@@ -55,15 +56,29 @@ int Untar_FromGzChunk_Print(
 
     /* Inflate until output buffer is not full */
   do {
-    ctx->strm.next_out = (Bytef *) ctx->inflateBuffer;
-    ctx->strm.avail_out = ctx->inflateBufferSize;
+    void *out;
+    size_t out_size;
+
+    /* Inflate directly into the buffers of the extraction task */
+    if (ctx->pipe != NULL) {
+      out = Untar_PipeContext_Get_buffer(ctx->pipe, &out_size);
+    } else {
+      out = ctx->inflateBuffer;
+      out_size = ctx->inflateBufferSize;
+    }
+
+    ctx->strm.next_out = (Bytef *) out;
+    ctx->strm.avail_out = out_size;
 
     status = inflate(&ctx->strm, Z_NO_FLUSH);
     if (status == Z_OK || status == Z_STREAM_END) {
-      size_t inflated_size =
-        ctx->inflateBufferSize - ctx->strm.avail_out;
-      untar_succesful = Untar_FromChunk_Print(&ctx->base,
-        ctx->inflateBuffer, inflated_size, NULL);
+      size_t inflated_size = out_size - ctx->strm.avail_out;
+      if (ctx->pipe != NULL) {
+        untar_succesful = Untar_PipeContext_Commit(ctx->pipe, inflated_size);
+      } else {
+        untar_succesful = Untar_FromChunk_Print(&ctx->base,
+          out, inflated_size, NULL);
+      }
       if (untar_succesful != UNTAR_SUCCESSFUL){
         return untar_succesful;
       }
@@ -23,10 +23,12 @@ int Untar_XzChunkContext_Init(
   int status = UNTAR_SUCCESSFUL;
 
   xz_crc32_init();
+  xz_crc64_init();
 
   Untar_ChunkContext_Init(&ctx->base);
   ctx->inflateBuffer = inflateBuffer;
   ctx->inflateBufferSize = inflateBufferSize;
+  ctx->pipe = NULL;
   ctx->strm = xz_dec_init(mode, dict_max);
   if (ctx->strm == NULL) {
     status = UNTAR_FAIL;
@@ -51,16 +53,31 @@ int Untar_FromXzChunk_Print(
   ctx->buf.in = (const uint8_t*) chunk;
   ctx->buf.in_pos = 0;
   ctx->buf.in_size = chunk_size;
-  ctx->buf.out = (uint8_t *) ctx->inflateBuffer;
 
   /* Inflate until output buffer is not full */
   do {
+    /* Decompress directly into the buffers of the extraction task */
+    if (ctx->pipe != NULL) {
+      size_t out_size;
+
+      ctx->buf.out = Untar_PipeContext_Get_buffer(ctx->pipe, &out_size);
+      ctx->buf.out_size = out_size;
+    } else {
+      ctx->buf.out = (uint8_t *) ctx->inflateBuffer;
+      ctx->buf.out_size = ctx->inflateBufferSize;
+    }
     ctx->buf.out_pos = 0;
-    ctx->buf.out_size = ctx->inflateBufferSize;
     status = xz_dec_run(ctx->strm, &ctx->buf);
     if (status == XZ_OPTIONS_ERROR)
       status = XZ_OK;
-    if (status == XZ_OK && ctx->buf.out_pos != 0) {
+    /* The last output of the stream comes along with XZ_STREAM_END */
+    if ((status == XZ_OK || status == XZ_STREAM_END) && ctx->pipe != NULL) {
+      untar_status = Untar_PipeContext_Commit(ctx->pipe, ctx->buf.out_pos);
+      if (untar_status != UNTAR_SUCCESSFUL) {
+        break;
+      }
+    } else if ((status == XZ_OK || status == XZ_STREAM_END) &&
+               ctx->buf.out_pos != 0) {
       untar_status = Untar_FromChunk_Print(&ctx->base,
                                            ctx->inflateBuffer,
                                            ctx->buf.out_pos,
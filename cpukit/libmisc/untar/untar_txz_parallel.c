@@ -0,0 +1,484 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/untar.h>
+
+#define UNTAR_XZ_TASK_STACK_SIZE (4 * RTEMS_MINIMUM_STACK_SIZE)
+
+#define UNTAR_XZ_HEADER_SIZE 12
+
+#define UNTAR_XZ_FOOTER_SIZE 12
+
+/* Inflate buffer size for archives which cannot be decoded in blocks */
+#define UNTAR_XZ_CHUNK_BUFFER_SIZE (32 * 1024)
+
+/*
+ * Index indicator, record count, one record with two variable-length
+ * integers, padding, CRC32, and the stream footer.
+ */
+#define UNTAR_XZ_TAIL_MAX (1 + 1 + 2 * 9 + 3 + 4 + UNTAR_XZ_FOOTER_SIZE)
+
+typedef struct {
+  const uint8_t *in;
+  size_t padded_size;
+  uint64_t unpadded_size;
+  size_t uncompressed_size;
+  size_t out_offset;
+} Untar_XzBlock;
+
+typedef struct {
+  const uint8_t *header;
+  Untar_XzBlock *blocks;
+  size_t block_count;
+  uint8_t *out;
+  size_t out_size;
+  uint32_t dict_max;
+  rtems_mutex mutex;
+  rtems_condition_variable finished;
+  size_t next;
+  uint32_t active;
+  int status;
+} Untar_XzParallelContext;
+
+static const uint8_t Untar_Xz_header_magic[] =
+  { 0xfd, '7', 'z', 'X', 'Z', 0x00 };
+
+static uint32_t Untar_Xz_Get_le32(const uint8_t *buf)
+{
+  return (uint32_t) buf[0] | ((uint32_t) buf[1] << 8)
+    | ((uint32_t) buf[2] << 16) | ((uint32_t) buf[3] << 24);
+}
+
+static void Untar_Xz_Put_le32(uint8_t *buf, uint32_t val)
+{
+  buf[0] = (uint8_t) val;
+  buf[1] = (uint8_t) (val >> 8);
+  buf[2] = (uint8_t) (val >> 16);
+  buf[3] = (uint8_t) (val >> 24);
+}
+
+static bool Untar_Xz_Get_vli(
+  const uint8_t **in,
+  const uint8_t *end,
+  uint64_t *val
+)
+{
+  int i;
+
+  *val = 0;
+
+  for (i = 0; i < 9 && *in < end; ++i) {
+    uint8_t byte = *(*in)++;
+
+    *val |= (uint64_t) (byte & 0x7f) << (7 * i);
+
+    if ((byte & 0x80) == 0) {
+      /* Reject non-minimal encodings like the xz decoder does */
+      return i == 0 || byte != 0;
+    }
+  }
+
+  return false;
+}
+
+static size_t Untar_Xz_Put_vli(uint8_t *buf, uint64_t val)
+{
+  size_t i = 0;
+
+  while (val >= 0x80) {
+    buf[i++] = (uint8_t) (val | 0x80);
+    val >>= 7;
+  }
+
+  buf[i++] = (uint8_t) val;
+  return i;
+}
+
+/*
+ * Gets the blocks of a single stream archive from its index.  Returns false,
+ * if the archive has no valid index at its end, for example in case of
+ * concatenated streams or stream padding.
+ */
+static bool Untar_Xz_Get_blocks(
+  Untar_XzParallelContext *ctx,
+  const uint8_t *xz,
+  size_t xz_size
+)
+{
+  const uint8_t *footer;
+  const uint8_t *index;
+  const uint8_t *index_end;
+  const uint8_t *in;
+  uint64_t count;
+  size_t backward_size;
+  size_t offset;
+  size_t out_offset;
+  size_t i;
+
+  if (xz_size < UNTAR_XZ_HEADER_SIZE + UNTAR_XZ_FOOTER_SIZE) {
+    return false;
+  }
+
+  footer = xz + xz_size - UNTAR_XZ_FOOTER_SIZE;
+
+  if (
+    memcmp(xz, Untar_Xz_header_magic, sizeof(Untar_Xz_header_magic)) != 0
+      || footer[10] != 'Y' || footer[11] != 'Z'
+      || memcmp(&xz[6], &footer[8], 2) != 0
+      || xz_crc32(&footer[4], 6, 0) != Untar_Xz_Get_le32(footer)
+  ) {
+    return false;
+  }
+
+  backward_size = ((size_t) Untar_Xz_Get_le32(&footer[4]) + 1) * 4;
+  if (backward_size > xz_size - UNTAR_XZ_HEADER_SIZE - UNTAR_XZ_FOOTER_SIZE) {
+    return false;
+  }
+
+  index = footer - backward_size;
+  index_end = footer - 4;
+
+  if (
+    index[0] != 0x00
+      || xz_crc32(index, backward_size - 4, 0) != Untar_Xz_Get_le32(index_end)
+  ) {
+    return false;
+  }
+
+  in = index + 1;
+  if (!Untar_Xz_Get_vli(&in, index_end, &count) || count == 0) {
+    return false;
+  }
+
+  if (count > (uint64_t) (index_end - in) / 2) {
+    return false;
+  }
+
+  ctx->blocks = calloc((size_t) count, sizeof(*ctx->blocks));
+  if (ctx->blocks == NULL) {
+    return false;
+  }
+
+  ctx->block_count = (size_t) count;
+  offset = UNTAR_XZ_HEADER_SIZE;
+  out_offset = 0;
+
+  for (i = 0; i < ctx->block_count; ++i) {
+    Untar_XzBlock *block = &ctx->blocks[i];
+    uint64_t unpadded;
+    uint64_t uncompressed;
+    uint64_t padded;
+
+    if (
+      !Untar_Xz_Get_vli(&in, index_end, &unpadded)
+        || !Untar_Xz_Get_vli(&in, index_end, &uncompressed)
+    ) {
+      return false;
+    }
+
+    padded = (unpadded + 3) & ~(uint64_t) 3;
+
+    if (
+      unpadded == 0
+        || padded > (uint64_t) (index - xz) - offset
+        || uncompressed > SIZE_MAX - out_offset
+    ) {
+      return false;
+    }
+
+    block->in = xz + offset;
+    block->padded_size = (size_t) padded;
+    block->unpadded_size = unpadded;
+    block->uncompressed_size = (size_t) uncompressed;
+    block->out_offset = out_offset;
+    offset += (size_t) padded;
+    out_offset += (size_t) uncompressed;
+  }
+
+  ctx->header = xz;
+  ctx->out_size = out_offset;
+  return xz + offset == index;
+}
+
+/*
+ * Produces the index and stream footer of a stream which contains only the
+ * block.  This lets the xz decoder validate the block sizes without a change
+ * to the decoder.
+ */
+static size_t Untar_Xz_Make_tail(
+  const Untar_XzParallelContext *ctx,
+  const Untar_XzBlock *block,
+  uint8_t *tail
+)
+{
+  size_t size;
+  size_t index_size;
+
+  tail[0] = 0x00;
+  tail[1] = 0x01;
+  size = 2;
+  size += Untar_Xz_Put_vli(&tail[size], block->unpadded_size);
+  size += Untar_Xz_Put_vli(&tail[size], block->uncompressed_size);
+
+  while ((size & 3) != 0) {
+    tail[size++] = 0x00;
+  }
+
+  Untar_Xz_Put_le32(&tail[size], xz_crc32(tail, size, 0));
+  size += 4;
+  index_size = size;
+
+  Untar_Xz_Put_le32(&tail[size + 4], (uint32_t) (index_size / 4 - 1));
+  memcpy(&tail[size + 8], &ctx->header[6], 2);
+  tail[size + 10] = 'Y';
+  tail[size + 11] = 'Z';
+  Untar_Xz_Put_le32(&tail[size], xz_crc32(&tail[size + 4], 6, 0));
+  return size + UNTAR_XZ_FOOTER_SIZE;
+}
+
+static int Untar_Xz_Decode_block(
+  const Untar_XzParallelContext *ctx,
+  const Untar_XzBlock *block,
+  struct xz_dec *dec
+)
+{
+  uint8_t tail[UNTAR_XZ_TAIL_MAX];
+  const uint8_t *in[3];
+  size_t in_size[3];
+  struct xz_buf buf;
+  enum xz_ret ret;
+  size_t i;
+
+  in[0] = ctx->header;
+  in_size[0] = UNTAR_XZ_HEADER_SIZE;
+  in[1] = block->in;
+  in_size[1] = block->padded_size;
+  in[2] = tail;
+  in_size[2] = Untar_Xz_Make_tail(ctx, block, tail);
+
+  xz_dec_reset(dec);
+  buf.out = ctx->out + block->out_offset;
+  buf.out_pos = 0;
+  buf.out_size = block->uncompressed_size;
+  ret = XZ_OK;
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(in) && ret == XZ_OK; ++i) {
+    buf.in = in[i];
+    buf.in_pos = 0;
+    buf.in_size = in_size[i];
+    ret = xz_dec_run(dec, &buf);
+
+    if (buf.in_pos != buf.in_size) {
+      return UNTAR_FAIL;
+    }
+  }
+
+  if (ret != XZ_STREAM_END || buf.out_pos != block->uncompressed_size) {
+    return UNTAR_FAIL;
+  }
+
+  return UNTAR_SUCCESSFUL;
+}
+
+static void Untar_Xz_Work(Untar_XzParallelContext *ctx)
+{
+  struct xz_dec *dec;
+
+  dec = xz_dec_init(XZ_DYNALLOC, ctx->dict_max);
+
+  rtems_mutex_lock(&ctx->mutex);
+
+  if (dec == NULL) {
+    ctx->status = UNTAR_FAIL;
+  }
+
+  while (ctx->status == UNTAR_SUCCESSFUL && ctx->next < ctx->block_count) {
+    const Untar_XzBlock *block = &ctx->blocks[ctx->next];
+    int status;
+
+    ++ctx->next;
+    rtems_mutex_unlock(&ctx->mutex);
+
+    status = Untar_Xz_Decode_block(ctx, block, dec);
+
+    rtems_mutex_lock(&ctx->mutex);
+
+    if (status != UNTAR_SUCCESSFUL) {
+      ctx->status = status;
+    }
+  }
+
+  rtems_mutex_unlock(&ctx->mutex);
+
+  xz_dec_end(dec);
+
+  rtems_mutex_lock(&ctx->mutex);
+  --ctx->active;
+  rtems_condition_variable_broadcast(&ctx->finished);
+  rtems_mutex_unlock(&ctx->mutex);
+}
+
+static rtems_task Untar_Xz_Worker(rtems_task_argument arg)
+{
+  Untar_Xz_Work((Untar_XzParallelContext *) arg);
+  rtems_task_exit();
+}
+
+static void Untar_Xz_Decode_parallel(
+  Untar_XzParallelContext *ctx,
+  uint32_t worker_count
+)
+{
+  rtems_task_priority priority;
+  rtems_status_code sc;
+  uint32_t i;
+
+  rtems_mutex_init(&ctx->mutex, "Untar XZ");
+  rtems_condition_variable_init(&ctx->finished, "Untar XZ");
+  ctx->status = UNTAR_SUCCESSFUL;
+  ctx->next = 0;
+
+  /* The calling task is one of the workers */
+  ctx->active = 1;
+
+  sc = rtems_task_set_priority(RTEMS_SELF, RTEMS_CURRENT_PRIORITY, &priority);
+  if (sc != RTEMS_SUCCESSFUL) {
+    worker_count = 1;
+  }
+
+  for (i = 1; i < worker_count; ++i) {
+    rtems_id id;
+
+    sc = rtems_task_create(
+      rtems_build_name('U', 'T', 'X', 'Z'),
+      priority,
+      UNTAR_XZ_TASK_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    if (sc != RTEMS_SUCCESSFUL) {
+      /* Continue with the workers we have */
+      break;
+    }
+
+    rtems_mutex_lock(&ctx->mutex);
+    ++ctx->active;
+    rtems_mutex_unlock(&ctx->mutex);
+
+    sc = rtems_task_start(id, Untar_Xz_Worker, (rtems_task_argument) ctx);
+    if (sc != RTEMS_SUCCESSFUL) {
+      rtems_mutex_lock(&ctx->mutex);
+      --ctx->active;
+      rtems_mutex_unlock(&ctx->mutex);
+      rtems_task_delete(id);
+      break;
+    }
+  }
+
+  Untar_Xz_Work(ctx);
+
+  rtems_mutex_lock(&ctx->mutex);
+
+  while (ctx->active > 0) {
+    rtems_condition_variable_wait(&ctx->finished, &ctx->mutex);
+  }
+
+  rtems_mutex_unlock(&ctx->mutex);
+
+  rtems_condition_variable_destroy(&ctx->finished);
+  rtems_mutex_destroy(&ctx->mutex);
+}
+
+static int Untar_FromXzMemory_Chunk(
+  const void *xz,
+  size_t xz_size,
+  uint32_t dict_max,
+  const rtems_printer *printer
+)
+{
+  Untar_XzChunkContext ctx;
+  void *buffer;
+  int status;
+
+  buffer = malloc(UNTAR_XZ_CHUNK_BUFFER_SIZE);
+  if (buffer == NULL) {
+    return UNTAR_FAIL;
+  }
+
+  status = Untar_XzChunkContext_Init(
+    &ctx,
+    XZ_DYNALLOC,
+    dict_max,
+    buffer,
+    UNTAR_XZ_CHUNK_BUFFER_SIZE
+  );
+  if (status == UNTAR_SUCCESSFUL) {
+    status = Untar_FromXzChunk_Print(&ctx, xz, xz_size, printer);
+    xz_dec_end(ctx.strm);
+  }
+
+  free(buffer);
+  return status;
+}
+
+int Untar_FromXzMemory_Print(
+  const void *xz,
+  size_t xz_size,
+  uint32_t dict_max,
+  uint32_t worker_count,
+  const rtems_printer *printer
+)
+{
+  Untar_XzParallelContext ctx;
+  int status;
+
+  xz_crc32_init();
+  xz_crc64_init();
+
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.dict_max = dict_max;
+
+  if (!Untar_Xz_Get_blocks(&ctx, xz, xz_size)) {
+    free(ctx.blocks);
+    return Untar_FromXzMemory_Chunk(xz, xz_size, dict_max, printer);
+  }
+
+  /* Fall back to the chunk extraction if the archive does not fit */
+  ctx.out = malloc(ctx.out_size > 0 ? ctx.out_size : 1);
+  if (ctx.out == NULL) {
+    free(ctx.blocks);
+    return Untar_FromXzMemory_Chunk(xz, xz_size, dict_max, printer);
+  }
+
+  if (worker_count == 0) {
+    worker_count = rtems_scheduler_get_processor_maximum();
+  }
+
+  if (worker_count > ctx.block_count) {
+    worker_count = (uint32_t) ctx.block_count;
+  }
+
+  Untar_Xz_Decode_parallel(&ctx, worker_count);
+  status = ctx.status;
+
+  if (status == UNTAR_SUCCESSFUL) {
+    status = Untar_FromMemory_Print(ctx.out, ctx.out_size, printer);
+  }
+
+  free(ctx.out);
+  free(ctx.blocks);
+  return status;
+}
@@ -16,7 +16,13 @@
 #	define STATIC_RW_DATA static
 #endif
 
-STATIC_RW_DATA uint64_t xz_crc64_table[256];
+#ifdef XZ_CRC_SLICE_BY_1
+#	define XZ_CRC_TABLES 1
+#else
+#	define XZ_CRC_TABLES 8
+#endif
+
+STATIC_RW_DATA uint64_t xz_crc64_table[XZ_CRC_TABLES][256];
 
 XZ_EXTERN void xz_crc64_init(void)
 {
@@ -31,7 +37,15 @@ XZ_EXTERN void xz_crc64_init(void)
 		for (j = 0; j < 8; ++j)
 			r = (r >> 1) ^ (poly & ~((r & 1) - 1));
 
-		xz_crc64_table[i] = r;
+		xz_crc64_table[0][i] = r;
+	}
+
+	for (i = 0; i < 256; ++i) {
+		r = xz_crc64_table[0][i];
+		for (j = 1; j < XZ_CRC_TABLES; ++j) {
+			r = xz_crc64_table[0][r & 0xFF] ^ (r >> 8);
+			xz_crc64_table[j][i] = r;
+		}
 	}
 
 	return;
@@ -41,8 +55,26 @@ XZ_EXTERN uint64_t xz_crc64(const uint8_t *buf, size_t size, uint64_t crc)
 {
 	crc = ~crc;
 
+#ifndef XZ_CRC_SLICE_BY_1
+	while (size >= 8) {
+		uint32_t lo = (uint32_t)crc ^ get_unaligned_le32(buf);
+		uint32_t hi = (uint32_t)(crc >> 32) ^ get_unaligned_le32(buf + 4);
+
+		crc = xz_crc64_table[7][lo & 0xFF]
+				^ xz_crc64_table[6][(lo >> 8) & 0xFF]
+				^ xz_crc64_table[5][(lo >> 16) & 0xFF]
+				^ xz_crc64_table[4][lo >> 24]
+				^ xz_crc64_table[3][hi & 0xFF]
+				^ xz_crc64_table[2][(hi >> 8) & 0xFF]
+				^ xz_crc64_table[1][(hi >> 16) & 0xFF]
+				^ xz_crc64_table[0][hi >> 24];
+		buf += 8;
+		size -= 8;
+	}
+#endif
+
 	while (size != 0) {
-		crc = xz_crc64_table[*buf++ ^ (crc & 0xFF)] ^ (crc >> 8);
+		crc = xz_crc64_table[0][*buf++ ^ (crc & 0xFF)] ^ (crc >> 8);
 		--size;
 	}
 
@@ -314,6 +314,7 @@ static const char * const event_text[] = {
   [ RTEMS_RECORD_THREAD_DELETE ] = "THREAD_DELETE",
   [ RTEMS_RECORD_THREAD_DISPATCH_DISABLE ] = "THREAD_DISPATCH_DISABLE",
   [ RTEMS_RECORD_THREAD_DISPATCH_ENABLE ] = "THREAD_DISPATCH_ENABLE",
+  [ RTEMS_RECORD_THREAD_DISPATCH_LATENCY ] = "THREAD_DISPATCH_LATENCY",
   [ RTEMS_RECORD_THREAD_EXIT ] = "THREAD_EXIT",
   [ RTEMS_RECORD_THREAD_EXITTED ] = "THREAD_EXITTED",
   [ RTEMS_RECORD_THREAD_ID ] = "THREAD_ID",
@@ -335,6 +336,7 @@ static const char * const event_text[] = {
   [ RTEMS_RECORD_THREAD_RESOURCE_OBTAIN ] = "THREAD_RESOURCE_OBTAIN",
   [ RTEMS_RECORD_THREAD_RESOURCE_RELEASE ] = "THREAD_RESOURCE_RELEASE",
   [ RTEMS_RECORD_THREAD_RESTART ] = "THREAD_RESTART",
+  [ RTEMS_RECORD_THREAD_SCHEDULE_LATENCY ] = "THREAD_SCHEDULE_LATENCY",
   [ RTEMS_RECORD_THREAD_STACK_CURRENT ] = "THREAD_STACK_CURRENT",
   [ RTEMS_RECORD_THREAD_STACK_SIZE ] = "THREAD_STACK_SIZE",
   [ RTEMS_RECORD_THREAD_STACK_USAGE ] = "THREAD_STACK_USAGE",
@@ -380,8 +382,6 @@ static const char * const event_text[] = {
   [ RTEMS_RECORD_WRITE_EXIT ] = "WRITE_EXIT",
   [ RTEMS_RECORD_WRITEV_ENTRY ] = "WRITEV_ENTRY",
   [ RTEMS_RECORD_WRITEV_EXIT ] = "WRITEV_EXIT",
-  [ RTEMS_RECORD_SYSTEM_341 ] = "SYSTEM_341",
-  [ RTEMS_RECORD_SYSTEM_342 ] = "SYSTEM_342",
   [ RTEMS_RECORD_SYSTEM_343 ] = "SYSTEM_343",
   [ RTEMS_RECORD_SYSTEM_344 ] = "SYSTEM_344",
   [ RTEMS_RECORD_SYSTEM_345 ] = "SYSTEM_345",
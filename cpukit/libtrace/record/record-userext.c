@@ -112,6 +112,18 @@ void _Record_Thread_switch(
   items[ 2 ].event = RTEMS_RECORD_THREAD_SWITCH_IN;
   items[ 2 ].data = heir->Object.id;
   rtems_record_produce_n( items, RTEMS_ARRAY_SIZE( items ) );
+
+#if defined(RTEMS_PROFILING)
+  if ( heir->Latency.is_new_latency ) {
+    heir->Latency.is_new_latency = false;
+    rtems_record_produce_2(
+      RTEMS_RECORD_THREAD_SCHEDULE_LATENCY,
+      heir->Latency.schedule_latency,
+      RTEMS_RECORD_THREAD_DISPATCH_LATENCY,
+      heir->Latency.dispatch_latency
+    );
+  }
+#endif
 }
 
 void _Record_Thread_begin( struct _Thread_Control *executing )
@@ -40,6 +40,66 @@
 
 #include <rtems/posix/condimpl.h>
 
+/*
+ * Instead of waking up all threads which would immediately block on the
+ * mutex owned by the executing thread, the threads are moved to the thread
+ * queue of the mutex.  The mutex surrender hands over the ownership to the
+ * moved threads one by one.  The thread queue lock order is condition
+ * variable first, then mutex.
+ */
+static bool _POSIX_Condition_variables_Requeue(
+  POSIX_Condition_variables_Control *the_cond,
+  Thread_Control                    *executing,
+  Thread_queue_Context              *queue_context
+)
+{
+  const Thread_queue_Operations *operations;
+  POSIX_Mutex_Control           *the_mutex;
+  Thread_queue_Queue            *mutex_queue;
+  ISR_lock_Context               lock_context;
+  Thread_queue_Heads            *heads;
+
+  the_mutex = _POSIX_Mutex_Get( the_cond->mutex );
+
+  if (
+    the_mutex == NULL
+      || !_POSIX_Condition_variables_Is_requeue_mutex( the_mutex )
+  ) {
+    return false;
+  }
+
+  mutex_queue = &the_mutex->Recursive.Mutex.Queue.Queue;
+  _Thread_queue_Queue_acquire_critical(
+    mutex_queue,
+    &executing->Potpourri_stats,
+    &lock_context
+  );
+
+  if ( !_POSIX_Mutex_Is_owner( the_mutex, executing ) ) {
+    _Thread_queue_Queue_release_critical( mutex_queue, &lock_context );
+    return false;
+  }
+
+  operations = POSIX_CONDITION_VARIABLES_TQ_OPERATIONS;
+  heads = the_cond->Queue.Queue.heads;
+
+  while ( heads != NULL ) {
+    _Thread_queue_Requeue_critical(
+      &the_cond->Queue.Queue,
+      operations,
+      mutex_queue,
+      POSIX_MUTEX_NO_PROTOCOL_TQ_OPERATIONS,
+      ( *operations->first )( heads ),
+      queue_context
+    );
+    heads = the_cond->Queue.Queue.heads;
+  }
+
+  _Thread_queue_Queue_release_critical( mutex_queue, &lock_context );
+  the_cond->mutex = POSIX_CONDITION_VARIABLES_NO_MUTEX;
+  return true;
+}
+
 /*
  *  _POSIX_Condition_variables_Signal_support
  *
@@ -62,8 +122,9 @@ int _POSIX_Condition_variables_Signal_support(
 
   do {
     Thread_queue_Heads *heads;
+    Thread_Control     *executing;
 
-    _POSIX_Condition_variables_Acquire( the_cond, &queue_context );
+    executing = _POSIX_Condition_variables_Acquire( the_cond, &queue_context );
 
     heads = the_cond->Queue.Queue.heads;
 
@@ -74,6 +135,19 @@ int _POSIX_Condition_variables_Signal_support(
       return 0;
     }
 
+    if (
+      is_broadcast
+        && _POSIX_Condition_variables_Requeue(
+          the_cond,
+          executing,
+          &queue_context
+        )
+    ) {
+      _POSIX_Condition_variables_Release( the_cond, &queue_context );
+
+      return 0;
+    }
+
     _Thread_queue_Surrender_no_priority(
       &the_cond->Queue.Queue,
       heads,
@@ -189,9 +189,24 @@ int _POSIX_Condition_variables_Wait_support(
    */
 
   if ( error != EPERM ) {
-    int mutex_error;
+    POSIX_Mutex_Control *the_mutex;
+    int                  mutex_error;
+
+    the_mutex = _POSIX_Mutex_Get( mutex );
+
+    /*
+     *  A broadcast may have moved this thread to the thread queue of the
+     *  mutex.  In this case the mutex surrender made us the owner.
+     */
+    if (
+      _POSIX_Condition_variables_Is_requeue_mutex( the_mutex )
+        && _POSIX_Mutex_Is_owner( the_mutex, executing )
+    ) {
+      mutex_error = 0;
+    } else {
+      mutex_error = pthread_mutex_lock( mutex );
+    }
 
-    mutex_error = pthread_mutex_lock( mutex );
     if ( mutex_error != 0 ) {
       _Assert( mutex_error == EINVAL );
       error = EINVAL;
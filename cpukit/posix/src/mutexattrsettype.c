@@ -43,6 +43,7 @@
 #include <rtems/score/coremuteximpl.h>
 #include <rtems/score/watchdog.h>
 #include <rtems/posix/muteximpl.h>
+#include <rtems/posix/pthread.h>
 #include <rtems/posix/priorityimpl.h>
 
 #if defined(_UNIX98_THREAD_MUTEX_ATTRIBUTES)
@@ -59,6 +60,7 @@ int pthread_mutexattr_settype(
     case PTHREAD_MUTEX_RECURSIVE:
     case PTHREAD_MUTEX_ERRORCHECK:
     case PTHREAD_MUTEX_DEFAULT:
+    case PTHREAD_MUTEX_ADAPTIVE_NP:
       attr->type = type;
       return 0;
 
@@ -41,6 +41,7 @@
 #include <rtems/posix/muteximpl.h>
 #include <rtems/posix/posixapi.h>
 #include <rtems/posix/priorityimpl.h>
+#include <rtems/posix/pthread.h>
 #include <rtems/score/schedulerimpl.h>
 
 #include <limits.h>
@@ -160,6 +161,16 @@ int pthread_mutex_init(
     case PTHREAD_MUTEX_DEFAULT:
       break;
 
+    case PTHREAD_MUTEX_ADAPTIVE_NP:
+      /*
+       *  The spin estimate of adaptive mutexes uses the storage of the
+       *  priority ceiling.
+       */
+      if ( protocol == POSIX_MUTEX_PRIORITY_CEILING ) {
+        return EINVAL;
+      }
+      break;
+
     default:
       return EINVAL;
   }
@@ -175,6 +186,10 @@ int pthread_mutex_init(
     flags |= POSIX_MUTEX_RECURSIVE;
   }
 
+  if ( the_attr->type == PTHREAD_MUTEX_ADAPTIVE_NP ) {
+    flags |= POSIX_MUTEX_ADAPTIVE;
+  }
+
   the_mutex->flags = flags;
 
   if ( protocol == POSIX_MUTEX_PRIORITY_CEILING ) {
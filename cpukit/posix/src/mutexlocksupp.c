@@ -86,6 +86,15 @@ int _POSIX_Mutex_Lock_support(
   the_mutex = _POSIX_Mutex_Get( mutex );
   POSIX_MUTEX_VALIDATE_OBJECT( the_mutex, flags );
 
+#if defined(RTEMS_SMP)
+  if (
+    _POSIX_Mutex_Is_adaptive( flags )
+      && (uintptr_t) abstime != POSIX_MUTEX_ABSTIME_TRY_LOCK
+  ) {
+    _POSIX_Mutex_Spin( the_mutex, _Thread_Get_executing() );
+  }
+#endif
+
   executing = _POSIX_Mutex_Acquire( the_mutex, &queue_context );
   _Thread_queue_Context_set_enqueue_callout( &queue_context, enqueue_callout);
   _Thread_queue_Context_set_timeout_argument( &queue_context, abstime, true );
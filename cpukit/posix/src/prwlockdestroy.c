@@ -48,6 +48,17 @@ int pthread_rwlock_destroy(
   the_rwlock = _POSIX_RWLock_Get( _rwlock );
   POSIX_RWLOCK_VALIDATE_OBJECT( the_rwlock );
 
+  if ( _POSIX_RWLock_Is_scalable( the_rwlock ) ) {
+    if (
+      _CORE_RWLock_Revoke_bias( &the_rwlock->RWLock, false, NULL )
+        != STATUS_SUCCESSFUL
+    ) {
+      return EBUSY;
+    }
+
+    _CORE_RWLock_Restore_bias( &the_rwlock->RWLock );
+  }
+
   _CORE_RWLock_Acquire( &the_rwlock->RWLock, &queue_context );
 
   /*
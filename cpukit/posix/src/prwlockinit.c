@@ -42,6 +42,7 @@
 
 #include <rtems/posix/rwlockimpl.h>
 #include <rtems/posix/posixapi.h>
+#include <rtems/posix/pthread.h>
 
 RTEMS_STATIC_ASSERT(
   offsetof( POSIX_RWLock_Control, flags )
@@ -78,6 +79,7 @@ int pthread_rwlock_init(
 )
 {
   POSIX_RWLock_Control *the_rwlock;
+  unsigned long         flags;
 
   the_rwlock = _POSIX_RWLock_Get( rwlock );
 
@@ -90,12 +92,22 @@ int pthread_rwlock_init(
       return EINVAL;
     }
 
-    if ( !_POSIX_Is_valid_pshared( attr->process_shared ) ) {
+    if ( !_POSIX_Is_valid_pshared( _POSIX_RWLock_Attr_get_pshared( attr ) ) ) {
       return EINVAL;
     }
   }
 
-  the_rwlock->flags = (uintptr_t) the_rwlock ^ POSIX_RWLOCK_MAGIC;
+  flags = (uintptr_t) the_rwlock ^ POSIX_RWLOCK_MAGIC;
+  flags &= ~POSIX_RWLOCK_FLAGS_MASK;
+
+  if (
+    attr != NULL
+      && _POSIX_RWLock_Attr_get_kind( attr ) == PTHREAD_RWLOCK_SCALABLE_NP
+  ) {
+    flags |= POSIX_RWLOCK_SCALABLE;
+  }
+
+  the_rwlock->flags = flags;
   _CORE_RWLock_Initialize( &the_rwlock->RWLock );
   return 0;
 }
@@ -52,6 +52,10 @@ int pthread_rwlock_rdlock(
   the_rwlock = _POSIX_RWLock_Get( rwlock );
   POSIX_RWLOCK_VALIDATE_OBJECT( the_rwlock );
 
+  if ( _POSIX_RWLock_Seize_for_reading_biased( the_rwlock ) ) {
+    return 0;
+  }
+
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
   status = _CORE_RWLock_Seize_for_reading(
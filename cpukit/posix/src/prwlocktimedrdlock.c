@@ -53,6 +53,10 @@ int pthread_rwlock_timedrdlock(
   the_rwlock = _POSIX_RWLock_Get( rwlock );
   POSIX_RWLOCK_VALIDATE_OBJECT( the_rwlock );
 
+  if ( _POSIX_RWLock_Seize_for_reading_biased( the_rwlock ) ) {
+    return 0;
+  }
+
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_set_enqueue_timeout_realtime_timespec(
     &queue_context,
@@ -66,5 +66,19 @@ int pthread_rwlock_timedwrlock(
     true,
     &queue_context
   );
+
+  /* The fast path readers are waited for with the same absolute timeout */
+  _Thread_queue_Context_initialize( &queue_context );
+  _Thread_queue_Context_set_enqueue_timeout_realtime_timespec(
+    &queue_context,
+    abstime,
+    true
+  );
+  status = _POSIX_RWLock_Revoke_bias(
+    the_rwlock,
+    status,
+    true,
+    &queue_context
+  );
   return _POSIX_Get_error( status );
 }
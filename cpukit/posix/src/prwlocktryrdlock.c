@@ -52,6 +52,10 @@ int pthread_rwlock_tryrdlock(
   the_rwlock = _POSIX_RWLock_Get( rwlock );
   POSIX_RWLOCK_VALIDATE_OBJECT( the_rwlock );
 
+  if ( _POSIX_RWLock_Seize_for_reading_biased( the_rwlock ) ) {
+    return 0;
+  }
+
   _Thread_queue_Context_initialize( &queue_context );
   status = _CORE_RWLock_Seize_for_reading(
     &the_rwlock->RWLock,
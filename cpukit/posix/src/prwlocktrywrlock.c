@@ -58,5 +58,11 @@ int pthread_rwlock_trywrlock(
     false,                 /* we are not willing to wait */
     &queue_context
   );
+  status = _POSIX_RWLock_Revoke_bias(
+    the_rwlock,
+    status,
+    false,
+    &queue_context
+  );
   return _POSIX_Get_error( status );
 }
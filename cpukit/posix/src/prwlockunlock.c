@@ -55,20 +55,72 @@ bool _POSIX_RWLock_Auto_initialization( POSIX_RWLock_Control *the_rwlock )
     return false;
   }
 
-  the_rwlock->flags = (uintptr_t) the_rwlock ^ POSIX_RWLOCK_MAGIC;
+  the_rwlock->flags = ( (uintptr_t) the_rwlock ^ POSIX_RWLOCK_MAGIC )
+    & ~POSIX_RWLOCK_FLAGS_MASK;
   return true;
 }
 
+Status_Control _POSIX_RWLock_Revoke_bias(
+  POSIX_RWLock_Control *the_rwlock,
+  Status_Control        status,
+  bool                  wait,
+  Thread_queue_Context *queue_context
+)
+{
+  if (
+    status == STATUS_SUCCESSFUL
+      && _POSIX_RWLock_Is_scalable( the_rwlock )
+  ) {
+    status = _CORE_RWLock_Revoke_bias(
+      &the_rwlock->RWLock,
+      wait,
+      queue_context
+    );
+
+    if ( status != STATUS_SUCCESSFUL ) {
+      (void) _CORE_RWLock_Surrender( &the_rwlock->RWLock );
+    }
+  }
+
+  return status;
+}
+
 int pthread_rwlock_unlock(
   pthread_rwlock_t  *rwlock
 )
 {
   POSIX_RWLock_Control *the_rwlock;
   Status_Control        status;
+  bool                  is_writer;
 
   the_rwlock = _POSIX_RWLock_Get( rwlock );
   POSIX_RWLOCK_VALIDATE_OBJECT( the_rwlock );
 
+  if ( !_POSIX_RWLock_Is_scalable( the_rwlock ) ) {
+    status = _CORE_RWLock_Surrender( &the_rwlock->RWLock );
+    return _POSIX_Get_error( status );
+  }
+
+  if (
+    _CORE_RWLock_Surrender_biased(
+      &the_rwlock->RWLock,
+      _Thread_Get_executing()
+    )
+  ) {
+    return 0;
+  }
+
+  /*
+   * The caller owns the RWLock, so the state cannot change until the RWLock
+   * is surrendered.
+   */
+  is_writer =
+    the_rwlock->RWLock.current_state == CORE_RWLOCK_LOCKED_FOR_WRITING;
   status = _CORE_RWLock_Surrender( &the_rwlock->RWLock );
+
+  if ( is_writer ) {
+    _CORE_RWLock_Restore_bias( &the_rwlock->RWLock );
+  }
+
   return _POSIX_Get_error( status );
 }
@@ -61,5 +61,13 @@ int pthread_rwlock_wrlock(
     true,          /* do not timeout -- wait forever */
     &queue_context
   );
+  _Thread_queue_Context_initialize( &queue_context );
+  _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
+  status = _POSIX_RWLock_Revoke_bias(
+    the_rwlock,
+    status,
+    true,
+    &queue_context
+  );
   return _POSIX_Get_error( status );
 }
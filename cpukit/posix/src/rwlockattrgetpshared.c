@@ -37,8 +37,7 @@
 #include "config.h"
 #endif
 
-#include <pthread.h>
-#include <errno.h>
+#include <rtems/posix/rwlockimpl.h>
 
 int pthread_rwlockattr_getpshared(
   const pthread_rwlockattr_t *attr,
@@ -51,6 +50,6 @@ int pthread_rwlockattr_getpshared(
   if ( !attr->is_initialized )
     return EINVAL;
 
-  *pshared = attr->process_shared;
+  *pshared = _POSIX_RWLock_Attr_get_pshared( attr );
   return 0;
 }
@@ -38,8 +38,7 @@
 #include "config.h"
 #endif
 
-#include <pthread.h>
-#include <errno.h>
+#include <rtems/posix/rwlockimpl.h>
 
 /*
  *  RWLock Attributes Set Process Shared
@@ -59,7 +58,8 @@ int pthread_rwlockattr_setpshared(
   switch ( pshared ) {
     case PTHREAD_PROCESS_SHARED:
     case PTHREAD_PROCESS_PRIVATE:
-      attr->process_shared = pshared;
+      attr->process_shared = ( attr->process_shared
+        & ~POSIX_RWLOCK_ATTR_PSHARED_MASK ) | pshared;
       return 0;
 
     default:
@@ -126,6 +126,17 @@ rtems_status_code rtems_semaphore_create(
     return RTEMS_INVALID_NUMBER;
   }
 
+#if defined(RTEMS_SMP)
+  if (
+    _Attributes_Is_adaptive_spinning( attribute_set )
+      && variant != SEMAPHORE_VARIANT_MUTEX_INHERIT_PRIORITY
+      && variant != SEMAPHORE_VARIANT_MUTEX_PRIORITY_CEILING
+      && variant != SEMAPHORE_VARIANT_MUTEX_NO_PROTOCOL
+  ) {
+    return RTEMS_NOT_DEFINED;
+  }
+#endif
+
   the_semaphore = _Semaphore_Allocate();
 
   if ( !the_semaphore ) {
@@ -162,6 +173,12 @@ rtems_status_code rtems_semaphore_create(
     flags = _Semaphore_Set_discipline( flags, SEMAPHORE_DISCIPLINE_FIFO );
   }
 
+#if defined(RTEMS_SMP)
+  if ( _Attributes_Is_adaptive_spinning( attribute_set ) ) {
+    flags = _Semaphore_Make_adaptive( flags );
+  }
+#endif
+
   _Semaphore_Set_flags( the_semaphore, flags );
   executing = _Thread_Get_executing();
 
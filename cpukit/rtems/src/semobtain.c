@@ -105,6 +105,16 @@ rtems_status_code rtems_semaphore_obtain(
   flags = _Semaphore_Get_flags( the_semaphore );
   variant = _Semaphore_Get_variant( flags );
 
+#if defined(RTEMS_SMP)
+  if ( wait && _Semaphore_Is_adaptive( flags ) ) {
+    _CORE_recursive_mutex_Spin(
+      &the_semaphore->Core_control.Mutex.Recursive,
+      executing,
+      &queue_context
+    );
+  }
+#endif
+
   switch ( variant ) {
     case SEMAPHORE_VARIANT_MUTEX_INHERIT_PRIORITY:
       status = _CORE_recursive_mutex_Seize(
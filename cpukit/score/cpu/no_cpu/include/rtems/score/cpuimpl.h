@@ -166,6 +166,18 @@ RTEMS_INLINE_ROUTINE void _CPU_Instruction_no_operation( void )
   __asm__ volatile ( "nop" );
 }
 
+#if defined(RTEMS_SMP)
+/**
+ * @brief Relaxes the processor in a busy wait loop.
+ *
+ * This function is used by _Thread_queue_Spin_while_owner_executes().
+ */
+RTEMS_INLINE_ROUTINE void _CPU_SMP_Processor_relax( void )
+{
+  __asm__ volatile ( "nop" );
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
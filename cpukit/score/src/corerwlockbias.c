@@ -0,0 +1,350 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreRWLock
+ *
+ * @brief This source file contains the implementation of
+ *   _CORE_RWLock_Seize_for_reading_biased(),
+ *   _CORE_RWLock_Surrender_biased(), _CORE_RWLock_Revoke_bias(), and
+ *   _CORE_RWLock_Restore_bias().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+
+#include <rtems/score/corerwlockimpl.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/statesimpl.h>
+#include <rtems/score/threadimpl.h>
+
+/*
+ * The reader fast path follows the visible readers approach of BRAVO (Biased
+ * Locking for Reader-Writer Locks, Dice and Kogan, 2019).  Readers publish
+ * the RWLock in a slot of a global table instead of writing to the RWLock
+ * control.  A writer revokes the fast path of all RWLocks which map to the
+ * same revocation group and waits until the slots of its RWLock are empty.
+ */
+
+#define CORE_RWLOCK_READER_SLOTS 64
+
+#define CORE_RWLOCK_BIAS_GROUPS 16
+
+#define CORE_RWLOCK_BIAS_TQ_OPERATIONS &_Thread_queue_Operations_FIFO
+
+typedef struct {
+  Atomic_Uintptr rwlock;
+  Thread_Control *owner;
+} RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) CORE_RWLock_Reader_slot;
+
+typedef struct {
+  /*
+   * The count of writers which revoked the reader fast path.  It is a count
+   * and not a flag, since the next writer may revoke the fast path before the
+   * previous writer restored it.
+   */
+  Atomic_Uint revocations;
+
+  /*
+   * Fast path readers which release a slot while the fast path is revoked
+   * change the generation and wake up the waiting writers.  Concurrent
+   * increments may get lost, however, every increment changes the value
+   * observed by the writers.
+   */
+  volatile int generation;
+
+  /*
+   * The writers waiting for the fast path readers of the revocation group.
+   */
+  Thread_queue_Syslock_queue Queue;
+} RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) CORE_RWLock_Bias_group;
+
+static CORE_RWLock_Reader_slot
+_CORE_RWLock_Reader_slots[ CORE_RWLOCK_READER_SLOTS ];
+
+static CORE_RWLock_Bias_group _CORE_RWLock_Bias_groups[ CORE_RWLOCK_BIAS_GROUPS ];
+
+static uint32_t _CORE_RWLock_Hash( uintptr_t value )
+{
+  /* Fibonacci hashing */
+  return (uint32_t) ( value >> 3 ) * 2654435761U;
+}
+
+static CORE_RWLock_Bias_group *_CORE_RWLock_Get_bias_group(
+  const CORE_RWLock_Control *the_rwlock
+)
+{
+  uint32_t hash;
+
+  hash = _CORE_RWLock_Hash( (uintptr_t) the_rwlock );
+  return &_CORE_RWLock_Bias_groups[ ( hash >> 24 ) % CORE_RWLOCK_BIAS_GROUPS ];
+}
+
+static CORE_RWLock_Reader_slot *_CORE_RWLock_Get_reader_slot(
+  const CORE_RWLock_Control *the_rwlock,
+  const Thread_Control      *executing
+)
+{
+  uint32_t hash;
+
+  hash = _CORE_RWLock_Hash(
+    (uintptr_t) the_rwlock ^ ( (uintptr_t) executing << 5 )
+  );
+  return &_CORE_RWLock_Reader_slots[
+    ( hash >> 24 ) % CORE_RWLOCK_READER_SLOTS
+  ];
+}
+
+static bool _CORE_RWLock_Is_revoked( CORE_RWLock_Bias_group *group )
+{
+  return _Atomic_Load_uint( &group->revocations, ATOMIC_ORDER_RELAXED ) != 0;
+}
+
+static void _CORE_RWLock_Wake_writers( CORE_RWLock_Bias_group *group )
+{
+  Thread_queue_Context queue_context;
+  ISR_Level            level;
+
+  _Thread_queue_Context_initialize( &queue_context );
+  _Thread_queue_Context_ISR_disable( &queue_context, level );
+  _Thread_queue_Queue_acquire_critical(
+    &group->Queue.Queue,
+    &_Thread_Executing->Potpourri_stats,
+    &queue_context.Lock_context.Lock_context
+  );
+  _Thread_queue_Context_set_ISR_level( &queue_context, level );
+  (void) _Thread_queue_Flush_critical(
+    &group->Queue.Queue,
+    CORE_RWLOCK_BIAS_TQ_OPERATIONS,
+    _Thread_queue_Flush_default_filter,
+    &queue_context
+  );
+}
+
+static Status_Control _CORE_RWLock_Wait_for_readers(
+  CORE_RWLock_Bias_group *group,
+  int                     generation,
+  Thread_queue_Context   *queue_context
+)
+{
+  Thread_Control *executing;
+  ISR_Level       level;
+
+  _Thread_queue_Context_ISR_disable( queue_context, level );
+  executing = _Thread_Executing;
+  _Thread_queue_Queue_acquire_critical(
+    &group->Queue.Queue,
+    &executing->Potpourri_stats,
+    &queue_context->Lock_context.Lock_context
+  );
+
+  if ( group->generation != generation ) {
+    _Thread_queue_Queue_release_critical(
+      &group->Queue.Queue,
+      &queue_context->Lock_context.Lock_context
+    );
+    _ISR_Local_enable( level );
+    return STATUS_SUCCESSFUL;
+  }
+
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_RWLOCK
+  );
+  _Thread_queue_Context_set_ISR_level( queue_context, level );
+  _Thread_queue_Enqueue(
+    &group->Queue.Queue,
+    CORE_RWLOCK_BIAS_TQ_OPERATIONS,
+    executing,
+    queue_context
+  );
+  return _Thread_Wait_get_status( executing );
+}
+
+static void _CORE_RWLock_Release_slot(
+  CORE_RWLock_Reader_slot *slot,
+  CORE_RWLock_Bias_group  *group
+)
+{
+  slot->owner = NULL;
+  _Atomic_Store_uintptr( &slot->rwlock, 0, ATOMIC_ORDER_RELEASE );
+
+  /*
+   * This fence pairs with the fence in _CORE_RWLock_Revoke_bias().  Either
+   * the writer observes the empty slot or we observe the revocation.
+   */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  if ( RTEMS_PREDICT_FALSE( _CORE_RWLock_Is_revoked( group ) ) ) {
+    ++group->generation;
+    _CORE_RWLock_Wake_writers( group );
+  }
+}
+
+bool _CORE_RWLock_Seize_for_reading_biased(
+  CORE_RWLock_Control *the_rwlock,
+  Thread_Control      *executing
+)
+{
+  CORE_RWLock_Bias_group  *group;
+  CORE_RWLock_Reader_slot *slot;
+  uintptr_t                expected;
+
+  group = _CORE_RWLock_Get_bias_group( the_rwlock );
+
+  if ( _CORE_RWLock_Is_revoked( group ) ) {
+    return false;
+  }
+
+  slot = _CORE_RWLock_Get_reader_slot( the_rwlock, executing );
+  expected = 0;
+
+  if (
+    !_Atomic_Compare_exchange_uintptr(
+      &slot->rwlock,
+      &expected,
+      (uintptr_t) the_rwlock,
+      ATOMIC_ORDER_ACQ_REL,
+      ATOMIC_ORDER_RELAXED
+    )
+  ) {
+    return false;
+  }
+
+  /*
+   * The owner is only set after the slot was obtained and cleared before the
+   * slot is released.  So, the owner can only be equal to the executing
+   * thread if the executing thread obtained the slot.
+   */
+  slot->owner = executing;
+
+  /* This fence pairs with the fence in _CORE_RWLock_Revoke_bias() */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  if ( RTEMS_PREDICT_FALSE( _CORE_RWLock_Is_revoked( group ) ) ) {
+    _CORE_RWLock_Release_slot( slot, group );
+    return false;
+  }
+
+  return true;
+}
+
+bool _CORE_RWLock_Surrender_biased(
+  CORE_RWLock_Control *the_rwlock,
+  Thread_Control      *executing
+)
+{
+  CORE_RWLock_Reader_slot *slot;
+
+  slot = _CORE_RWLock_Get_reader_slot( the_rwlock, executing );
+
+  if (
+    _Atomic_Load_uintptr( &slot->rwlock, ATOMIC_ORDER_RELAXED )
+      != (uintptr_t) the_rwlock
+      || slot->owner != executing
+  ) {
+    return false;
+  }
+
+  _CORE_RWLock_Release_slot( slot, _CORE_RWLock_Get_bias_group( the_rwlock ) );
+  return true;
+}
+
+static bool _CORE_RWLock_Has_biased_readers(
+  const CORE_RWLock_Control *the_rwlock
+)
+{
+  size_t i;
+
+  for ( i = 0; i < CORE_RWLOCK_READER_SLOTS; ++i ) {
+    uintptr_t rwlock;
+
+    rwlock = _Atomic_Load_uintptr(
+      &_CORE_RWLock_Reader_slots[ i ].rwlock,
+      ATOMIC_ORDER_ACQUIRE
+    );
+
+    if ( rwlock == (uintptr_t) the_rwlock ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+Status_Control _CORE_RWLock_Revoke_bias(
+  CORE_RWLock_Control  *the_rwlock,
+  bool                  wait,
+  Thread_queue_Context *queue_context
+)
+{
+  CORE_RWLock_Bias_group *group;
+
+  group = _CORE_RWLock_Get_bias_group( the_rwlock );
+  _Atomic_Fetch_add_uint( &group->revocations, 1, ATOMIC_ORDER_RELAXED );
+
+  while ( true ) {
+    int            generation;
+    Status_Control status;
+
+    generation = group->generation;
+
+    /*
+     * This fence pairs with the fences in _CORE_RWLock_Release_slot() and
+     * _CORE_RWLock_Seize_for_reading_biased().
+     */
+    _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+    if ( !_CORE_RWLock_Has_biased_readers( the_rwlock ) ) {
+      return STATUS_SUCCESSFUL;
+    }
+
+    if ( !wait ) {
+      _CORE_RWLock_Restore_bias( the_rwlock );
+      return STATUS_UNAVAILABLE;
+    }
+
+    status = _CORE_RWLock_Wait_for_readers( group, generation, queue_context );
+
+    if ( status != STATUS_SUCCESSFUL ) {
+      _CORE_RWLock_Restore_bias( the_rwlock );
+      return status;
+    }
+  }
+}
+
+void _CORE_RWLock_Restore_bias( CORE_RWLock_Control *the_rwlock )
+{
+  CORE_RWLock_Bias_group *group;
+
+  group = _CORE_RWLock_Get_bias_group( the_rwlock );
+  _Atomic_Fetch_sub_uint( &group->revocations, 1, ATOMIC_ORDER_RELEASE );
+}
@@ -59,13 +59,17 @@
 #include <sys/lock.h>
 #include <errno.h>
 
+#include <rtems/thread.h>
 #include <rtems/score/atomic.h>
 #include <rtems/score/chainimpl.h>
+#include <rtems/score/schedulerimpl.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/threadqimpl.h>
 
 #define FUTEX_TQ_OPERATIONS &_Thread_queue_Operations_FIFO
 
+#define FUTEX_BITSET_MATCH_ANY 0xffffffffU
+
 typedef struct {
   Thread_queue_Syslock_queue Queue;
 } Futex_Control;
@@ -117,7 +121,7 @@ static void _Futex_Queue_release(
 }
 
 /**
- * @brief Performs the ``FUTEX_WAIT`` operation.
+ * @brief Performs the ``FUTEX_WAIT_BITSET`` operation.
  *
  * @param[in, out] _futex is the futex object.
  *
@@ -125,14 +129,25 @@ static void _Futex_Queue_release(
  *
  * @param val is the expected futex state value.
  *
+ * @param bitset is the bit set of the waiting thread.  Only wake up operations
+ *   with a bit set which has at least one bit in common with this bit set
+ *   wake up the thread.
+ *
  * @retval 0 Returns zero if the futex state is equal to the expected value.
  *   In this case the calling thread is enqueued on the thread queue of the
  *   futex object.
  *
  * @retval EAGAIN Returns EAGAIN if the futex state is not equal to the
  *   expected value.
+ *
+ * @retval EINVAL Returns EINVAL if the bit set is zero.
  */
-int _Futex_Wait( struct _Futex_Control *_futex, int *uaddr, int val )
+int _Futex_Wait_bitset(
+  struct _Futex_Control *_futex,
+  int                   *uaddr,
+  int                    val,
+  uint32_t               bitset
+)
 {
   Futex_Control        *futex;
   ISR_Level             level;
@@ -140,12 +155,17 @@ int _Futex_Wait( struct _Futex_Control *_futex, int *uaddr, int val )
   Thread_Control       *executing;
   int                   eno;
 
+  if ( bitset == 0 ) {
+    return EINVAL;
+  }
+
   futex = _Futex_Get( _futex );
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_ISR_disable( &queue_context, level );
   executing = _Futex_Queue_acquire_critical( futex, &queue_context );
 
   if ( *uaddr == val ) {
+    executing->Wait.option = bitset;
     _Thread_queue_Context_set_thread_state(
       &queue_context,
       STATES_WAITING_FOR_FUTEX
@@ -167,6 +187,27 @@ int _Futex_Wait( struct _Futex_Control *_futex, int *uaddr, int val )
   return eno;
 }
 
+/**
+ * @brief Performs the ``FUTEX_WAIT`` operation.
+ *
+ * @param[in, out] _futex is the futex object.
+ *
+ * @param[in] uaddr is the address to the futex state.
+ *
+ * @param val is the expected futex state value.
+ *
+ * @retval 0 Returns zero if the futex state is equal to the expected value.
+ *   In this case the calling thread is enqueued on the thread queue of the
+ *   futex object.
+ *
+ * @retval EAGAIN Returns EAGAIN if the futex state is not equal to the
+ *   expected value.
+ */
+int _Futex_Wait( struct _Futex_Control *_futex, int *uaddr, int val )
+{
+  return _Futex_Wait_bitset( _futex, uaddr, val, FUTEX_BITSET_MATCH_ANY );
+}
+
 typedef struct {
   Thread_queue_Context Base;
   int                  count;
@@ -191,16 +232,120 @@ static Thread_Control *_Futex_Flush_filter(
   return the_thread;
 }
 
+static Thread_Control *_Futex_Waiter( Chain_Node *node )
+{
+  return _Scheduler_Node_get_owner(
+    SCHEDULER_NODE_OF_WAIT_PRIORITY_NODE( node )
+  );
+}
+
+/*
+ * In contrast to _Thread_queue_Flush_critical(), this function skips the
+ * waiting threads which do not match the bit set instead of stopping at them.
+ * The waiting threads are in FIFO order, see FUTEX_TQ_OPERATIONS.
+ */
+static int _Futex_Wake_matching(
+  Futex_Control *futex,
+  Futex_Context *context,
+  uint32_t       bitset
+)
+{
+  Thread_queue_Queue *queue;
+  Thread_queue_Heads *heads;
+  Chain_Control       unblock;
+  Chain_Node         *node;
+  const Chain_Node   *tail;
+  int                 woken;
+
+  queue = &futex->Queue.Queue;
+  heads = queue->heads;
+  _Assert( heads != NULL );
+  _Chain_Initialize_empty( &unblock );
+  woken = 0;
+
+  /*
+   * The tail is only used for comparison.  The thread queue heads may be
+   * handed over to the last extracted thread.
+   */
+  node = _Chain_First( &heads->Heads.Fifo );
+  tail = _Chain_Immutable_tail( &heads->Heads.Fifo );
+
+  while ( woken < context->count && node != tail ) {
+    Thread_Control *the_thread;
+    Chain_Node     *next;
+
+    next = _Chain_Next( node );
+    the_thread = _Futex_Waiter( node );
+
+    if ( ( the_thread->Wait.option & bitset ) != 0 ) {
+      bool do_unblock;
+
+      do_unblock = _Thread_queue_Extract_locked(
+        queue,
+        FUTEX_TQ_OPERATIONS,
+        the_thread,
+        &context->Base
+      );
+
+      if ( do_unblock ) {
+        _Chain_Append_unprotected( &unblock, node );
+      }
+
+      ++woken;
+    }
+
+    node = next;
+  }
+
+  node = _Chain_First( &unblock );
+  tail = _Chain_Immutable_tail( &unblock );
+
+  if ( node != tail ) {
+    Per_CPU_Control *cpu_self;
+
+    cpu_self = _Thread_queue_Dispatch_disable( &context->Base );
+    _Thread_queue_Queue_release(
+      queue,
+      &context->Base.Lock_context.Lock_context
+    );
+
+    do {
+      Chain_Node *next;
+
+      next = _Chain_Next( node );
+      _Thread_Remove_timer_and_unblock( _Futex_Waiter( node ), queue );
+      node = next;
+    } while ( node != tail );
+
+    _Thread_Dispatch_enable( cpu_self );
+  } else {
+    _Thread_queue_Queue_release(
+      queue,
+      &context->Base.Lock_context.Lock_context
+    );
+  }
+
+  return woken;
+}
+
 /**
- * @brief Performs the ``FUTEX_WAKE`` operation.
+ * @brief Performs the ``FUTEX_WAKE_BITSET`` operation.
  *
  * @param[in, out] _futex is the futex object.
  *
  * @param count is the maximum count of threads to wake up.
  *
+ * @param bitset is the bit set to select the threads to wake up.  Only threads
+ *   which wait with a bit set which has at least one bit in common with this
+ *   bit set are woken up.
+ *
  * @return Returns the count of woken up threads.
  */
-int _Futex_Wake( struct _Futex_Control *_futex, int count )
+int _Futex_Wake_bitset(
+  struct _Futex_Control *_futex,
+  int                    count,
+  uint32_t               bitset
+)
 {
   Futex_Control *futex;
   ISR_Level      level;
@@ -223,10 +368,172 @@ int _Futex_Wake( struct _Futex_Control *_futex, int count )
 
   context.count = count;
   _Thread_queue_Context_set_ISR_level( &context.Base, level );
-  return (int) _Thread_queue_Flush_critical(
+
+  if ( bitset == FUTEX_BITSET_MATCH_ANY ) {
+    return (int) _Thread_queue_Flush_critical(
+      &futex->Queue.Queue,
+      FUTEX_TQ_OPERATIONS,
+      _Futex_Flush_filter,
+      &context.Base
+    );
+  }
+
+  return _Futex_Wake_matching( futex, &context, bitset );
+}
+
+/**
+ * @brief Performs the ``FUTEX_WAKE`` operation.
+ *
+ * @param[in, out] _futex is the futex object.
+ *
+ * @param count is the maximum count of threads to wake up.
+ *
+ * @return Returns the count of woken up threads.
+ */
+int _Futex_Wake( struct _Futex_Control *_futex, int count )
+{
+  return _Futex_Wake_bitset( _futex, count, FUTEX_BITSET_MATCH_ANY );
+}
+
+/**
+ * @brief Performs the ``FUTEX_CMP_REQUEUE`` operation.
+ *
+ * The threads waiting on the futex object are woken up or moved to the
+ * target futex object without waking them up.  This avoids the thundering
+ * herd problem of a wake up of all threads which immediately block again on
+ * the target futex object, for example in a condition variable broadcast.
+ *
+ * @param[in, out] _futex is the futex object.
+ *
+ * @param[in] uaddr is the address to the futex state.
+ *
+ * @param val is the expected futex state value.
+ *
+ * @param wake_count is the maximum count of threads to wake up.
+ *
+ * @param[in, out] _target is the target futex object.
+ *
+ * @param requeue_count is the maximum count of threads to move to the target
+ *   futex object.  The first @a wake_count threads are woken up and the next
+ *   @a requeue_count threads are moved.
+ *
+ * @param[out] count is the count of woken up and moved threads.  It is set
+ *   to zero, if the futex state is not equal to the expected value.
+ *
+ * @retval 0 The threads were woken up or moved.
+ *
+ * @retval EAGAIN The futex state was not equal to the expected value.
+ */
+int _Futex_Requeue(
+  struct _Futex_Control *_futex,
+  int                   *uaddr,
+  int                    val,
+  int                    wake_count,
+  struct _Futex_Control *_target,
+  int                    requeue_count,
+  int                   *count
+)
+{
+  Futex_Control    *futex;
+  Futex_Control    *target;
+  ISR_Level         level;
+  Futex_Context     context;
+  ISR_lock_Context  target_lock_context;
+  int               requeued;
+
+  futex = _Futex_Get( _futex );
+  target = _Futex_Get( _target );
+
+  if ( futex == target ) {
+    requeue_count = 0;
+  }
+
+  _Thread_queue_Context_initialize( &context.Base );
+  _Thread_queue_Context_ISR_disable( &context.Base, level );
+
+  /* Acquire the thread queue locks in address order to avoid deadlocks */
+  if ( requeue_count > 0 && target < futex ) {
+    _Thread_queue_Queue_acquire_critical(
+      &target->Queue.Queue,
+      &_Thread_Executing->Potpourri_stats,
+      &target_lock_context
+    );
+  }
+
+  _Futex_Queue_acquire_critical( futex, &context.Base );
+
+  if ( requeue_count > 0 && target > futex ) {
+    _Thread_queue_Queue_acquire_critical(
+      &target->Queue.Queue,
+      &_Thread_Executing->Potpourri_stats,
+      &target_lock_context
+    );
+  }
+
+  if ( *uaddr != val ) {
+    if ( requeue_count > 0 ) {
+      _Thread_queue_Queue_release_critical(
+        &target->Queue.Queue,
+        &target_lock_context
+      );
+    }
+
+    _Futex_Queue_release( futex, level, &context.Base );
+    *count = 0;
+    return EAGAIN;
+  }
+
+  requeued = 0;
+
+  if ( requeue_count > 0 ) {
+    Thread_queue_Heads *heads;
+
+    heads = futex->Queue.Queue.heads;
+
+    if ( heads != NULL ) {
+      Chain_Node       *node;
+      const Chain_Node *tail;
+      int               skip;
+
+      node = _Chain_First( &heads->Heads.Fifo );
+      tail = _Chain_Immutable_tail( &heads->Heads.Fifo );
+      skip = wake_count;
+
+      while ( skip > 0 && node != tail ) {
+        node = _Chain_Next( node );
+        --skip;
+      }
+
+      while ( requeued < requeue_count && node != tail ) {
+        Chain_Node *next;
+
+        next = _Chain_Next( node );
+        _Thread_queue_Requeue_critical(
+          &futex->Queue.Queue,
+          FUTEX_TQ_OPERATIONS,
+          &target->Queue.Queue,
+          FUTEX_TQ_OPERATIONS,
+          _Futex_Waiter( node ),
+          &context.Base
+        );
+        ++requeued;
+        node = next;
+      }
+    }
+
+    _Thread_queue_Queue_release_critical(
+      &target->Queue.Queue,
+      &target_lock_context
+    );
+  }
+
+  context.count = wake_count;
+  _Thread_queue_Context_set_ISR_level( &context.Base, level );
+  *count = requeued + (int) _Thread_queue_Flush_critical(
     &futex->Queue.Queue,
     FUTEX_TQ_OPERATIONS,
     _Futex_Flush_filter,
     &context.Base
   );
+  return 0;
 }
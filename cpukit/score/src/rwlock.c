@@ -0,0 +1,174 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScore
+ *
+ * @brief This source file contains the implementation of the self-contained
+ *   reader-writer lock API.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/thread.h>
+#include <rtems/score/corerwlockimpl.h>
+#include <rtems/score/threadimpl.h>
+
+#include <errno.h>
+
+RTEMS_STATIC_ASSERT(
+  offsetof( CORE_RWLock_Control, Queue )
+    == offsetof( rtems_rwlock, _Queue ),
+  RWLOCK_CONTROL_QUEUE
+);
+
+RTEMS_STATIC_ASSERT(
+  offsetof( CORE_RWLock_Control, current_state )
+    == offsetof( rtems_rwlock, _current_state ),
+  RWLOCK_CONTROL_CURRENT_STATE
+);
+
+RTEMS_STATIC_ASSERT(
+  offsetof( CORE_RWLock_Control, number_of_readers )
+    == offsetof( rtems_rwlock, _number_of_readers ),
+  RWLOCK_CONTROL_NUMBER_OF_READERS
+);
+
+RTEMS_STATIC_ASSERT(
+  sizeof( CORE_RWLock_Control ) == sizeof( rtems_rwlock ),
+  RWLOCK_CONTROL_SIZE
+);
+
+static CORE_RWLock_Control *_RWLock_Get( rtems_rwlock *rwlock )
+{
+  return (CORE_RWLock_Control *) rwlock;
+}
+
+static Status_Control _RWLock_Seize_for_reading(
+  rtems_rwlock *rwlock,
+  bool          wait
+)
+{
+  CORE_RWLock_Control  *the_rwlock;
+  Thread_queue_Context  queue_context;
+
+  the_rwlock = _RWLock_Get( rwlock );
+
+  if (
+    _CORE_RWLock_Seize_for_reading_biased(
+      the_rwlock,
+      _Thread_Get_executing()
+    )
+  ) {
+    return STATUS_SUCCESSFUL;
+  }
+
+  _Thread_queue_Context_initialize( &queue_context );
+  _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
+  return _CORE_RWLock_Seize_for_reading( the_rwlock, wait, &queue_context );
+}
+
+static Status_Control _RWLock_Seize_for_writing(
+  rtems_rwlock *rwlock,
+  bool          wait
+)
+{
+  CORE_RWLock_Control  *the_rwlock;
+  Thread_queue_Context  queue_context;
+  Status_Control        status;
+
+  the_rwlock = _RWLock_Get( rwlock );
+  _Thread_queue_Context_initialize( &queue_context );
+  _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
+  status = _CORE_RWLock_Seize_for_writing( the_rwlock, wait, &queue_context );
+
+  if ( status == STATUS_SUCCESSFUL ) {
+    _Thread_queue_Context_initialize( &queue_context );
+    _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
+    status = _CORE_RWLock_Revoke_bias( the_rwlock, wait, &queue_context );
+
+    if ( status != STATUS_SUCCESSFUL ) {
+      (void) _CORE_RWLock_Surrender( the_rwlock );
+    }
+  }
+
+  return status;
+}
+
+void rtems_rwlock_read_lock( rtems_rwlock *rwlock )
+{
+  (void) _RWLock_Seize_for_reading( rwlock, true );
+}
+
+int rtems_rwlock_try_read_lock( rtems_rwlock *rwlock )
+{
+  if ( _RWLock_Seize_for_reading( rwlock, false ) != STATUS_SUCCESSFUL ) {
+    return EBUSY;
+  }
+
+  return 0;
+}
+
+void rtems_rwlock_read_unlock( rtems_rwlock *rwlock )
+{
+  CORE_RWLock_Control *the_rwlock;
+
+  the_rwlock = _RWLock_Get( rwlock );
+
+  if (
+    !_CORE_RWLock_Surrender_biased( the_rwlock, _Thread_Get_executing() )
+  ) {
+    (void) _CORE_RWLock_Surrender( the_rwlock );
+  }
+}
+
+void rtems_rwlock_write_lock( rtems_rwlock *rwlock )
+{
+  (void) _RWLock_Seize_for_writing( rwlock, true );
+}
+
+int rtems_rwlock_try_write_lock( rtems_rwlock *rwlock )
+{
+  if ( _RWLock_Seize_for_writing( rwlock, false ) != STATUS_SUCCESSFUL ) {
+    return EBUSY;
+  }
+
+  return 0;
+}
+
+void rtems_rwlock_write_unlock( rtems_rwlock *rwlock )
+{
+  CORE_RWLock_Control *the_rwlock;
+
+  the_rwlock = _RWLock_Get( rwlock );
+  (void) _CORE_RWLock_Surrender( the_rwlock );
+  _CORE_RWLock_Restore_bias( the_rwlock );
+}
@@ -0,0 +1,172 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerLatency
+ *
+ * @brief This source file contains the implementation of
+ *   _Scheduler_Latency_do_context_switch(), _Scheduler_Latency_reset(), and
+ *   the definition of ::_Scheduler_Latency_priorities.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/schedulerlatencyimpl.h>
+#include <rtems/score/schedulerimpl.h>
+#include <rtems/counter.h>
+
+#include <string.h>
+
+#if defined(RTEMS_PROFILING)
+Scheduler_Latency_histogram
+  _Scheduler_Latency_priorities[ SCHEDULER_LATENCY_PRIORITIES ];
+
+ISR_LOCK_DEFINE( static, _Scheduler_Latency_lock, "Scheduler Latency" )
+
+static uint32_t _Scheduler_Latency_to_nanoseconds( CPU_Counter_ticks ticks )
+{
+  uint64_t ns;
+
+  ns = rtems_counter_ticks_to_nanoseconds( ticks );
+
+  if ( ns > UINT32_MAX ) {
+    return UINT32_MAX;
+  }
+
+  return (uint32_t) ns;
+}
+
+static void _Scheduler_Latency_add(
+  Scheduler_Latency_histogram *histogram,
+  uint32_t                     latency
+)
+{
+  uint32_t     value;
+  unsigned int bucket;
+
+  value = latency >> 10;
+  bucket = 0;
+
+  while ( value != 0 && bucket < SCHEDULER_LATENCY_BUCKETS - 1 ) {
+    value >>= 1;
+    ++bucket;
+  }
+
+  ++histogram->buckets[ bucket ];
+
+  if ( latency > histogram->max ) {
+    histogram->max = latency;
+  }
+}
+
+void _Scheduler_Latency_do_context_switch( Thread_Control *the_thread )
+{
+  Scheduler_Latency_thread *latency;
+  CPU_Counter_ticks         now;
+  uint32_t                  total;
+  Priority_Control          priority;
+  ISR_lock_Context          lock_context;
+
+  now = _CPU_Counter_read();
+  latency = &the_thread->Latency;
+  latency->is_pending = false;
+  latency->schedule_latency = _Scheduler_Latency_to_nanoseconds(
+    _CPU_Counter_difference( latency->heir_instant, latency->unblock_instant )
+  );
+  latency->dispatch_latency = _Scheduler_Latency_to_nanoseconds(
+    _CPU_Counter_difference( now, latency->heir_instant )
+  );
+
+  latency->is_new_latency = true;
+
+  total = latency->schedule_latency + latency->dispatch_latency;
+
+  if ( total < latency->schedule_latency ) {
+    total = UINT32_MAX;
+  }
+
+  _Scheduler_Latency_add( &latency->Histogram, total );
+
+  /*
+   * The priority may change concurrently on another processor, however, this
+   * is irrelevant for the statistics.
+   */
+  priority = _Scheduler_Unmap_priority(
+    _Thread_Scheduler_get_home( the_thread ),
+    _Thread_Get_priority( the_thread )
+  );
+
+  if ( priority >= SCHEDULER_LATENCY_PRIORITIES ) {
+    priority = SCHEDULER_LATENCY_PRIORITIES - 1;
+  }
+
+  _ISR_lock_Acquire( &_Scheduler_Latency_lock, &lock_context );
+  _Scheduler_Latency_add( &_Scheduler_Latency_priorities[ priority ], total );
+  _ISR_lock_Release( &_Scheduler_Latency_lock, &lock_context );
+}
+
+static bool _Scheduler_Latency_reset_thread(
+  Thread_Control *the_thread,
+  void           *arg
+)
+{
+  ISR_Level level;
+
+  (void) arg;
+
+  _ISR_Local_disable( level );
+  memset(
+    &the_thread->Latency.Histogram,
+    0,
+    sizeof( the_thread->Latency.Histogram )
+  );
+  _ISR_Local_enable( level );
+
+  return false;
+}
+#endif
+
+void _Scheduler_Latency_reset( void )
+{
+#if defined(RTEMS_PROFILING)
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire( &_Scheduler_Latency_lock, &lock_context );
+  memset(
+    &_Scheduler_Latency_priorities[ 0 ],
+    0,
+    sizeof( _Scheduler_Latency_priorities )
+  );
+  _ISR_lock_Release_and_ISR_enable( &_Scheduler_Latency_lock, &lock_context );
+
+  _Thread_Iterate( _Scheduler_Latency_reset_thread, NULL );
+#endif
+}
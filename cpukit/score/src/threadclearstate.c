@@ -62,6 +62,7 @@ States_Control _Thread_Clear_state_locked(
     the_thread->current_state = next_state;
 
     if ( _States_Is_ready( next_state ) ) {
+      _Scheduler_Latency_unblock( the_thread );
       _Scheduler_Unblock( the_thread );
     }
   }
@@ -319,6 +319,8 @@ void _Thread_Do_dispatch( Per_CPU_Control *cpu_self, ISR_Level level )
       ( *cpu_budget_operations->at_context_switch )( heir );
     }
 
+    _Scheduler_Latency_context_switch( heir );
+
     _ISR_Local_enable( level );
 
 #if !defined(RTEMS_SMP)
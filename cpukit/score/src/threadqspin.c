@@ -0,0 +1,137 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreThreadQueue
+ *
+ * @brief This source file contains the implementation of
+ *   _Thread_queue_Spin_while_owner_executes().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/threadqimpl.h>
+#include <rtems/score/cpuimpl.h>
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/threadimpl.h>
+
+static const Thread_Control *_Thread_queue_Spin_get_owner(
+  const Thread_queue_Queue *queue
+)
+{
+  return *(const Thread_Control * const volatile *) &queue->owner;
+}
+
+/*
+ * The spin maximum in CPU counter ticks.  It is computed on demand, since the
+ * CPU counter frequency may be unknown before the CPU counter initialization.
+ * Concurrent computations yield the same value.
+ */
+static uint32_t _Thread_queue_Spin_maximum;
+
+static uint32_t _Thread_queue_Spin_get_maximum( void )
+{
+  uint32_t maximum;
+
+  maximum = _Thread_queue_Spin_maximum;
+
+  if ( RTEMS_PREDICT_FALSE( maximum == 0 ) ) {
+    maximum = THREAD_QUEUE_SPIN_MAXIMUM;
+
+    if ( maximum == 0 ) {
+      maximum = 1;
+    }
+
+    _Thread_queue_Spin_maximum = maximum;
+  }
+
+  return maximum;
+}
+
+uint32_t _Thread_queue_Spin_while_owner_executes(
+  const Thread_queue_Queue *queue,
+  const Thread_Control     *executing,
+  uint32_t                  spin_estimate
+)
+{
+  const Thread_Control *owner;
+  uint32_t              maximum;
+  uint32_t              limit;
+  CPU_Counter_ticks     begin;
+  uint32_t              duration;
+
+  if ( !_SMP_Need_inter_processor_interrupts() ) {
+    return spin_estimate;
+  }
+
+  owner = _Thread_queue_Spin_get_owner( queue );
+
+  if (
+    owner == NULL
+      || owner == executing
+      || !_Thread_Is_executing_on_a_processor( owner )
+  ) {
+    return spin_estimate;
+  }
+
+  maximum = _Thread_queue_Spin_get_maximum();
+
+  if ( spin_estimate > maximum ) {
+    spin_estimate = maximum;
+  }
+
+  limit = 2 * spin_estimate + maximum / 16;
+
+  if ( limit > maximum ) {
+    limit = maximum;
+  }
+
+  begin = _CPU_Counter_read();
+
+  do {
+    _CPU_SMP_Processor_relax();
+    duration = (uint32_t) _CPU_Counter_difference( _CPU_Counter_read(), begin );
+
+    if ( _Thread_queue_Spin_get_owner( queue ) != owner ) {
+      break;
+    }
+  } while (
+    duration < limit && _Thread_Is_executing_on_a_processor( owner )
+  );
+
+  if ( duration > spin_estimate ) {
+    spin_estimate += ( duration - spin_estimate ) / 8;
+  } else {
+    spin_estimate -= ( spin_estimate - duration ) / 8;
+  }
+
+  return spin_estimate;
+}
@@ -0,0 +1,166 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief This source file contains the implementation of
+ *   _Watchdog_Ticks_until_next_expiration() and _Watchdog_Skip_ticks().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/timecounter.h>
+
+static uint64_t _Watchdog_Ticks_until(
+  uint64_t               expire,
+  const struct timespec *now
+)
+{
+  uint64_t now_ticks;
+  uint64_t delta;
+
+  now_ticks = _Watchdog_Ticks_from_timespec( now );
+
+  if ( expire <= now_ticks ) {
+    return 0;
+  }
+
+  delta = ( expire >> WATCHDOG_BITS_FOR_1E9_NANOSECONDS )
+    - (uint64_t) now->tv_sec;
+  delta *= WATCHDOG_NANOSECONDS_PER_SECOND;
+  delta += expire & ( ( 1U << WATCHDOG_BITS_FOR_1E9_NANOSECONDS ) - 1 );
+  delta -= (uint64_t) now->tv_nsec;
+
+  /*
+   * The next clock tick may happen at any time in the next tick interval,
+   * so round down.
+   */
+  return delta / _Watchdog_Nanoseconds_per_tick;
+}
+
+static uint64_t _Watchdog_Minimum( uint64_t a, uint64_t b )
+{
+  return a < b ? a : b;
+}
+
+uint64_t _Watchdog_Ticks_until_next_expiration(
+  Per_CPU_Control *cpu,
+  uint64_t         ticks_maximum
+)
+{
+  ISR_lock_Context  lock_context;
+  Watchdog_Control *first;
+  uint64_t          ticks;
+  struct timespec   now;
+
+  ticks = ticks_maximum;
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+
+  first = _Watchdog_Header_first(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ]
+  );
+
+  if ( first != NULL ) {
+    if ( first->expire <= cpu->Watchdog.ticks ) {
+      ticks = 0;
+    } else {
+      ticks = _Watchdog_Minimum( ticks, first->expire - cpu->Watchdog.ticks );
+    }
+  }
+
+  first = _Watchdog_Header_first(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ]
+  );
+
+  if ( first != NULL ) {
+    _Timecounter_Nanouptime( &now );
+    ticks = _Watchdog_Minimum(
+      ticks,
+      _Watchdog_Ticks_until( first->expire, &now )
+    );
+  }
+
+  first = _Watchdog_Header_first(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ]
+  );
+
+  if ( first != NULL ) {
+    _Timecounter_Nanotime( &now );
+    ticks = _Watchdog_Minimum(
+      ticks,
+      _Watchdog_Ticks_until( first->expire, &now )
+    );
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+  return ticks;
+}
+
+void _Watchdog_Skip_ticks( Per_CPU_Control *cpu, uint64_t ticks )
+{
+  ISR_lock_Context  lock_context;
+  Watchdog_Header  *header;
+  Watchdog_Control *first;
+
+  if ( ticks == 0 ) {
+    return;
+  }
+
+  if ( _Per_CPU_Is_boot_processor( cpu ) ) {
+    _Watchdog_Ticks_since_boot += (Watchdog_Interval) ticks;
+  }
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+
+  ticks += cpu->Watchdog.ticks;
+  cpu->Watchdog.ticks = ticks;
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+  first = _Watchdog_Header_first( header );
+
+  /*
+   * The Clock Driver should not skip ticks beyond the next expiration,
+   * however, do not lose watchdogs if it did so.
+   */
+  if ( first != NULL ) {
+    _Watchdog_Tickle(
+      header,
+      first,
+      ticks,
+      &cpu->Watchdog.Lock,
+      &lock_context
+    );
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
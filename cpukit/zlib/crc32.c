@@ -49,6 +49,12 @@
 #  endif /* STDC */
 #endif /* !NOBYFOUR */
 
+/* Process eight data bytes per step in crc32_little() and crc32_big() with
+   four more tables for each endianness, unless NOBYEIGHT is defined. */
+#if defined(BYFOUR) && !defined(NOBYEIGHT)
+#  define BYEIGHT
+#endif
+
 /* Definitions for doing the crc four data bytes at a time. */
 #ifdef BYFOUR
 #  define REV(w) ((((w)>>24)&0xff)+(((w)>>8)&0xff00)+ \
@@ -57,7 +63,11 @@
                         const unsigned char FAR *, unsigned));
    local unsigned long crc32_big OF((unsigned long,
                         const unsigned char FAR *, unsigned));
-#  define TBLS 8
+#  ifdef BYEIGHT
+#    define TBLS 16
+#  else
+#    define TBLS 8
+#  endif
 #else
 #  define TBLS 1
 #endif /* BYFOUR */
@@ -101,7 +111,9 @@ local void make_crc_table OF((void));
   all the information needed to generate CRCs on data a byte at a time for all
   combinations of CRC register values and incoming bytes.  The remaining tables
   allow for word-at-a-time CRC calculation for both big-endian and little-
-  endian machines, where a word is four bytes.
+  endian machines, where a word is four bytes.  With BYEIGHT, tables eight to
+  fifteen extend this to the CRC of each value followed by four to seven zeros
+  to process two words in one step.
 */
 local void make_crc_table()
 {
@@ -142,6 +154,13 @@ local void make_crc_table()
                 crc_table[k][n] = c;
                 crc_table[k + 4][n] = REV(c);
             }
+#ifdef BYEIGHT
+            for (k = 8; k < 12; k++) {
+                c = crc_table[0][c & 0xff] ^ (c >> 8);
+                crc_table[k][n] = c;
+                crc_table[k + 4][n] = REV(c);
+            }
+#endif /* BYEIGHT */
         }
 #endif /* BYFOUR */
 
@@ -171,6 +190,14 @@ local void make_crc_table()
             fprintf(out, "  },\n  {\n");
             write_table(out, crc_table[k]);
         }
+#    ifdef BYEIGHT
+        fprintf(out, "#ifdef BYEIGHT\n");
+        for (k = 8; k < 16; k++) {
+            fprintf(out, "  },\n  {\n");
+            write_table(out, crc_table[k]);
+        }
+        fprintf(out, "#endif\n");
+#    endif /* BYEIGHT */
         fprintf(out, "#endif\n");
 #  endif /* BYFOUR */
         fprintf(out, "  }\n};\n");
@@ -257,6 +284,12 @@ unsigned long ZEXPORT crc32(crc, buf, len)
         c = crc_table[3][c & 0xff] ^ crc_table[2][(c >> 8) & 0xff] ^ \
             crc_table[1][(c >> 16) & 0xff] ^ crc_table[0][c >> 24]
 #define DOLIT32 DOLIT4; DOLIT4; DOLIT4; DOLIT4; DOLIT4; DOLIT4; DOLIT4; DOLIT4
+#define DOLIT8 c ^= *buf4++; d = *buf4++; \
+        c = crc_table[11][c & 0xff] ^ crc_table[10][(c >> 8) & 0xff] ^ \
+            crc_table[9][(c >> 16) & 0xff] ^ crc_table[8][c >> 24] ^ \
+            crc_table[3][d & 0xff] ^ crc_table[2][(d >> 8) & 0xff] ^ \
+            crc_table[1][(d >> 16) & 0xff] ^ crc_table[0][d >> 24]
+#define DOLIT32_8 DOLIT8; DOLIT8; DOLIT8; DOLIT8
 
 /* ========================================================================= */
 local unsigned long crc32_little(crc, buf, len)
@@ -266,6 +299,9 @@ local unsigned long crc32_little(crc, buf, len)
 {
     register u4 c;
     register const u4 FAR *buf4;
+#ifdef BYEIGHT
+    register u4 d;
+#endif
 
     c = (u4)crc;
     c = ~c;
@@ -276,7 +312,11 @@ local unsigned long crc32_little(crc, buf, len)
 
     buf4 = (const u4 FAR *)(const void FAR *)buf;
     while (len >= 32) {
+#ifdef BYEIGHT
+        DOLIT32_8;
+#else
         DOLIT32;
+#endif
         len -= 32;
     }
     while (len >= 4) {
@@ -297,6 +337,12 @@ local unsigned long crc32_little(crc, buf, len)
         c = crc_table[4][c & 0xff] ^ crc_table[5][(c >> 8) & 0xff] ^ \
             crc_table[6][(c >> 16) & 0xff] ^ crc_table[7][c >> 24]
 #define DOBIG32 DOBIG4; DOBIG4; DOBIG4; DOBIG4; DOBIG4; DOBIG4; DOBIG4; DOBIG4
+#define DOBIG8 c ^= *++buf4; d = *++buf4; \
+        c = crc_table[12][c & 0xff] ^ crc_table[13][(c >> 8) & 0xff] ^ \
+            crc_table[14][(c >> 16) & 0xff] ^ crc_table[15][c >> 24] ^ \
+            crc_table[4][d & 0xff] ^ crc_table[5][(d >> 8) & 0xff] ^ \
+            crc_table[6][(d >> 16) & 0xff] ^ crc_table[7][d >> 24]
+#define DOBIG32_8 DOBIG8; DOBIG8; DOBIG8; DOBIG8
 
 /* ========================================================================= */
 local unsigned long crc32_big(crc, buf, len)
@@ -306,6 +352,9 @@ local unsigned long crc32_big(crc, buf, len)
 {
     register u4 c;
     register const u4 FAR *buf4;
+#ifdef BYEIGHT
+    register u4 d;
+#endif
 
     c = REV((u4)crc);
     c = ~c;
@@ -317,7 +366,11 @@ local unsigned long crc32_big(crc, buf, len)
     buf4 = (const u4 FAR *)(const void FAR *)buf;
     buf4--;
     while (len >= 32) {
+#ifdef BYEIGHT
+        DOBIG32_8;
+#else
         DOBIG32;
+#endif
         len -= 32;
     }
     while (len >= 4) {
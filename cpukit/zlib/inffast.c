@@ -29,6 +29,28 @@
 #  define PUP(a) *++(a)
 #endif
 
+/* Copy matches with a distance of at least CHUNK bytes in CHUNK byte pieces,
+   unless NOCHUNKCOPY is defined.  The source and destination of a piece never
+   overlap, so the fixed size zmemcpy() compiles to word loads and stores on
+   targets which allow this.  The output is identical to the byte copy loop.
+ */
+#ifndef NOCHUNKCOPY
+#  define CHUNK 8
+#  define CHUNKCOPY() \
+    do { \
+        if (dist >= CHUNK) { \
+            while (len >= CHUNK) { \
+                zmemcpy(out + OFF, from + OFF, CHUNK); \
+                out += CHUNK; \
+                from += CHUNK; \
+                len -= CHUNK; \
+            } \
+        } \
+    } while (0)
+#else
+#  define CHUNKCOPY()
+#endif
+
 /*
    Decode literal, length, and distance codes and write out the resulting
    literal and match bytes until either not enough input or output is
@@ -253,6 +275,7 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
                             from = out - dist;  /* rest from output */
                         }
                     }
+                    CHUNKCOPY();
                     while (len > 2) {
                         PUP(out) = PUP(from);
                         PUP(out) = PUP(from);
@@ -267,12 +290,13 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
                 }
                 else {
                     from = out - dist;          /* copy direct from output */
-                    do {                        /* minimum length is three */
+                    CHUNKCOPY();
+                    while (len > 2) {
                         PUP(out) = PUP(from);
                         PUP(out) = PUP(from);
                         PUP(out) = PUP(from);
                         len -= 3;
-                    } while (len > 2);
+                    }
                     if (len) {
                         PUP(out) = PUP(from);
                         if (len > 1)
@@ -0,0 +1,523 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSJFFS2COMPR 1";
+
+#define MOUNT_PATH "/mnt"
+
+#define FILE_PATH MOUNT_PATH "/file"
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define FLASH_SIZE (64UL * BLOCK_SIZE)
+
+#define CHUNK_SIZE 4096
+
+#define FILE_SIZE (256 * 1024)
+
+#define READ_ROUNDS 4
+
+/* On-flash node layout, see <linux/jffs2.h> */
+
+#define NODE_MAGIC 0x1985
+
+#define NODE_TYPE_INODE 0xe002
+
+#define NODE_HEADER_SIZE 12
+
+#define INODE_DSIZE_OFFSET 52
+
+#define INODE_COMPR_OFFSET 56
+
+#define INODE_SIZE 68
+
+#define COMPR_NONE 0x00
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static flash_control *get_flash_control(rtems_jffs2_flash_control *super)
+{
+  return (flash_control *) super;
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memcpy(buffer, chunk, size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t i;
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memset(chunk, 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static rtems_jffs2_compressor_control rtime_instance = {
+  .compress = rtems_jffs2_compressor_rtime_compress,
+  .decompress = rtems_jffs2_compressor_rtime_decompress
+};
+
+static rtems_jffs2_compressor_zlib_control zlib_instance = {
+  .super = {
+    .compress = rtems_jffs2_compressor_zlib_compress,
+    .decompress = rtems_jffs2_compressor_zlib_decompress
+  }
+};
+
+static rtems_jffs2_compressor_lzo_control lzo_instance = {
+  .super = {
+    .compress = rtems_jffs2_compressor_lzo_compress,
+    .decompress = rtems_jffs2_compressor_lzo_decompress
+  }
+};
+
+typedef struct {
+  const char *name;
+  rtems_jffs2_mount_data mount_data;
+} compressor_config;
+
+typedef enum {
+  CONFIG_NONE,
+  CONFIG_RTIME,
+  CONFIG_ZLIB,
+  CONFIG_LZO,
+  CONFIG_LZO_POLICY,
+  CONFIG_LZO_REJECT
+} config_index;
+
+typedef struct {
+  uint32_t used_size;
+  uint32_t data_nodes;
+  uint32_t compressed_nodes;
+} compressor_result;
+
+static const compressor_config configs[] = {
+  {
+    .name = "none",
+    .mount_data = {
+      .flash_control = &flash_instance.super
+    }
+  }, {
+    .name = "rtime",
+    .mount_data = {
+      .flash_control = &flash_instance.super,
+      .compressor_control = &rtime_instance
+    }
+  }, {
+    .name = "zlib",
+    .mount_data = {
+      .flash_control = &flash_instance.super,
+      .compressor_control = &zlib_instance.super
+    }
+  }, {
+    .name = "lzo",
+    .mount_data = {
+      .flash_control = &flash_instance.super,
+      .compressor_control = &lzo_instance.super
+    }
+  }, {
+    .name = "lzo-policy",
+    .mount_data = {
+      .flash_control = &flash_instance.super,
+      .compressor_control = &lzo_instance.super,
+      .compressor_min_saving = 10,
+      .compressor_backoff = 4
+    }
+  }, {
+    /* The text saves less than this so no node is stored compressed */
+    .name = "lzo-reject",
+    .mount_data = {
+      .flash_control = &flash_instance.super,
+      .compressor_control = &lzo_instance.super,
+      .compressor_min_saving = 90
+    }
+  }
+};
+
+static const char * const words[] = {
+  "flash ",
+  "erase ",
+  "block ",
+  "node ",
+  "inode ",
+  "write ",
+  "read ",
+  "the ",
+  "of ",
+  "garbage ",
+  "collection ",
+  "summary\n"
+};
+
+static unsigned char chunk[CHUNK_SIZE];
+
+static uint32_t simple_random(uint32_t v)
+{
+  v *= 1664525;
+  v += 1013904223;
+
+  return v;
+}
+
+/*
+ * Most chunks contain text, every eighth chunk contains incompressible data.
+ */
+static void fill_chunk(off_t offset)
+{
+  uint32_t v = (uint32_t) offset + 1;
+  size_t i = 0;
+
+  if ((offset / CHUNK_SIZE) % 8 == 7) {
+    for (i = 0; i < CHUNK_SIZE; ++i) {
+      v = simple_random(v);
+      chunk[i] = (unsigned char) (v >> 23);
+    }
+  } else {
+    while (i < CHUNK_SIZE) {
+      const char *word;
+      size_t n;
+
+      v = simple_random(v);
+      word = words[(v >> 16) % RTEMS_ARRAY_SIZE(words)];
+      n = strlen(word);
+
+      if (n > CHUNK_SIZE - i) {
+        n = CHUNK_SIZE - i;
+      }
+
+      memcpy(&chunk[i], word, n);
+      i += n;
+    }
+  }
+}
+
+static uint64_t write_file(void)
+{
+  uint64_t begin;
+  off_t offset;
+  int fd;
+  int rv;
+
+  fd = open(FILE_PATH, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  for (offset = 0; offset < FILE_SIZE; offset += CHUNK_SIZE) {
+    ssize_t n;
+
+    fill_chunk(offset);
+    n = write(fd, chunk, CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  return rtems_clock_get_uptime_nanoseconds() - begin;
+}
+
+static uint64_t read_file(void)
+{
+  static unsigned char buf[CHUNK_SIZE];
+  uint64_t delta = 0;
+  int round;
+
+  for (round = 0; round < READ_ROUNDS; ++round) {
+    uint64_t begin;
+    off_t offset;
+    int fd;
+    int rv;
+
+    fd = open(FILE_PATH, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    for (offset = 0; offset < FILE_SIZE; offset += CHUNK_SIZE) {
+      ssize_t n;
+
+      begin = rtems_clock_get_uptime_nanoseconds();
+      n = read(fd, buf, CHUNK_SIZE);
+      delta += rtems_clock_get_uptime_nanoseconds() - begin;
+      rtems_test_assert(n == CHUNK_SIZE);
+
+      fill_chunk(offset);
+      rtems_test_assert(memcmp(buf, chunk, CHUNK_SIZE) == 0);
+    }
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+
+  return delta;
+}
+
+static uint32_t get_used_size(void)
+{
+  rtems_jffs2_info info;
+  int fd;
+  int rv;
+
+  fd = open(MOUNT_PATH, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_JFFS2_GET_INFO, &info);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  return info.used_size;
+}
+
+/*
+ * Count the valid inode nodes which carry file data on the flash and the ones
+ * of them which are stored compressed.
+ */
+static void count_data_nodes(compressor_result *result)
+{
+  uint32_t block;
+
+  result->data_nodes = 0;
+  result->compressed_nodes = 0;
+
+  for (block = 0; block < FLASH_SIZE; block += BLOCK_SIZE) {
+    uint32_t offset = 0;
+
+    while (offset + NODE_HEADER_SIZE <= BLOCK_SIZE) {
+      const unsigned char *node = &flash_instance.area[block + offset];
+      uint16_t magic;
+      uint16_t type;
+      uint32_t totlen;
+
+      memcpy(&magic, &node[0], sizeof(magic));
+      memcpy(&type, &node[2], sizeof(type));
+      memcpy(&totlen, &node[4], sizeof(totlen));
+
+      if (
+        magic != NODE_MAGIC
+          || totlen < NODE_HEADER_SIZE
+          || totlen > BLOCK_SIZE - offset
+      ) {
+        offset += 4;
+        continue;
+      }
+
+      if (type == NODE_TYPE_INODE && totlen >= INODE_SIZE) {
+        uint32_t dsize;
+
+        memcpy(&dsize, &node[INODE_DSIZE_OFFSET], sizeof(dsize));
+
+        if (dsize != 0) {
+          ++result->data_nodes;
+
+          if (node[INODE_COMPR_OFFSET] != COMPR_NONE) {
+            ++result->compressed_nodes;
+          }
+        }
+      }
+
+      offset += (totlen + 3) & ~UINT32_C(3);
+    }
+  }
+}
+
+static uint64_t throughput(uint64_t bytes, uint64_t ns)
+{
+  if (ns == 0) {
+    ns = 1;
+  }
+
+  return (bytes * 1000000000) / (ns * 1024);
+}
+
+static void test_compressor(
+  const compressor_config *config,
+  compressor_result *result
+)
+{
+  uint64_t write_time;
+  uint64_t read_time;
+  int rv;
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+
+  rv = mount_and_make_target_path(
+    NULL,
+    MOUNT_PATH,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &config->mount_data
+  );
+  rtems_test_assert(rv == 0);
+
+  write_time = write_file();
+  result->used_size = get_used_size();
+  count_data_nodes(result);
+
+  /* Read the nodes from the flash and not from the write time state */
+  rv = unmount(MOUNT_PATH);
+  rtems_test_assert(rv == 0);
+
+  rv = mount_and_make_target_path(
+    NULL,
+    MOUNT_PATH,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &config->mount_data
+  );
+  rtems_test_assert(rv == 0);
+
+  read_time = read_file();
+
+  rv = unmount(MOUNT_PATH);
+  rtems_test_assert(rv == 0);
+
+  printf(
+    "%-10s: write %7" PRIu64 " KiB/s, read %7" PRIu64
+    " KiB/s, used %7" PRIu32 " bytes (%3" PRIu32 "%%), nodes %3" PRIu32
+    " (%3" PRIu32 " compressed)\n",
+    config->name,
+    throughput(FILE_SIZE, write_time),
+    throughput((uint64_t) READ_ROUNDS * FILE_SIZE, read_time),
+    result->used_size,
+    (uint32_t) (((uint64_t) result->used_size * 100) / FILE_SIZE),
+    result->data_nodes,
+    result->compressed_nodes
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  compressor_result results[RTEMS_ARRAY_SIZE(configs)];
+  size_t i;
+
+  TEST_BEGIN();
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(configs); ++i) {
+    test_compressor(&configs[i], &results[i]);
+  }
+
+  rtems_test_assert(results[CONFIG_NONE].compressed_nodes == 0);
+
+  /* Each compressor must save space compared to no compression */
+  for (i = CONFIG_RTIME; i <= CONFIG_LZO_POLICY; ++i) {
+    rtems_test_assert(results[i].used_size < results[CONFIG_NONE].used_size);
+    rtems_test_assert(results[i].compressed_nodes > 0);
+  }
+
+  /*
+   * The back off stores the text following incompressible data uncompressed
+   * which needs more space.
+   */
+  rtems_test_assert(
+    results[CONFIG_LZO_POLICY].compressed_nodes
+      < results[CONFIG_LZO].compressed_nodes
+  );
+  rtems_test_assert(
+    results[CONFIG_LZO_POLICY].used_size > results[CONFIG_LZO].used_size
+  );
+
+  /*
+   * If the policy rejects each compression the data must be stored exactly as
+   * without a compressor and not in nodes cut to the compressed size.
+   */
+  rtems_test_assert(results[CONFIG_LZO_REJECT].compressed_nodes == 0);
+  rtems_test_assert(
+    results[CONFIG_LZO_REJECT].data_nodes
+      == results[CONFIG_NONE].data_nodes
+  );
+  rtems_test_assert(
+    results[CONFIG_LZO_REJECT].used_size == results[CONFIG_NONE].used_size
+  );
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
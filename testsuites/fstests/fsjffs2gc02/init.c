@@ -0,0 +1,327 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSJFFS2GC 2";
+
+#define MOUNT_PATH "/mnt"
+
+#define FILE_PATH MOUNT_PATH "/file"
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define FLASH_SIZE (16UL * BLOCK_SIZE)
+
+#define CHUNK_SIZE 1024
+
+#define FILE_SIZE (32 * CHUNK_SIZE)
+
+#define ROUNDS 64
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static flash_control *get_flash_control(rtems_jffs2_flash_control *super)
+{
+  return (flash_control *) super;
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memcpy(buffer, chunk, size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t i;
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memset(chunk, 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static const rtems_jffs2_gc_task_config gc_task_config = {
+  .priority = 2,
+  .stack_size = 16 * 1024,
+  .free_blocks_low = 4,
+  .free_blocks_high = 8,
+  .step_time = 1000,
+  .step_interval = 0,
+  .pre_erase = true
+};
+
+static const rtems_jffs2_mount_data mount_data = {
+  .flash_control = &flash_instance.super,
+  .gc_task = &gc_task_config
+};
+
+static unsigned char chunk[CHUNK_SIZE];
+
+static void fill_chunk(uint32_t round, off_t offset)
+{
+  size_t i;
+
+  for (i = 0; i < CHUNK_SIZE; ++i) {
+    chunk[i] = (unsigned char) (offset + i + round * 7);
+  }
+}
+
+static void write_file(uint32_t round)
+{
+  off_t offset;
+  int fd;
+  int rv;
+
+  fd = open(FILE_PATH, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  for (offset = 0; offset < FILE_SIZE; offset += CHUNK_SIZE) {
+    ssize_t n;
+
+    fill_chunk(round, offset);
+    n = write(fd, chunk, CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void check_file(uint32_t round)
+{
+  static unsigned char buf[CHUNK_SIZE];
+  off_t offset;
+  int fd;
+  int rv;
+
+  fd = open(FILE_PATH, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  for (offset = 0; offset < FILE_SIZE; offset += CHUNK_SIZE) {
+    ssize_t n;
+
+    fill_chunk(round, offset);
+    n = read(fd, buf, CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+    rtems_test_assert(memcmp(buf, chunk, CHUNK_SIZE) == 0);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void get_info(rtems_jffs2_info *info)
+{
+  int fd;
+  int rv;
+
+  fd = open(MOUNT_PATH, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_JFFS2_GET_INFO, info);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(void)
+{
+  rtems_jffs2_info info;
+  uint32_t round;
+  uint32_t writes;
+  size_t i;
+  int rv;
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+
+  rv = mount_and_make_target_path(
+    NULL,
+    MOUNT_PATH,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_data
+  );
+  rtems_test_assert(rv == 0);
+
+  for (round = 0; round < ROUNDS; ++round) {
+    write_file(round);
+    check_file(round);
+
+    /* Give the garbage collection task a chance to run */
+    if ((round % 8) == 7) {
+      rtems_status_code sc;
+
+      sc = rtems_task_wake_after(1);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+  }
+
+  /* Let the garbage collection task reach the high watermark */
+  for (i = 0; i < 100; ++i) {
+    rtems_status_code sc;
+
+    get_info(&info);
+
+    if (info.free_blocks >= gc_task_config.free_blocks_high) {
+      break;
+    }
+
+    sc = rtems_task_wake_after(1);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  rtems_test_assert(info.free_blocks >= gc_task_config.free_blocks_low);
+  rtems_test_assert(info.statistics.gc_steps > 0);
+  rtems_test_assert(info.statistics.gc_passes > 0);
+  rtems_test_assert(info.statistics.erased_blocks > 0);
+  rtems_test_assert(info.statistics.pre_erased_blocks > 0);
+
+  writes = 0;
+
+  for (i = 0; i < RTEMS_JFFS2_WRITE_STALL_BINS; ++i) {
+    writes += info.statistics.write_stalls[i];
+  }
+
+  rtems_test_assert(writes == ROUNDS * (FILE_SIZE / CHUNK_SIZE));
+
+  printf(
+    "free blocks: %" PRIu32 "\n"
+    "gc steps: %" PRIu32 "\n"
+    "gc passes: %" PRIu32 "\n"
+    "gc time: %" PRIu64 " us\n"
+    "erased blocks: %" PRIu32 "\n"
+    "pre-erased blocks: %" PRIu32 "\n",
+    info.free_blocks,
+    info.statistics.gc_steps,
+    info.statistics.gc_passes,
+    info.statistics.gc_time / 1000,
+    info.statistics.erased_blocks,
+    info.statistics.pre_erased_blocks
+  );
+
+  for (i = 0; i < RTEMS_JFFS2_WRITE_STALL_BINS; ++i) {
+    if (info.statistics.write_stalls[i] != 0) {
+      printf(
+        "writes taking %7lu us or more: %" PRIu32 "\n",
+        1UL << i,
+        info.statistics.write_stalls[i]
+      );
+    }
+  }
+
+  /* The unmount stops the garbage collection task */
+  rv = unmount(MOUNT_PATH);
+  rtems_test_assert(rv == 0);
+
+  rv = mount_and_make_target_path(
+    NULL,
+    MOUNT_PATH,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_data
+  );
+  rtems_test_assert(rv == 0);
+
+  check_file(ROUNDS - 1);
+
+  rv = unmount(MOUNT_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+/* One for the Init task and one for the garbage collection task */
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSJFFS2SUM 1";
+
+#define MOUNT_PATH "/mnt"
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define FILE_SIZE 4096
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  unsigned char *area;
+  uint64_t read_bytes;
+} flash_control;
+
+static flash_control *get_flash_control(rtems_jffs2_flash_control *super)
+{
+  return (flash_control *) super;
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memcpy(buffer, chunk, size_of_buffer);
+  self->read_bytes += size_of_buffer;
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t i;
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memset(chunk, 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static unsigned char file_data[FILE_SIZE];
+
+static void fill_file_data(int index)
+{
+  size_t i;
+
+  for (i = 0; i < FILE_SIZE; ++i) {
+    file_data[i] = (unsigned char) (i + (i >> 8) + index * 13);
+  }
+}
+
+static void make_path(char *path, size_t size, int index)
+{
+  snprintf(path, size, MOUNT_PATH "/f%04i", index);
+}
+
+static uint64_t do_mount(bool summary)
+{
+  rtems_jffs2_mount_data mount_data = {
+    .flash_control = &flash_instance.super,
+    .summary = summary
+  };
+  uint64_t begin;
+  int rv;
+
+  flash_instance.read_bytes = 0;
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  rv = mount_and_make_target_path(
+    NULL,
+    MOUNT_PATH,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_data
+  );
+  rtems_test_assert(rv == 0);
+
+  return rtems_clock_get_uptime_nanoseconds() - begin;
+}
+
+static void do_unmount(void)
+{
+  int rv;
+
+  rv = unmount(MOUNT_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void create_files(int count)
+{
+  int i;
+
+  for (i = 0; i < count; ++i) {
+    char path[32];
+    ssize_t n;
+    int fd;
+    int rv;
+
+    make_path(path, sizeof(path), i);
+    fill_file_data(i);
+
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+    rtems_test_assert(fd >= 0);
+
+    n = write(fd, file_data, FILE_SIZE);
+    rtems_test_assert(n == FILE_SIZE);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void check_files(int count)
+{
+  static unsigned char buf[FILE_SIZE];
+  int i;
+
+  for (i = 0; i < count; ++i) {
+    char path[32];
+    ssize_t n;
+    int fd;
+    int rv;
+
+    make_path(path, sizeof(path), i);
+    fill_file_data(i);
+
+    fd = open(path, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    n = read(fd, buf, FILE_SIZE);
+    rtems_test_assert(n == FILE_SIZE);
+    rtems_test_assert(memcmp(buf, file_data, FILE_SIZE) == 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void test_flash_size(uint32_t blocks)
+{
+  uint32_t flash_size = blocks * BLOCK_SIZE;
+  int count = (int) (blocks * 2);
+  uint64_t full_scan_time;
+  uint64_t full_scan_bytes;
+  uint64_t summary_time;
+  uint64_t summary_bytes;
+
+  flash_instance.area = malloc(flash_size);
+  rtems_test_assert(flash_instance.area != NULL);
+  memset(flash_instance.area, 0xff, flash_size);
+  flash_instance.super.flash_size = flash_size;
+
+  do_mount(true);
+  create_files(count);
+  do_unmount();
+
+  /*
+   * A mount without the summary option ignores the summaries and reads every
+   * node.
+   */
+  full_scan_time = do_mount(false);
+  full_scan_bytes = flash_instance.read_bytes;
+  check_files(count);
+  do_unmount();
+
+  summary_time = do_mount(true);
+  summary_bytes = flash_instance.read_bytes;
+  check_files(count);
+  do_unmount();
+
+  rtems_test_assert(summary_bytes < full_scan_bytes);
+
+  printf(
+    "flash %5" PRIu32 " KiB: full scan: %8" PRIu64 " bytes, %7" PRIu64
+    " us; summary: %8" PRIu64 " bytes, %7" PRIu64 " us\n",
+    flash_size / 1024,
+    full_scan_bytes,
+    full_scan_time / 1000,
+    summary_bytes,
+    summary_time / 1000
+  );
+
+  free(flash_instance.area);
+  flash_instance.area = NULL;
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_flash_size(16);
+  test_flash_size(32);
+  test_flash_size(64);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,338 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+#include <rtems/blkdev.h>
+#include <rtems/libio.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+
+const char rtems_test_name[] = "FSRAMDISK 1";
+
+#define MOUNT_PATH "/mnt"
+
+#define FILE_PATH MOUNT_PATH "/file"
+
+#define BLOCK_SIZE 1024
+
+#define BLOCK_COUNT 2048
+
+#define CACHE_SIZE (32 * 1024)
+
+#define CHUNK_SIZE 4096
+
+#define FILE_SIZE (512 * 1024)
+
+#define READ_ROUNDS 4
+
+static uint8_t chunk[CHUNK_SIZE];
+
+static void fill_chunk(off_t offset)
+{
+  size_t i;
+
+  for (i = 0; i < CHUNK_SIZE; ++i) {
+    chunk[i] = (uint8_t) (offset + i + ((offset + i) >> 10));
+  }
+}
+
+static void do_sync(void)
+{
+  int fd;
+  int rv;
+
+  fd = open(MOUNT_PATH, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = fsync(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void disk_ioctl(const char *disk, ioctl_command_t req, void *arg)
+{
+  int fd;
+  int rv;
+
+  fd = open(disk, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, req, arg);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void do_mount(const char *disk)
+{
+  int rv;
+
+  rv = mount_and_make_target_path(
+    disk,
+    MOUNT_PATH,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static uint64_t write_file(void)
+{
+  uint64_t begin;
+  off_t offset;
+  int fd;
+  int rv;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  fd = open(FILE_PATH, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  for (offset = 0; offset < FILE_SIZE; offset += CHUNK_SIZE) {
+    ssize_t n;
+
+    fill_chunk(offset);
+    n = write(fd, chunk, CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  do_sync();
+
+  return rtems_clock_get_uptime_nanoseconds() - begin;
+}
+
+static uint64_t read_file(void)
+{
+  static uint8_t buf[CHUNK_SIZE];
+  uint64_t delta = 0;
+  int round;
+
+  for (round = 0; round < READ_ROUNDS; ++round) {
+    uint64_t begin;
+    off_t offset;
+    int fd;
+    int rv;
+
+    fd = open(FILE_PATH, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    for (offset = 0; offset < FILE_SIZE; offset += CHUNK_SIZE) {
+      ssize_t n;
+
+      begin = rtems_clock_get_uptime_nanoseconds();
+      n = read(fd, buf, CHUNK_SIZE);
+      delta += rtems_clock_get_uptime_nanoseconds() - begin;
+      rtems_test_assert(n == CHUNK_SIZE);
+
+      fill_chunk(offset);
+      rtems_test_assert(memcmp(buf, chunk, CHUNK_SIZE) == 0);
+    }
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+
+  return delta;
+}
+
+static uint64_t throughput(uint64_t bytes, uint64_t ns)
+{
+  if (ns == 0) {
+    ns = 1;
+  }
+
+  return (bytes * 1000000000) / (ns * 1024);
+}
+
+static void test_ramdisk(const char *disk, bool mapped)
+{
+  static const rtems_rfs_format_config config = {
+    .block_size = BLOCK_SIZE
+  };
+  rtems_blkdev_stats stats;
+  rtems_status_code sc;
+  uint64_t write_time;
+  uint64_t read_time;
+  uint64_t copied;
+  ramdisk *rd;
+  int rv;
+
+  rd = ramdisk_allocate(NULL, BLOCK_SIZE, BLOCK_COUNT, false);
+  rtems_test_assert(rd != NULL);
+
+  ramdisk_enable_free_at_delete_request(rd);
+
+  if (mapped) {
+    ramdisk_enable_mapping(rd);
+  }
+
+  sc = rtems_blkdev_create(disk, BLOCK_SIZE, BLOCK_COUNT, ramdisk_ioctl, rd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rv = rtems_rfs_format(disk, &config);
+  rtems_test_assert(rv == 0);
+
+  do_mount(disk);
+
+  disk_ioctl(disk, RTEMS_BLKIO_RESETDEVSTATS, NULL);
+
+  write_time = write_file();
+
+  /* Read the blocks from the disk and not from the cache */
+  rv = unmount(MOUNT_PATH);
+  rtems_test_assert(rv == 0);
+
+  disk_ioctl(disk, RTEMS_BLKIO_PURGEDEV, NULL);
+  do_mount(disk);
+
+  read_time = read_file();
+
+  disk_ioctl(disk, RTEMS_BLKIO_GETDEVSTATS, &stats);
+
+  rv = unmount(MOUNT_PATH);
+  rtems_test_assert(rv == 0);
+
+  copied = ((uint64_t) stats.read_blocks + stats.write_blocks) * BLOCK_SIZE;
+
+  printf(
+    "%-6s: write %6" PRIu64 " KiB/s, read %6" PRIu64 " KiB/s, "
+    "copied %8" PRIu64 " bytes\n",
+    mapped ? "mapped" : "copy",
+    throughput(FILE_SIZE, write_time),
+    throughput((uint64_t) READ_ROUNDS * FILE_SIZE, read_time),
+    copied
+  );
+
+  if (mapped) {
+    /* The file system works directly on the RAM disk memory */
+    rtems_test_assert(stats.read_misses == 0);
+    rtems_test_assert(stats.read_blocks == 0);
+    rtems_test_assert(stats.write_blocks == 0);
+    rtems_test_assert(stats.write_transfers == 0);
+  } else {
+    rtems_test_assert(stats.read_blocks > 0);
+    rtems_test_assert(stats.write_blocks > 0);
+  }
+
+  rv = unlink(disk);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_mapped_buffers(void)
+{
+  static const char disk[] = "/dev/rdc";
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  rtems_bdbuf_buffer *bd;
+  uint8_t *area;
+  ramdisk *rd;
+  int fd;
+  int rv;
+
+  rd = ramdisk_allocate(NULL, BLOCK_SIZE, BLOCK_COUNT, false);
+  rtems_test_assert(rd != NULL);
+
+  ramdisk_enable_free_at_delete_request(rd);
+  ramdisk_enable_mapping(rd);
+  area = rd->area;
+
+  sc = rtems_blkdev_create(disk, BLOCK_SIZE, BLOCK_COUNT, ramdisk_ioctl, rd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(disk, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert((dd->capabilities & RTEMS_BLKDEV_CAP_MAPPED) != 0);
+  rtems_test_assert(dd->mapped_area == area);
+
+  /* A get provides the block in the RAM disk memory */
+  sc = rtems_bdbuf_get(dd, 7, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(bd->buffer == &area[7 * BLOCK_SIZE]);
+  memset(bd->buffer, 0xa5, BLOCK_SIZE);
+  sc = rtems_bdbuf_release_modified(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The modification is visible in the media without a write back */
+  rtems_test_assert(area[7 * BLOCK_SIZE] == 0xa5);
+  rtems_test_assert(area[8 * BLOCK_SIZE - 1] == 0xa5);
+
+  area[9 * BLOCK_SIZE] = 0x5a;
+  sc = rtems_bdbuf_read(dd, 9, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(bd->buffer == &area[9 * BLOCK_SIZE]);
+  rtems_test_assert(((uint8_t *) bd->buffer)[0] == 0x5a);
+  sc = rtems_bdbuf_sync(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_syncdev(dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(disk);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_mapped_buffers();
+  test_ramdisk("/dev/rda", false);
+  test_ramdisk("/dev/rdb", true);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE CACHE_SIZE
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (16 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
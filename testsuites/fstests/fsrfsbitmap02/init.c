@@ -0,0 +1,327 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/rfs/rtems-rfs-bitmaps.h>
+#include <rtems/rfs/rtems-rfs-file-system.h>
+
+const char rtems_test_name[] = "FSRFSBITMAP 2";
+
+/*
+ * The block bitmaps of a 1 GiB volume with 4 KiB blocks. A group's bitmap
+ * fills a block.
+ */
+#define BLOCK_SIZE 4096
+
+#define GROUP_BITS (BLOCK_SIZE * 8)
+
+#define GROUP_COUNT ((1024 * 1024 * 1024) / (BLOCK_SIZE * GROUP_BITS))
+
+/*
+ * Leave 1% of each group free. Half the free bits are single bits and half
+ * are runs of RUN_SIZE bits.
+ */
+#define FREE_BITS (GROUP_BITS / 100)
+
+#define RUN_SIZE 8
+
+#define RUN_COUNT ((FREE_BITS / 2) / RUN_SIZE)
+
+#define SINGLE_COUNT (FREE_BITS / 2)
+
+#define ROUNDS 20
+
+typedef struct
+{
+  rtems_rfs_bitmap_control control;
+  rtems_rfs_buffer_handle  handle;
+  rtems_rfs_buffer         buffer;
+  size_t                   free;
+} test_group;
+
+static rtems_rfs_file_system fs;
+
+static test_group groups[GROUP_COUNT];
+
+static uint32_t random_state;
+
+static uint32_t next_random (void)
+{
+  random_state = (random_state * 1103515245) + 12345;
+  return random_state >> 8;
+}
+
+/*
+ * Set all the bits in each group then clear the same pattern of single bits
+ * and runs for each round.
+ */
+static void fill_groups (void)
+{
+  int g;
+
+  random_state = 1;
+
+  for (g = 0; g < GROUP_COUNT; ++g)
+  {
+    rtems_rfs_bitmap_control* control = &groups[g].control;
+    rtems_rfs_bitmap_bit      bit;
+    int                       rc;
+    int                       i;
+    int                       j;
+
+    rc = rtems_rfs_bitmap_map_set_all (control);
+    rtems_test_assert (rc == 0);
+
+    for (i = 0; i < RUN_COUNT; ++i)
+    {
+      bit = next_random () % (GROUP_BITS - RUN_SIZE);
+      for (j = 0; j < RUN_SIZE; ++j)
+      {
+        rc = rtems_rfs_bitmap_map_clear (control, bit + j);
+        rtems_test_assert (rc == 0);
+      }
+    }
+
+    for (i = 0; i < SINGLE_COUNT; ++i)
+    {
+      bit = next_random () % GROUP_BITS;
+      rc = rtems_rfs_bitmap_map_clear (control, bit);
+      rtems_test_assert (rc == 0);
+    }
+
+    rc = rtems_rfs_bitmap_create_search (control);
+    rtems_test_assert (rc == 0);
+
+    groups[g].free = rtems_rfs_bitmap_map_free (control);
+  }
+}
+
+static void open_groups (void)
+{
+  int g;
+
+  memset (&fs, 0, sizeof (fs));
+
+  for (g = 0; g < GROUP_COUNT; ++g)
+  {
+    test_group* group = &groups[g];
+    int         rc;
+
+    group->buffer.buffer = malloc (BLOCK_SIZE);
+    rtems_test_assert (group->buffer.buffer != NULL);
+    group->buffer.block = g + 1;
+
+    rc = rtems_rfs_buffer_handle_open (&fs, &group->handle);
+    rtems_test_assert (rc == 0);
+
+    /*
+     * Do not close the handle so no writes need occur.
+     */
+    group->handle.buffer = &group->buffer;
+    group->handle.bnum = g + 1;
+
+    rc = rtems_rfs_bitmap_open (&group->control, &fs, &group->handle,
+                                GROUP_BITS, g + 1);
+    rtems_test_assert (rc == 0);
+  }
+}
+
+static void close_groups (void)
+{
+  int g;
+
+  for (g = 0; g < GROUP_COUNT; ++g)
+  {
+    rtems_rfs_bitmap_close (&groups[g].control);
+    free (groups[g].buffer.buffer);
+  }
+}
+
+static uint64_t rate (uint64_t count, uint64_t delta)
+{
+  if (delta == 0)
+    delta = 1;
+  return (count * 1000000000) / delta;
+}
+
+static void test_alloc (void)
+{
+  uint64_t count = 0;
+  uint64_t delta = 0;
+  int      round;
+
+  for (round = 0; round < ROUNDS; ++round)
+  {
+    int g;
+
+    fill_groups ();
+
+    for (g = 0; g < GROUP_COUNT; ++g)
+    {
+      rtems_rfs_bitmap_control* control = &groups[g].control;
+      rtems_rfs_bitmap_bit      seed = 0;
+      rtems_rfs_bitmap_bit      bit;
+      bool                      allocated;
+      uint64_t                  begin;
+      size_t                    n = 0;
+      int                       rc;
+
+      begin = rtems_clock_get_uptime_nanoseconds ();
+
+      while (true)
+      {
+        rc = rtems_rfs_bitmap_map_alloc (control, seed, &allocated, &bit);
+        rtems_test_assert (rc == 0);
+        if (!allocated)
+          break;
+        seed = bit;
+        ++n;
+      }
+
+      delta += rtems_clock_get_uptime_nanoseconds () - begin;
+
+      rtems_test_assert (n == groups[g].free);
+      rtems_test_assert (rtems_rfs_bitmap_map_free (control) == 0);
+
+      count += n;
+    }
+  }
+
+  printf ("alloc:         %8" PRIu64 " allocs/s (%" PRIu64 " allocs)\n",
+          rate (count, delta), count);
+}
+
+static void test_alloc_run (void)
+{
+  uint64_t count = 0;
+  uint64_t delta = 0;
+  int      round;
+
+  for (round = 0; round < ROUNDS; ++round)
+  {
+    int g;
+
+    fill_groups ();
+
+    for (g = 0; g < GROUP_COUNT; ++g)
+    {
+      rtems_rfs_bitmap_control* control = &groups[g].control;
+      rtems_rfs_bitmap_bit      seed = 0;
+      rtems_rfs_bitmap_bit      bit;
+      bool                      allocated;
+      bool                      state;
+      uint64_t                  begin;
+      size_t                    n = 0;
+      int                       rc;
+      int                       i;
+
+      begin = rtems_clock_get_uptime_nanoseconds ();
+
+      while (true)
+      {
+        rc = rtems_rfs_bitmap_map_alloc_run (control, seed, RUN_SIZE,
+                                             &allocated, &bit);
+        rtems_test_assert (rc == 0);
+        if (!allocated)
+          break;
+        seed = bit + RUN_SIZE;
+        ++n;
+
+        for (i = 0; i < RUN_SIZE; ++i)
+        {
+          rc = rtems_rfs_bitmap_map_test (control, bit + i, &state);
+          rtems_test_assert (rc == 0);
+          rtems_test_assert (state);
+        }
+      }
+
+      delta += rtems_clock_get_uptime_nanoseconds () - begin;
+
+      /*
+       * The failed search leaves the free run limit below the run size so
+       * the next request does not search the map.
+       */
+      rtems_test_assert (n >= 1);
+      rtems_test_assert (rtems_rfs_bitmap_map_free_run (control) < RUN_SIZE);
+      rtems_test_assert (rtems_rfs_bitmap_map_free (control) ==
+                         groups[g].free - (n * RUN_SIZE));
+
+      count += n;
+    }
+  }
+
+  printf ("alloc run %2d: %8" PRIu64 " runs/s (%" PRIu64 " runs)\n",
+          RUN_SIZE, rate (count, delta), count);
+}
+
+static void test_set_run (void)
+{
+  rtems_rfs_bitmap_control* control = &groups[0].control;
+  rtems_rfs_bitmap_bit      bit;
+  size_t                    set;
+  int                       rc;
+
+  rc = rtems_rfs_bitmap_map_set_all (control);
+  rtems_test_assert (rc == 0);
+
+  for (bit = 30; bit < 70; ++bit)
+  {
+    rc = rtems_rfs_bitmap_map_clear (control, bit);
+    rtems_test_assert (rc == 0);
+  }
+
+  rc = rtems_rfs_bitmap_map_set_run (control, 30, 10, &set);
+  rtems_test_assert (rc == 0);
+  rtems_test_assert (set == 10);
+  rtems_test_assert (rtems_rfs_bitmap_map_free (control) == 30);
+
+  rc = rtems_rfs_bitmap_map_set_run (control, 40, 100, &set);
+  rtems_test_assert (rc == 0);
+  rtems_test_assert (set == 30);
+  rtems_test_assert (rtems_rfs_bitmap_map_free (control) == 0);
+
+  rc = rtems_rfs_bitmap_map_set_run (control, GROUP_BITS, 1, &set);
+  rtems_test_assert (rc == EINVAL);
+}
+
+static void Init (rtems_task_argument arg)
+{
+  TEST_BEGIN ();
+
+  open_groups ();
+  test_alloc ();
+  test_alloc_run ();
+  test_set_run ();
+  close_groups ();
+
+  TEST_END ();
+  rtems_test_exit (0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,335 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <rtems/libio.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+
+const char rtems_test_name[] = "FSRFSDIR 1";
+
+#define DISK_PATH "/dev/rda"
+
+#define MOUNT_PATH "/mnt"
+
+#define DIR_PATH MOUNT_PATH "/dir"
+
+#define BLOCK_SIZE 1024
+
+#define BLOCK_COUNT 2048
+
+#define MAX_FILES 2048
+
+static const int file_counts[] = { 64, 512, MAX_FILES };
+
+#define SET_COUNT 3
+
+#define SET_FILES 256
+
+static void make_path (char *path, size_t size, int file)
+{
+  snprintf (path, size, DIR_PATH "/f%05d", file);
+}
+
+static uint64_t ops_per_second (int ops, uint64_t begin)
+{
+  uint64_t delta;
+
+  delta = rtems_clock_get_uptime_nanoseconds () - begin;
+
+  if (delta == 0)
+    delta = 1;
+
+  return ((uint64_t) ops * 1000000000) / delta;
+}
+
+static int count_entries (void)
+{
+  DIR           *dir;
+  struct dirent *entry;
+  int            count;
+
+  dir = opendir (DIR_PATH);
+  rtems_test_assert (dir != NULL);
+
+  count = 0;
+
+  while ((entry = readdir (dir)) != NULL)
+    ++count;
+
+  closedir (dir);
+
+  return count;
+}
+
+static void create_files (int first, int last, int step)
+{
+  char path[64];
+  int  file;
+
+  for (file = first; file < last; file += step)
+  {
+    int fd;
+
+    make_path (path, sizeof (path), file);
+    fd = open (path, O_RDWR | O_CREAT | O_EXCL, S_IRWXU);
+    rtems_test_assert (fd >= 0);
+    fd = close (fd);
+    rtems_test_assert (fd == 0);
+  }
+}
+
+static void unlink_files (int first, int last, int step)
+{
+  char path[64];
+  int  file;
+
+  for (file = first; file < last; file += step)
+  {
+    int rv;
+
+    make_path (path, sizeof (path), file);
+    rv = unlink (path);
+    rtems_test_assert (rv == 0);
+  }
+}
+
+static void lookup_files (int count)
+{
+  char        path[64];
+  struct stat st;
+  int         file;
+  int         rv;
+
+  for (file = 0; file < count; file++)
+  {
+    make_path (path, sizeof (path), file);
+    rv = stat (path, &st);
+    rtems_test_assert (rv == 0);
+    rtems_test_assert (S_ISREG (st.st_mode));
+  }
+
+  make_path (path, sizeof (path), count);
+  errno = 0;
+  rv = stat (path, &st);
+  rtems_test_assert (rv == -1);
+  rtems_test_assert (errno == ENOENT);
+}
+
+static void test_directory (int count)
+{
+  uint64_t begin;
+  uint64_t create;
+  uint64_t lookup;
+  uint64_t unlink;
+  int      rv;
+
+  rv = mkdir (DIR_PATH, S_IRWXU);
+  rtems_test_assert (rv == 0);
+
+  begin = rtems_clock_get_uptime_nanoseconds ();
+  create_files (0, count, 1);
+  create = ops_per_second (count, begin);
+
+  begin = rtems_clock_get_uptime_nanoseconds ();
+  lookup_files (count);
+  lookup = ops_per_second (count, begin);
+
+  rtems_test_assert (count_entries () == count + 2);
+
+  /*
+   * Remove every second file and create them again so the entries are added
+   * to the space released in the directory blocks.
+   */
+  unlink_files (0, count, 2);
+  rtems_test_assert (count_entries () == count / 2 + 2);
+  create_files (0, count, 2);
+  lookup_files (count);
+
+  begin = rtems_clock_get_uptime_nanoseconds ();
+  unlink_files (0, count, 1);
+  unlink = ops_per_second (count, begin);
+
+  rtems_test_assert (count_entries () == 2);
+
+  rv = rmdir (DIR_PATH);
+  rtems_test_assert (rv == 0);
+
+  printf (
+    "files: %5d, create: %7" PRIu64 "/s, lookup: %7" PRIu64
+    "/s, unlink: %7" PRIu64 "/s\n",
+    count,
+    create,
+    lookup,
+    unlink
+  );
+}
+
+static void make_set_path (char *path, size_t size, int set, int file)
+{
+  snprintf (path, size, MOUNT_PATH "/set%d/f%05d", set, file);
+}
+
+/*
+ * Search more large directories in turn than there are directory indexes so
+ * the directories have to be scanned or the indexes released.
+ */
+static void test_working_set (const char *options)
+{
+  char        path[64];
+  struct stat st;
+  int         set;
+  int         file;
+  int         rv;
+
+  rv = mount (
+    DISK_PATH,
+    MOUNT_PATH,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    options
+  );
+  rtems_test_assert (rv == 0);
+
+  for (set = 0; set < SET_COUNT; ++set)
+  {
+    snprintf (path, sizeof (path), MOUNT_PATH "/set%d", set);
+    rv = mkdir (path, S_IRWXU);
+    rtems_test_assert (rv == 0);
+  }
+
+  for (file = 0; file < SET_FILES; ++file)
+  {
+    for (set = 0; set < SET_COUNT; ++set)
+    {
+      int fd;
+
+      make_set_path (path, sizeof (path), set, file);
+      fd = open (path, O_RDWR | O_CREAT | O_EXCL, S_IRWXU);
+      rtems_test_assert (fd >= 0);
+      fd = close (fd);
+      rtems_test_assert (fd == 0);
+    }
+  }
+
+  for (file = 0; file < SET_FILES; ++file)
+  {
+    for (set = 0; set < SET_COUNT; ++set)
+    {
+      make_set_path (path, sizeof (path), set, file);
+      rv = stat (path, &st);
+      rtems_test_assert (rv == 0);
+      rtems_test_assert (S_ISREG (st.st_mode));
+
+      make_set_path (path, sizeof (path), set, file + SET_FILES);
+      errno = 0;
+      rv = stat (path, &st);
+      rtems_test_assert (rv == -1);
+      rtems_test_assert (errno == ENOENT);
+    }
+  }
+
+  for (file = 0; file < SET_FILES; ++file)
+  {
+    for (set = 0; set < SET_COUNT; ++set)
+    {
+      make_set_path (path, sizeof (path), set, file);
+      rv = unlink (path);
+      rtems_test_assert (rv == 0);
+    }
+  }
+
+  for (set = 0; set < SET_COUNT; ++set)
+  {
+    snprintf (path, sizeof (path), MOUNT_PATH "/set%d", set);
+    rv = rmdir (path);
+    rtems_test_assert (rv == 0);
+  }
+
+  rv = unmount (MOUNT_PATH);
+  rtems_test_assert (rv == 0);
+}
+
+static void test (void)
+{
+  static const rtems_rfs_format_config config = {
+    .block_size = BLOCK_SIZE,
+    .inode_overhead = 20
+  };
+  size_t i;
+  int    rv;
+
+  rv = ramdisk_register (BLOCK_SIZE, BLOCK_COUNT, false, DISK_PATH);
+  rtems_test_assert (rv == 0);
+
+  rv = rtems_rfs_format (DISK_PATH, &config);
+  rtems_test_assert (rv == 0);
+
+  rv = mount_and_make_target_path (
+    DISK_PATH,
+    MOUNT_PATH,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert (rv == 0);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE (file_counts); ++i)
+    test_directory (file_counts[i]);
+
+  rv = unmount (MOUNT_PATH);
+  rtems_test_assert (rv == 0);
+
+  test_working_set ("max-dir-indexes=0");
+  test_working_set ("max-dir-indexes=1");
+  test_working_set ("max-dir-indexes=2");
+  test_working_set (NULL);
+}
+
+static void Init (rtems_task_argument arg)
+{
+  TEST_BEGIN ();
+
+  test ();
+
+  TEST_END ();
+  rtems_test_exit (0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (16 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
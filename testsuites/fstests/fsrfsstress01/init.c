@@ -0,0 +1,314 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/libio.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+
+const char rtems_test_name[] = "FSRFSSTRESS 1";
+
+#define DISK_PATH "/dev/rda"
+
+#define MOUNT_PATH "/mnt"
+
+#define SHARED_PATH MOUNT_PATH "/shared"
+
+#define BLOCK_SIZE 1024
+
+#define BLOCK_COUNT 4096
+
+#define WORKER_COUNT 4
+
+#define ITERATIONS 32
+
+#define FILE_SIZE (64 * 1024)
+
+#define CHUNK_SIZE 4096
+
+typedef struct {
+  rtems_id master;
+  rtems_id id;
+  size_t   index;
+  uint32_t ops;
+} worker_context;
+
+static worker_context workers[WORKER_COUNT];
+
+static uint8_t chunks[WORKER_COUNT][CHUNK_SIZE];
+
+static uint8_t pattern (size_t index, uint32_t iteration, off_t offset)
+{
+  return (uint8_t) (offset + (offset >> 8) + index * 7 + iteration);
+}
+
+static void fill_chunk (uint8_t *chunk, size_t index, uint32_t iteration,
+                        off_t offset)
+{
+  size_t i;
+
+  for (i = 0; i < CHUNK_SIZE; ++i)
+    chunk[i] = pattern (index, iteration, offset + i);
+}
+
+static void check_chunk (const uint8_t *chunk, size_t index,
+                         uint32_t iteration, off_t offset)
+{
+  size_t i;
+
+  for (i = 0; i < CHUNK_SIZE; ++i)
+    rtems_test_assert (chunk[i] == pattern (index, iteration, offset + i));
+}
+
+/*
+ * Each worker writes and reads back its own file and reads the shared file
+ * all the workers read.
+ */
+static void worker (rtems_task_argument arg)
+{
+  worker_context    *ctx = (worker_context *) arg;
+  uint8_t           *chunk = chunks[ctx->index];
+  char               path[32];
+  struct stat        st;
+  uint32_t           iteration;
+  rtems_status_code  sc;
+  int                fd;
+  int                shared;
+  int                rv;
+
+  snprintf (path, sizeof (path), MOUNT_PATH "/w%zu", ctx->index);
+
+  fd = open (path, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert (fd >= 0);
+
+  shared = open (SHARED_PATH, O_RDONLY);
+  rtems_test_assert (shared >= 0);
+
+  for (iteration = 0; iteration < ITERATIONS; ++iteration)
+  {
+    off_t   offset;
+    off_t   pos;
+    ssize_t n;
+
+    pos = lseek (fd, 0, SEEK_SET);
+    rtems_test_assert (pos == 0);
+
+    for (offset = 0; offset < FILE_SIZE; offset += CHUNK_SIZE)
+    {
+      fill_chunk (chunk, ctx->index, iteration, offset);
+      n = write (fd, chunk, CHUNK_SIZE);
+      rtems_test_assert (n == CHUNK_SIZE);
+      ++ctx->ops;
+    }
+
+    pos = lseek (fd, 0, SEEK_SET);
+    rtems_test_assert (pos == 0);
+
+    for (offset = 0; offset < FILE_SIZE; offset += CHUNK_SIZE)
+    {
+      n = read (fd, chunk, CHUNK_SIZE);
+      rtems_test_assert (n == CHUNK_SIZE);
+      check_chunk (chunk, ctx->index, iteration, offset);
+      ++ctx->ops;
+    }
+
+    pos = lseek (shared, 0, SEEK_SET);
+    rtems_test_assert (pos == 0);
+
+    for (offset = 0; offset < FILE_SIZE; offset += CHUNK_SIZE)
+    {
+      n = read (shared, chunk, CHUNK_SIZE);
+      rtems_test_assert (n == CHUNK_SIZE);
+      check_chunk (chunk, WORKER_COUNT, 0, offset);
+      ++ctx->ops;
+    }
+
+    rv = stat (path, &st);
+    rtems_test_assert (rv == 0);
+    rtems_test_assert (st.st_size == FILE_SIZE);
+    ++ctx->ops;
+  }
+
+  rv = close (shared);
+  rtems_test_assert (rv == 0);
+
+  rv = close (fd);
+  rtems_test_assert (rv == 0);
+
+  rv = unlink (path);
+  rtems_test_assert (rv == 0);
+
+  sc = rtems_event_transient_send (ctx->master);
+  rtems_test_assert (sc == RTEMS_SUCCESSFUL);
+
+  rtems_task_exit ();
+}
+
+static void create_shared_file (void)
+{
+  uint8_t *chunk = chunks[0];
+  off_t    offset;
+  int      fd;
+  int      rv;
+
+  fd = open (SHARED_PATH, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert (fd >= 0);
+
+  for (offset = 0; offset < FILE_SIZE; offset += CHUNK_SIZE)
+  {
+    ssize_t n;
+
+    fill_chunk (chunk, WORKER_COUNT, 0, offset);
+    n = write (fd, chunk, CHUNK_SIZE);
+    rtems_test_assert (n == CHUNK_SIZE);
+  }
+
+  rv = close (fd);
+  rtems_test_assert (rv == 0);
+}
+
+static void test_workers (size_t count)
+{
+  uint64_t begin;
+  uint64_t delta;
+  uint64_t ops;
+  size_t   i;
+
+  begin = rtems_clock_get_uptime_nanoseconds ();
+
+  for (i = 0; i < count; ++i)
+  {
+    worker_context    *ctx = &workers[i];
+    rtems_status_code  sc;
+
+    ctx->master = rtems_task_self ();
+    ctx->index = i;
+    ctx->ops = 0;
+
+    sc = rtems_task_create (
+      rtems_build_name ('W', 'R', 'K', '0' + i),
+      2,
+      16 * 1024,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->id
+    );
+    rtems_test_assert (sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start (ctx->id, worker, (rtems_task_argument) ctx);
+    rtems_test_assert (sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < count; ++i)
+  {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_receive (RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert (sc == RTEMS_SUCCESSFUL);
+  }
+
+  delta = rtems_clock_get_uptime_nanoseconds () - begin;
+  if (delta == 0)
+    delta = 1;
+
+  ops = 0;
+
+  for (i = 0; i < count; ++i)
+    ops += workers[i].ops;
+
+  printf (
+    "workers: %zu: %6" PRIu64 " ops, %8" PRIu64 " ops/s\n",
+    count,
+    ops,
+    (ops * 1000000000) / delta
+  );
+}
+
+static void test (void)
+{
+  static const rtems_rfs_format_config config = {
+    .block_size = BLOCK_SIZE
+  };
+  size_t count;
+  int    rv;
+
+  rv = ramdisk_register (BLOCK_SIZE, BLOCK_COUNT, false, DISK_PATH);
+  rtems_test_assert (rv == 0);
+
+  rv = rtems_rfs_format (DISK_PATH, &config);
+  rtems_test_assert (rv == 0);
+
+  rv = mount_and_make_target_path (
+    DISK_PATH,
+    MOUNT_PATH,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert (rv == 0);
+
+  create_shared_file ();
+
+  printf (
+    "processors: %" PRIu32 "\n",
+    rtems_scheduler_get_processor_maximum ()
+  );
+
+  for (count = 1; count <= WORKER_COUNT; ++count)
+    test_workers (count);
+
+  rv = unlink (SHARED_PATH);
+  rtems_test_assert (rv == 0);
+
+  rv = unmount (MOUNT_PATH);
+  rtems_test_assert (rv == 0);
+}
+
+static void Init (rtems_task_argument arg)
+{
+  TEST_BEGIN ();
+
+  test ();
+
+  TEST_END ();
+  rtems_test_exit (0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS (3 + 2 * WORKER_COUNT + 2)
+
+#define CONFIGURE_MAXIMUM_TASKS (2 + WORKER_COUNT)
+
+#define CONFIGURE_MAXIMUM_PROCESSORS 4
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (16 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,340 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/libio.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+
+const char rtems_test_name[] = "FSRFSWRITE 1";
+
+#define DISK_PATH "/dev/rda"
+
+#define MOUNT_PATH "/mnt"
+
+#define BLOCK_SIZE 1024
+
+#define BLOCK_COUNT 2048
+
+#define FILE_SIZE (512 * 1024)
+
+#define CHUNK_MAX (64 * 1024)
+
+static uint8_t chunk[CHUNK_MAX];
+
+static uint8_t pattern (const char *path, off_t offset)
+{
+  return (uint8_t) (offset + (offset >> 8) + (uint8_t) path[strlen (path) - 1]);
+}
+
+static void fill_chunk (const char *path, off_t offset, size_t size)
+{
+  size_t i;
+
+  for (i = 0; i < size; ++i)
+    chunk[i] = pattern (path, offset + i);
+}
+
+static void do_sync (void)
+{
+  int fd;
+  int rv;
+
+  fd = open (MOUNT_PATH, O_RDONLY);
+  rtems_test_assert (fd >= 0);
+  rv = fsync (fd);
+  rtems_test_assert (rv == 0);
+  rv = close (fd);
+  rtems_test_assert (rv == 0);
+}
+
+static void reset_stats (void)
+{
+  int fd;
+  int rv;
+
+  do_sync ();
+
+  fd = open (DISK_PATH, O_RDONLY);
+  rtems_test_assert (fd >= 0);
+  rv = ioctl (fd, RTEMS_BLKIO_RESETDEVSTATS);
+  rtems_test_assert (rv == 0);
+  rv = close (fd);
+  rtems_test_assert (rv == 0);
+}
+
+static void get_stats (rtems_blkdev_stats *stats)
+{
+  int fd;
+  int rv;
+
+  do_sync ();
+
+  fd = open (DISK_PATH, O_RDONLY);
+  rtems_test_assert (fd >= 0);
+  rv = ioctl (fd, RTEMS_BLKIO_GETDEVSTATS, stats);
+  rtems_test_assert (rv == 0);
+  rv = close (fd);
+  rtems_test_assert (rv == 0);
+}
+
+static void check_file (const char *path)
+{
+  off_t offset;
+  int   fd;
+  int   rv;
+
+  fd = open (path, O_RDONLY);
+  rtems_test_assert (fd >= 0);
+
+  for (offset = 0; offset < FILE_SIZE; offset += CHUNK_MAX)
+  {
+    ssize_t n;
+    size_t  i;
+
+    n = read (fd, chunk, CHUNK_MAX);
+    rtems_test_assert (n == CHUNK_MAX);
+
+    for (i = 0; i < CHUNK_MAX; ++i)
+      rtems_test_assert (chunk[i] == pattern (path, offset + i));
+  }
+
+  rv = close (fd);
+  rtems_test_assert (rv == 0);
+}
+
+static void test_sequential_write (const char *path, size_t chunk_size)
+{
+  rtems_blkdev_stats stats;
+  uint64_t           begin;
+  uint64_t           delta;
+  off_t              offset;
+  int                fd;
+  int                rv;
+
+  reset_stats ();
+
+  begin = rtems_clock_get_uptime_nanoseconds ();
+
+  fd = open (path, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert (fd >= 0);
+
+  for (offset = 0; offset < FILE_SIZE; offset += chunk_size)
+  {
+    ssize_t n;
+
+    fill_chunk (path, offset, chunk_size);
+    n = write (fd, chunk, chunk_size);
+    rtems_test_assert (n == (ssize_t) chunk_size);
+  }
+
+  rv = close (fd);
+  rtems_test_assert (rv == 0);
+
+  get_stats (&stats);
+
+  delta = rtems_clock_get_uptime_nanoseconds () - begin;
+  if (delta == 0)
+    delta = 1;
+
+  printf (
+    "write: %5zu byte chunks: %6" PRIu64 " KiB/s, "
+    "%4" PRIu32 " transfers, %4" PRIu32 " blocks\n",
+    chunk_size,
+    ((uint64_t) FILE_SIZE * 1000000000) / (delta * 1024),
+    stats.write_transfers,
+    stats.write_blocks
+  );
+
+  check_file (path);
+
+  rv = unlink (path);
+  rtems_test_assert (rv == 0);
+}
+
+static void test_interleaved_write (void)
+{
+  static const char * const paths[] = { MOUNT_PATH "/a", MOUNT_PATH "/b" };
+  rtems_blkdev_stats        stats;
+  int                       fd[RTEMS_ARRAY_SIZE (paths)];
+  off_t                     offset;
+  size_t                    i;
+  int                       rv;
+
+  reset_stats ();
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE (paths); ++i)
+  {
+    fd[i] = open (paths[i], O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+    rtems_test_assert (fd[i] >= 0);
+  }
+
+  for (offset = 0; offset < FILE_SIZE; offset += 4096)
+  {
+    for (i = 0; i < RTEMS_ARRAY_SIZE (paths); ++i)
+    {
+      ssize_t n;
+
+      fill_chunk (paths[i], offset, 4096);
+      n = write (fd[i], chunk, 4096);
+      rtems_test_assert (n == 4096);
+    }
+  }
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE (paths); ++i)
+  {
+    rv = close (fd[i]);
+    rtems_test_assert (rv == 0);
+  }
+
+  get_stats (&stats);
+
+  printf (
+    "interleaved write: %4" PRIu32 " transfers, %4" PRIu32 " blocks\n",
+    stats.write_transfers,
+    stats.write_blocks
+  );
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE (paths); ++i)
+  {
+    check_file (paths[i]);
+    rv = unlink (paths[i]);
+    rtems_test_assert (rv == 0);
+  }
+}
+
+/*
+ * Blocks are only reserved while a write is processed. A file that is open
+ * holds no more blocks than its data needs.
+ */
+static void test_no_reserve_held (void)
+{
+  static const char path[] = MOUNT_PATH "/r";
+  struct statvfs    before;
+  struct statvfs    after;
+  int               fd;
+  int               i;
+  int               rv;
+
+  fd = open (path, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert (fd >= 0);
+
+  rv = statvfs (MOUNT_PATH, &before);
+  rtems_test_assert (rv == 0);
+
+  /*
+   * Stay within the blocks held in the inode so no indirect blocks are used.
+   */
+  for (i = 1; i <= 4; ++i)
+  {
+    ssize_t n;
+
+    fill_chunk (path, (i - 1) * BLOCK_SIZE, BLOCK_SIZE);
+    n = write (fd, chunk, BLOCK_SIZE);
+    rtems_test_assert (n == BLOCK_SIZE);
+
+    rv = statvfs (MOUNT_PATH, &after);
+    rtems_test_assert (rv == 0);
+    rtems_test_assert (before.f_bfree - after.f_bfree == (fsblkcnt_t) i);
+  }
+
+  rv = close (fd);
+  rtems_test_assert (rv == 0);
+
+  rv = unlink (path);
+  rtems_test_assert (rv == 0);
+}
+
+static void test (void)
+{
+  static const rtems_rfs_format_config config = {
+    .block_size = BLOCK_SIZE
+  };
+  struct statvfs before;
+  struct statvfs after;
+  int            rv;
+
+  rv = ramdisk_register (BLOCK_SIZE, BLOCK_COUNT, false, DISK_PATH);
+  rtems_test_assert (rv == 0);
+
+  rv = rtems_rfs_format (DISK_PATH, &config);
+  rtems_test_assert (rv == 0);
+
+  rv = mount_and_make_target_path (
+    DISK_PATH,
+    MOUNT_PATH,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert (rv == 0);
+
+  rv = statvfs (MOUNT_PATH, &before);
+  rtems_test_assert (rv == 0);
+
+  test_sequential_write (MOUNT_PATH "/s", 512);
+  test_sequential_write (MOUNT_PATH "/s", 4096);
+  test_sequential_write (MOUNT_PATH "/s", CHUNK_MAX);
+  test_interleaved_write ();
+  test_no_reserve_held ();
+
+  /*
+   * The blocks reserved while the files were written have been released.
+   */
+  rv = statvfs (MOUNT_PATH, &after);
+  rtems_test_assert (rv == 0);
+  rtems_test_assert (before.f_bfree == after.f_bfree);
+
+  rv = unmount (MOUNT_PATH);
+  rtems_test_assert (rv == 0);
+}
+
+static void Init (rtems_task_argument arg)
+{
+  TEST_BEGIN ();
+
+  test ();
+
+  TEST_END ();
+  rtems_test_exit (0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (16 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
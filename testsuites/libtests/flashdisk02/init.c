@@ -0,0 +1,520 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/ioctl.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/counter.h>
+#include <rtems/flashdisk.h>
+
+const char rtems_test_name[] = "FLASHDISK 2";
+
+#define FLASHDISK_CONFIG_COUNT 3
+
+#define FLASHDISK_DEVICE_COUNT 2
+
+#define FLASHDISK_SEGMENT_COUNT 16U
+
+#define FLASHDISK_SEGMENT_SIZE (4 * 1024)
+
+#define FLASHDISK_BLOCK_SIZE 512U
+
+#define FLASHDISK_BLOCKS_PER_SEGMENT \
+  (FLASHDISK_SEGMENT_SIZE / FLASHDISK_BLOCK_SIZE - 1)
+
+#define FLASHDISK_DEVICE_SIZE \
+  (FLASHDISK_SEGMENT_COUNT * FLASHDISK_SEGMENT_SIZE)
+
+#define FLASHDISK_TOTAL_SEGMENTS \
+  (FLASHDISK_DEVICE_COUNT * FLASHDISK_SEGMENT_COUNT)
+
+#define WEAR_LEVEL_THRESHOLD 8
+
+#define TASK_PRIORITY 5
+
+/* Busy programming time of the flash per write call */
+#define PROGRAM_DELAY_NS 20000
+
+/* Blocks written once at the start and never again */
+#define COLD_BLOCKS 160
+
+/* Blocks written over and over again */
+#define HOT_BLOCKS 16
+
+#define HOT_ROUNDS 200
+
+static uint8_t flashdisk_data [FLASHDISK_DEVICE_COUNT]
+  [FLASHDISK_CONFIG_COUNT * FLASHDISK_DEVICE_SIZE];
+
+static const char * const names [FLASHDISK_CONFIG_COUNT] = {
+  "foreground",
+  "wear-level",
+  "background"
+};
+
+static const char * const devices [FLASHDISK_CONFIG_COUNT] = {
+  "/dev/fdda",
+  "/dev/fddb",
+  "/dev/fddc"
+};
+
+static uint8_t block_buffer [FLASHDISK_BLOCK_SIZE];
+
+static rtems_blkdev_request *request;
+
+static void request_done(rtems_blkdev_request *req, rtems_status_code status)
+{
+  rtems_status_code *sc = req->done_arg;
+
+  *sc = status;
+}
+
+static void do_request(
+  rtems_disk_device *dd,
+  rtems_blkdev_request_op op,
+  rtems_blkdev_bnum block
+)
+{
+  rtems_status_code sc;
+  int rv;
+
+  sc = RTEMS_NOT_IMPLEMENTED;
+  request->req = op;
+  request->done = request_done;
+  request->done_arg = &sc;
+  request->bufnum = 1;
+  request->bufs[0].block = block;
+  request->bufs[0].length = FLASHDISK_BLOCK_SIZE;
+  request->bufs[0].buffer = &block_buffer[0];
+
+  rv = (*dd->ioctl)(dd, RTEMS_BLKIO_REQUEST, request);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void fill_block(uint8_t *buf, rtems_blkdev_bnum block, uint32_t round)
+{
+  size_t i;
+
+  for (i = 0; i < FLASHDISK_BLOCK_SIZE; ++i) {
+    buf[i] = (uint8_t) (block + round + i);
+  }
+}
+
+static uint64_t write_blocks(
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum begin,
+  rtems_blkdev_bnum end,
+  uint32_t round
+)
+{
+  uint64_t delta = 0;
+  rtems_blkdev_bnum block;
+
+  for (block = begin; block < end; ++block) {
+    uint64_t t;
+
+    fill_block(&block_buffer[0], block, round);
+
+    t = rtems_clock_get_uptime_nanoseconds();
+    do_request(dd, RTEMS_BLKDEV_REQ_WRITE, block);
+    delta += rtems_clock_get_uptime_nanoseconds() - t;
+  }
+
+  return delta;
+}
+
+static void check_blocks(
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum begin,
+  rtems_blkdev_bnum end,
+  uint32_t round
+)
+{
+  uint8_t expected [FLASHDISK_BLOCK_SIZE];
+  rtems_blkdev_bnum block;
+
+  for (block = begin; block < end; ++block) {
+    do_request(dd, RTEMS_BLKDEV_REQ_READ, block);
+    fill_block(&expected[0], block, round);
+    rtems_test_assert(
+      memcmp(&block_buffer[0], &expected[0], FLASHDISK_BLOCK_SIZE) == 0
+    );
+  }
+}
+
+static uint64_t throughput(uint64_t bytes, uint64_t ns)
+{
+  if (ns == 0) {
+    ns = 1;
+  }
+
+  return (bytes * 1000000000) / (ns * 1024);
+}
+
+static uint32_t test_disk(size_t config)
+{
+  rtems_disk_device *dd;
+  rtems_fdisk_monitor_data data;
+  rtems_fdisk_erase_counts counts;
+  uint32_t erase_counts [FLASHDISK_TOTAL_SEGMENTS];
+  uint64_t ns;
+  uint32_t round;
+  uint32_t i;
+  int fd;
+  int rv;
+
+  fd = open(devices[config], O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  write_blocks(dd, 0, COLD_BLOCKS, 0);
+
+  ns = 0;
+  for (round = 1; round <= HOT_ROUNDS; ++round) {
+    ns += write_blocks(dd, COLD_BLOCKS, COLD_BLOCKS + HOT_BLOCKS, round);
+  }
+
+  check_blocks(dd, 0, COLD_BLOCKS, 0);
+  check_blocks(dd, COLD_BLOCKS, COLD_BLOCKS + HOT_BLOCKS, HOT_ROUNDS);
+
+  rv = ioctl(fd, RTEMS_FDISK_IOCTL_MONITORING, &data);
+  rtems_test_assert(rv == 0);
+
+  counts.segment_count = FLASHDISK_TOTAL_SEGMENTS;
+  counts.erase_counts = &erase_counts[0];
+  rv = ioctl(fd, RTEMS_FDISK_IOCTL_ERASE_COUNTS, &counts);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(counts.segment_count == FLASHDISK_TOTAL_SEGMENTS);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  printf(
+    "%-10s: write %5" PRIu64 " KiB/s, erases %4" PRIu32
+    " (min %3" PRIu32 ", max %3" PRIu32 "), wear level moves %3" PRIu32 "\n",
+    names[config],
+    throughput(
+      (uint64_t) HOT_ROUNDS * HOT_BLOCKS * FLASHDISK_BLOCK_SIZE,
+      ns
+    ),
+    data.seg_erases,
+    data.seg_erases_min,
+    data.seg_erases_max,
+    data.wear_level_moves
+  );
+
+  for (i = 0; i < FLASHDISK_TOTAL_SEGMENTS; ++i) {
+    if (i % FLASHDISK_SEGMENT_COUNT == 0) {
+      printf("  device %" PRIu32 ":", i / FLASHDISK_SEGMENT_COUNT);
+    }
+
+    printf(" %3" PRIu32, erase_counts[i]);
+
+    if (i % FLASHDISK_SEGMENT_COUNT == FLASHDISK_SEGMENT_COUNT - 1) {
+      printf("\n");
+    }
+  }
+
+  return data.seg_erases_max - data.seg_erases_min;
+}
+
+static void Init(rtems_task_argument arg)
+{
+  uint32_t spread [FLASHDISK_CONFIG_COUNT];
+  size_t i;
+
+  (void) arg;
+  TEST_BEGIN();
+
+  request = calloc(1, sizeof(*request) + sizeof(request->bufs[0]));
+  rtems_test_assert(request != NULL);
+
+  for (i = 0; i < FLASHDISK_CONFIG_COUNT; ++i) {
+    spread[i] = test_disk(i);
+  }
+
+  free(request);
+
+  /* The static wear leveling moves the cold blocks */
+  rtems_test_assert(spread[1] < spread[0]);
+  rtems_test_assert(spread[2] < spread[0]);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+/*
+ * The device the driver erases a segment of.  The flash disk shall not call
+ * the driver for this device until the erase is done.
+ */
+static uint32_t erasing_device = UINT32_MAX;
+
+static void check_not_erasing(uint32_t device)
+{
+  rtems_test_assert(device != erasing_device);
+}
+
+static void erase_device(uint32_t device, uint32_t offset)
+{
+  memset(&flashdisk_data[device][offset], 0xff, FLASHDISK_DEVICE_SIZE);
+}
+
+static rtems_device_driver flashdisk_initialize(
+  rtems_device_major_number major,
+  rtems_device_minor_number minor,
+  void *arg
+)
+{
+  uint32_t device;
+
+  for (device = 0; device < FLASHDISK_DEVICE_COUNT; ++device) {
+    memset(&flashdisk_data[device][0], 0xff, sizeof(flashdisk_data[device]));
+  }
+
+  return rtems_fdisk_initialize(major, minor, arg);
+}
+
+/*
+ * Each flash disk configuration uses its own part of the devices which starts
+ * at the offset of its segment descriptor.
+ */
+static uint8_t *get_data_pointer(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset
+)
+{
+  offset += sd->offset + (segment - sd->segment) * sd->size;
+
+  return &flashdisk_data[device][offset];
+}
+
+static int flashdisk_read(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  void *buffer,
+  uint32_t size
+)
+{
+  const uint8_t *data = get_data_pointer(sd, device, segment, offset);
+
+  check_not_erasing(device);
+  memcpy(buffer, data, size);
+
+  return 0;
+}
+
+static int flashdisk_write(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  const void *buffer,
+  uint32_t size
+)
+{
+  uint8_t *data = get_data_pointer(sd, device, segment, offset);
+
+  check_not_erasing(device);
+  memcpy(data, buffer, size);
+  rtems_counter_delay_nanoseconds(PROGRAM_DELAY_NS);
+
+  return 0;
+}
+
+static int flashdisk_blank(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  uint32_t size
+)
+{
+  const uint8_t *current = get_data_pointer(sd, device, segment, offset);
+  const uint8_t *end = current + size;
+
+  check_not_erasing(device);
+
+  while (current != end) {
+    if (*current != 0xff) {
+      return EIO;
+    }
+    ++current;
+  }
+
+  return 0;
+}
+
+static int flashdisk_verify(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  const void *buffer,
+  uint32_t size
+)
+{
+  const uint8_t *data = get_data_pointer(sd, device, segment, offset);
+
+  check_not_erasing(device);
+
+  if (memcmp(data, buffer, size) != 0) {
+    return EIO;
+  }
+
+  return 0;
+}
+
+/*
+ * The erase blocks for one clock tick, so that other tasks may use the
+ * processor and the other device in the meantime.
+ */
+static int flashdisk_erase(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment
+)
+{
+  uint8_t *data = get_data_pointer(sd, device, segment, 0);
+
+  check_not_erasing(device);
+  erasing_device = device;
+  memset(data, 0xff, sd->size);
+  rtems_task_wake_after(1);
+  erasing_device = UINT32_MAX;
+
+  return 0;
+}
+
+static int flashdisk_erase_device(
+  const rtems_fdisk_device_desc *dd,
+  uint32_t device
+)
+{
+  erase_device(device, dd->segments[0].offset);
+
+  return 0;
+}
+
+static const rtems_fdisk_driver_handlers flashdisk_ops = {
+  .read = flashdisk_read,
+  .write = flashdisk_write,
+  .blank = flashdisk_blank,
+  .verify = flashdisk_verify,
+  .erase = flashdisk_erase,
+  .erase_device = flashdisk_erase_device
+};
+
+static const rtems_fdisk_segment_desc
+flashdisk_segment_desc [FLASHDISK_CONFIG_COUNT] = {
+  {
+    .count = FLASHDISK_SEGMENT_COUNT,
+    .segment = 0,
+    .offset = 0 * FLASHDISK_DEVICE_SIZE,
+    .size = FLASHDISK_SEGMENT_SIZE
+  }, {
+    .count = FLASHDISK_SEGMENT_COUNT,
+    .segment = 0,
+    .offset = 1 * FLASHDISK_DEVICE_SIZE,
+    .size = FLASHDISK_SEGMENT_SIZE
+  }, {
+    .count = FLASHDISK_SEGMENT_COUNT,
+    .segment = 0,
+    .offset = 2 * FLASHDISK_DEVICE_SIZE,
+    .size = FLASHDISK_SEGMENT_SIZE
+  }
+};
+
+#define FLASHDISK_DEVICE(config) \
+  { \
+    .segment_count = 1, \
+    .segments = &flashdisk_segment_desc[config], \
+    .flash_ops = &flashdisk_ops \
+  }
+
+static const rtems_fdisk_device_desc
+flashdisk_devices [FLASHDISK_CONFIG_COUNT][FLASHDISK_DEVICE_COUNT] = {
+  { FLASHDISK_DEVICE(0), FLASHDISK_DEVICE(0) },
+  { FLASHDISK_DEVICE(1), FLASHDISK_DEVICE(1) },
+  { FLASHDISK_DEVICE(2), FLASHDISK_DEVICE(2) }
+};
+
+const rtems_flashdisk_config
+rtems_flashdisk_configuration [FLASHDISK_CONFIG_COUNT] = {
+  {
+    .block_size = FLASHDISK_BLOCK_SIZE,
+    .device_count = FLASHDISK_DEVICE_COUNT,
+    .devices = &flashdisk_devices[0][0],
+    .unavail_blocks = 3 * FLASHDISK_BLOCKS_PER_SEGMENT,
+    .compact_segs = 4,
+    .avail_compact_segs = 2
+  }, {
+    .block_size = FLASHDISK_BLOCK_SIZE,
+    .device_count = FLASHDISK_DEVICE_COUNT,
+    .devices = &flashdisk_devices[1][0],
+    .unavail_blocks = 3 * FLASHDISK_BLOCKS_PER_SEGMENT,
+    .compact_segs = 4,
+    .avail_compact_segs = 2,
+    .wear_level_threshold = WEAR_LEVEL_THRESHOLD
+  }, {
+    .block_size = FLASHDISK_BLOCK_SIZE,
+    .device_count = FLASHDISK_DEVICE_COUNT,
+    .devices = &flashdisk_devices[2][0],
+    .flags = RTEMS_FDISK_BACKGROUND_ERASE | RTEMS_FDISK_BACKGROUND_COMPACT,
+    .unavail_blocks = 3 * FLASHDISK_BLOCKS_PER_SEGMENT,
+    .compact_segs = 4,
+    .avail_compact_segs = 2,
+    .wear_level_threshold = WEAR_LEVEL_THRESHOLD,
+    .task_priority = TASK_PRIORITY
+  }
+};
+
+uint32_t rtems_flashdisk_configuration_size = FLASHDISK_CONFIG_COUNT;
+
+#define FLASHDISK_DRIVER { .initialization_entry = flashdisk_initialize }
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS FLASHDISK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 1000
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_PRIORITY 10
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (16 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,283 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/cpuuse.h>
+#include <rtems/printer.h>
+#include <rtems/record.h>
+#include <rtems/shellconfig.h>
+#include <rtems/score/schedulerlatency.h>
+#include <rtems/score/threadimpl.h>
+
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "LATENCY 1";
+
+#define WORKER_PRIORITY 2
+
+#define INIT_PRIORITY 3
+
+#define WAKEUP_COUNT 10
+
+typedef struct {
+  rtems_id worker_id;
+  Thread_Control *worker;
+  uint32_t worker_wakeups;
+  size_t schedule_latency_items;
+  size_t dispatch_latency_items;
+} test_context;
+
+static test_context test_instance;
+
+static uint32_t histogram_count(const Scheduler_Latency_histogram *histogram)
+{
+  uint32_t count = 0;
+  size_t i;
+
+  for (i = 0; i < SCHEDULER_LATENCY_BUCKETS; ++i) {
+    count += histogram->buckets[i];
+  }
+
+  return count;
+}
+
+static uint32_t worker_count(const test_context *ctx)
+{
+  return histogram_count(&ctx->worker->Latency.Histogram);
+}
+
+static uint32_t priority_count(void)
+{
+  return histogram_count(&_Scheduler_Latency_priorities[WORKER_PRIORITY]);
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  ctx->worker = _Thread_Get_executing();
+
+  while (true) {
+    rtems_status_code sc;
+    rtems_event_set events;
+
+    sc = rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ++ctx->worker_wakeups;
+  }
+}
+
+static void drain_visitor(
+  const rtems_record_item *items,
+  size_t count,
+  void *arg
+)
+{
+  test_context *ctx = arg;
+  size_t i;
+
+  for (i = 0; i < count; ++i) {
+    switch (RTEMS_RECORD_GET_EVENT(items[i].event)) {
+      case RTEMS_RECORD_THREAD_SCHEDULE_LATENCY:
+        ++ctx->schedule_latency_items;
+        break;
+      case RTEMS_RECORD_THREAD_DISPATCH_LATENCY:
+        ++ctx->dispatch_latency_items;
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+static void drain(test_context *ctx)
+{
+  ctx->schedule_latency_items = 0;
+  ctx->dispatch_latency_items = 0;
+  rtems_record_drain(drain_visitor, ctx);
+}
+
+static void wake_up_worker(test_context *ctx)
+{
+  rtems_status_code sc;
+  uint32_t wakeups = ctx->worker_wakeups;
+
+  sc = rtems_event_send(ctx->worker_id, RTEMS_EVENT_0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The worker has a higher priority and preempts us */
+  rtems_test_assert(ctx->worker_wakeups == wakeups + 1);
+}
+
+static int shell_latency(char *arg)
+{
+  char name[] = "latency";
+  char *argv[] = { name, arg, NULL };
+  int argc = arg != NULL ? 2 : 1;
+
+  return (*rtems_shell_LATENCY_Command.command)(argc, argv);
+}
+
+static void test_record_version(void)
+{
+  Record_Stream_header header;
+
+  rtems_test_assert(RTEMS_RECORD_THE_VERSION == 10);
+
+  (void) _Record_Stream_header_initialize(&header);
+  rtems_test_assert(
+    RTEMS_RECORD_GET_EVENT(header.Version.event) == RTEMS_RECORD_VERSION
+  );
+  rtems_test_assert(header.Version.data == RTEMS_RECORD_THE_VERSION);
+
+  rtems_test_assert(
+    strcmp(
+      rtems_record_event_text(RTEMS_RECORD_THREAD_SCHEDULE_LATENCY),
+      "THREAD_SCHEDULE_LATENCY"
+    ) == 0
+  );
+  rtems_test_assert(
+    strcmp(
+      rtems_record_event_text(RTEMS_RECORD_THREAD_DISPATCH_LATENCY),
+      "THREAD_DISPATCH_LATENCY"
+    ) == 0
+  );
+}
+
+static void test_histograms(test_context *ctx)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    WORKER_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->worker_id, worker_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->worker != NULL);
+
+  rtems_cpu_usage_latency_reset();
+  rtems_test_assert(worker_count(ctx) == 0);
+  rtems_test_assert(priority_count() == 0);
+  drain(ctx);
+
+  for (i = 0; i < WAKEUP_COUNT; ++i) {
+    wake_up_worker(ctx);
+    rtems_test_assert(worker_count(ctx) == i + 1);
+    rtems_test_assert(priority_count() == i + 1);
+    rtems_test_assert(!ctx->worker->Latency.is_pending);
+  }
+
+  drain(ctx);
+  rtems_test_assert(ctx->schedule_latency_items >= WAKEUP_COUNT);
+  rtems_test_assert(ctx->dispatch_latency_items >= WAKEUP_COUNT);
+}
+
+static void test_report(test_context *ctx)
+{
+  rtems_printer printer;
+
+  rtems_print_printer_printf(&printer);
+  rtems_cpu_usage_latency_report(&printer);
+
+  rtems_cpu_usage_latency_reset();
+  rtems_test_assert(worker_count(ctx) == 0);
+  rtems_test_assert(priority_count() == 0);
+
+  wake_up_worker(ctx);
+  rtems_test_assert(worker_count(ctx) == 1);
+  rtems_test_assert(priority_count() == 1);
+}
+
+static void test_shell_command(test_context *ctx)
+{
+  char reset[] = "-r";
+  char invalid[] = "-x";
+
+  rtems_test_assert(worker_count(ctx) != 0);
+
+  rtems_test_assert(shell_latency(NULL) == 0);
+  rtems_test_assert(shell_latency(invalid) == -1);
+  rtems_test_assert(worker_count(ctx) != 0);
+
+  rtems_test_assert(shell_latency(reset) == 0);
+  rtems_test_assert(worker_count(ctx) == 0);
+  rtems_test_assert(priority_count() == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  test_record_version();
+  test_histograms(ctx);
+  test_report(ctx);
+  test_shell_command(ctx);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_PRIORITY INIT_PRIORITY
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS 512
+
+#define CONFIGURE_RECORD_EXTENSIONS_ENABLED
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
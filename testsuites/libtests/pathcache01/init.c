@@ -0,0 +1,310 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <rtems/libio_.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+
+const char rtems_test_name[] = "PATHCACHE 1";
+
+#define ITERATIONS 10000
+
+#define IMFS_BASE "/imfs"
+
+#define RFS_BASE "/rfs"
+
+#define DISK_PATH "/dev/rda"
+
+#define BLOCK_SIZE 1024
+
+#define BLOCK_COUNT 1024
+
+#define PATH_MAX_SIZE 64
+
+/* Directories with some entries to search in front of the path components */
+static const char * const dirs[] = {
+  "/data",
+  "/data/log",
+  "/data/log/a",
+  "/data/log/a/b",
+  "/data/log/a/b/c",
+  "/data/log/a/b/c/d",
+  "/data/log/a/b/c/d/e"
+};
+
+#define DEEP_DIR "/data/log/a/b/c/d/e"
+
+#define FILLER_COUNT 16
+
+typedef struct {
+  char file[PATH_MAX_SIZE];
+  char missing[PATH_MAX_SIZE];
+} test_paths;
+
+static void create_file(const char *path)
+{
+  int fd;
+  int rv;
+
+  fd = open(path, O_WRONLY | O_CREAT | O_EXCL, 0644);
+  rtems_test_assert(fd >= 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void create_tree(const char *base, test_paths *paths)
+{
+  char path[PATH_MAX_SIZE];
+  size_t i;
+  int j;
+  int rv;
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(dirs); ++i) {
+    for (j = 0; j < FILLER_COUNT; ++j) {
+      snprintf(path, sizeof(path), "%s%s/filler%02i", base,
+        i > 0 ? dirs[i - 1] : "", j);
+      create_file(path);
+    }
+
+    snprintf(path, sizeof(path), "%s%s", base, dirs[i]);
+    rv = mkdir(path, S_IRWXU);
+    rtems_test_assert(rv == 0);
+  }
+
+  snprintf(paths->file, sizeof(paths->file), "%s" DEEP_DIR "/current", base);
+  snprintf(
+    paths->missing,
+    sizeof(paths->missing),
+    "%s" DEEP_DIR "/missing",
+    base
+  );
+  create_file(paths->file);
+}
+
+static void assert_exists(const char *path, bool exists)
+{
+  struct stat st;
+  int rv;
+
+  errno = 0;
+  rv = stat(path, &st);
+
+  if (exists) {
+    rtems_test_assert(rv == 0);
+  } else {
+    rtems_test_assert(rv == -1);
+    rtems_test_assert(errno == ENOENT);
+  }
+}
+
+static void test_invalidation(const test_paths *paths)
+{
+  int rv;
+
+  /* Enter the negative entry and make sure that it is used */
+  assert_exists(paths->missing, false);
+  assert_exists(paths->missing, false);
+
+  create_file(paths->missing);
+  assert_exists(paths->missing, true);
+
+  rv = unlink(paths->missing);
+  rtems_test_assert(rv == 0);
+  assert_exists(paths->missing, false);
+
+  rv = rename(paths->file, paths->missing);
+  rtems_test_assert(rv == 0);
+  assert_exists(paths->file, false);
+  assert_exists(paths->missing, true);
+
+  rv = link(paths->missing, paths->file);
+  rtems_test_assert(rv == 0);
+  assert_exists(paths->file, true);
+
+  rv = unlink(paths->missing);
+  rtems_test_assert(rv == 0);
+  assert_exists(paths->missing, false);
+
+  rv = symlink("current", paths->missing);
+  rtems_test_assert(rv == 0);
+  assert_exists(paths->missing, true);
+
+  rv = unlink(paths->missing);
+  rtems_test_assert(rv == 0);
+  assert_exists(paths->missing, false);
+
+  rv = mkdir(paths->missing, S_IRWXU);
+  rtems_test_assert(rv == 0);
+  assert_exists(paths->missing, true);
+
+  rv = rmdir(paths->missing);
+  rtems_test_assert(rv == 0);
+  assert_exists(paths->missing, false);
+}
+
+static uint64_t measure(const char *path, bool exists)
+{
+  uint64_t begin;
+  int i;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < ITERATIONS; ++i) {
+    struct stat st;
+    int rv;
+
+    rv = stat(path, &st);
+    rtems_test_assert((rv == 0) == exists);
+  }
+
+  return (rtems_clock_get_uptime_nanoseconds() - begin) / ITERATIONS;
+}
+
+static rtems_filesystem_mount_table_entry_t *get_mt_entry(const char *base)
+{
+  rtems_filesystem_mount_table_entry_t *mt_entry;
+  int fd;
+  int rv;
+
+  fd = open(base, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  mt_entry = rtems_libio_iop(fd)->pathinfo.mt_entry;
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  return mt_entry;
+}
+
+static void test_latency(
+  const char *name,
+  const char *base,
+  const test_paths *paths
+)
+{
+  rtems_filesystem_mount_table_entry_t *mt_entry;
+  rtems_filesystem_eval_path_cache *cache;
+  uint64_t uncached_hit;
+  uint64_t uncached_miss;
+  uint64_t cached_hit;
+  uint64_t cached_miss;
+
+  mt_entry = get_mt_entry(base);
+  cache = mt_entry->eval_path_cache;
+  rtems_test_assert(cache != NULL);
+
+  /* Disable the cache to get the latency without it */
+  mt_entry->eval_path_cache = NULL;
+  uncached_hit = measure(paths->file, true);
+  uncached_miss = measure(paths->missing, false);
+  mt_entry->eval_path_cache = cache;
+
+  cached_hit = measure(paths->file, true);
+  cached_miss = measure(paths->missing, false);
+
+  printf(
+    "%-4s stat existing: %6" PRIu64 " ns without cache, %6" PRIu64
+      " ns with cache\n",
+    name,
+    uncached_hit,
+    cached_hit
+  );
+  printf(
+    "%-4s stat missing : %6" PRIu64 " ns without cache, %6" PRIu64
+      " ns with cache\n",
+    name,
+    uncached_miss,
+    cached_miss
+  );
+}
+
+static void test_file_system(const char *name, const char *base)
+{
+  test_paths paths;
+
+  create_tree(base, &paths);
+  test_invalidation(&paths);
+  test_latency(name, base, &paths);
+}
+
+static void mount_rfs(void)
+{
+  static const rtems_rfs_format_config config = {
+    .block_size = BLOCK_SIZE,
+    .inode_overhead = 20
+  };
+  int rv;
+
+  rv = ramdisk_register(BLOCK_SIZE, BLOCK_COUNT, false, DISK_PATH);
+  rtems_test_assert(rv == 0);
+
+  rv = rtems_rfs_format(DISK_PATH, &config);
+  rtems_test_assert(rv == 0);
+
+  rv = mount_and_make_target_path(
+    DISK_PATH,
+    RFS_BASE,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  int rv;
+
+  (void) arg;
+  TEST_BEGIN();
+
+  rv = mkdir(IMFS_BASE, S_IRWXU);
+  rtems_test_assert(rv == 0);
+  test_file_system("IMFS", IMFS_BASE);
+
+  mount_rfs();
+  test_file_system("RFS", RFS_BASE);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (16 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
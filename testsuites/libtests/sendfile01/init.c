@@ -0,0 +1,398 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/dosfs.h>
+#include <rtems/imfs.h>
+#include <rtems/libio.h>
+#include <rtems/ramdisk.h>
+
+const char rtems_test_name[] = "SENDFILE 1";
+
+#define FILE_SIZE (256 * 1024)
+
+#define CHUNK_SIZE 4096
+
+static const char linfile[] = "/linfile";
+
+static const char memfile[] = "/memfile";
+
+static const char dosfile[] = "/mnt/file";
+
+static const char blkdev[] = "/dev/rdb";
+
+static unsigned char data[FILE_SIZE];
+
+static unsigned char buf[FILE_SIZE];
+
+static void check_file(const char *path, off_t size)
+{
+  int fd;
+  ssize_t n;
+  int rv;
+
+  memset(buf, 0, sizeof(buf));
+
+  fd = open(path, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  n = read(fd, buf, sizeof(buf));
+  rtems_test_assert(n == size);
+  rtems_test_assert(memcmp(buf, data, (size_t) size) == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void create_files(void)
+{
+  size_t i;
+  int fd;
+  ssize_t n;
+  int rv;
+
+  for (i = 0; i < sizeof(data); ++i) {
+    data[i] = (unsigned char) (i * 7 + (i >> 8));
+  }
+
+  rv = IMFS_make_linearfile(linfile, S_IRWXU, data, sizeof(data));
+  rtems_test_assert(rv == 0);
+
+  fd = open(memfile, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  n = write(fd, data, sizeof(data));
+  rtems_test_assert(n == (ssize_t) sizeof(data));
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void fill_blkdev(void)
+{
+  int fd;
+  ssize_t n;
+  int rv;
+
+  fd = open(blkdev, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  n = write(fd, data, sizeof(data));
+  rtems_test_assert(n == (ssize_t) sizeof(data));
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void mount_dosfs(void)
+{
+  static const msdos_format_request_param_t rqdata = {
+    .quick_format = true,
+    .sync_device = true
+  };
+
+  int rv;
+
+  rv = msdos_format("/dev/rda", &rqdata);
+  rtems_test_assert(rv == 0);
+
+  rv = mount_and_make_target_path(
+    "/dev/rda",
+    "/mnt",
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void test_errors(void)
+{
+  int in;
+  int out;
+  off_t offset;
+  ssize_t n;
+  int rv;
+
+  in = open(linfile, O_RDONLY);
+  rtems_test_assert(in >= 0);
+
+  out = open(memfile, O_RDONLY);
+  rtems_test_assert(out >= 0);
+
+  errno = 0;
+  n = rtems_sendfile(out, in, NULL, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EBADF);
+
+  errno = 0;
+  n = rtems_sendfile(in, -1, NULL, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EBADF);
+
+  offset = -1;
+  errno = 0;
+  n = rtems_sendfile(out, in, &offset, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  rv = close(out);
+  rtems_test_assert(rv == 0);
+
+  rv = close(in);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_offset(const char *path)
+{
+  int in;
+  int out;
+  off_t offset;
+  off_t pos;
+  ssize_t n;
+  int rv;
+
+  in = open(path, O_RDONLY);
+  rtems_test_assert(in >= 0);
+
+  out = open(dosfile, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(out >= 0);
+
+  /* The file offset of the input moves without an explicit offset */
+  n = rtems_sendfile(out, in, NULL, 1000);
+  rtems_test_assert(n == 1000);
+
+  pos = lseek(in, 0, SEEK_CUR);
+  rtems_test_assert(pos == 1000);
+
+  /* An explicit offset is updated and leaves the file offset alone */
+  offset = 1000;
+  n = rtems_sendfile(out, in, &offset, 3000);
+  rtems_test_assert(n == 3000);
+  rtems_test_assert(offset == 4000);
+
+  pos = lseek(in, 0, SEEK_CUR);
+  rtems_test_assert(pos == 1000);
+
+  /* Nothing is transferred at the end of file */
+  offset = FILE_SIZE;
+  n = rtems_sendfile(out, in, &offset, 1);
+  rtems_test_assert(n == 0);
+  rtems_test_assert(offset == FILE_SIZE);
+
+  rv = close(out);
+  rtems_test_assert(rv == 0);
+
+  rv = close(in);
+  rtems_test_assert(rv == 0);
+
+  check_file(dosfile, 4000);
+}
+
+static void test_blkdev(void)
+{
+  int in;
+  int out;
+  off_t offset;
+  off_t pos;
+  ssize_t n;
+  int rv;
+
+  in = open(blkdev, O_RDONLY);
+  rtems_test_assert(in >= 0);
+
+  out = open(dosfile, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(out >= 0);
+
+  /* Start and end within a block */
+  n = rtems_sendfile(out, in, NULL, 100);
+  rtems_test_assert(n == 100);
+
+  offset = 100;
+  n = rtems_sendfile(out, in, &offset, FILE_SIZE - 200);
+  rtems_test_assert(n == FILE_SIZE - 200);
+  rtems_test_assert(offset == FILE_SIZE - 100);
+
+  pos = lseek(in, 0, SEEK_CUR);
+  rtems_test_assert(pos == 100);
+
+  pos = lseek(in, offset, SEEK_SET);
+  rtems_test_assert(pos == FILE_SIZE - 100);
+
+  n = rtems_sendfile(out, in, NULL, 100);
+  rtems_test_assert(n == 100);
+
+  rv = close(out);
+  rtems_test_assert(rv == 0);
+
+  rv = close(in);
+  rtems_test_assert(rv == 0);
+
+  check_file(dosfile, FILE_SIZE);
+}
+
+static uint64_t throughput(uint64_t bytes, uint64_t ns)
+{
+  if (ns == 0) {
+    ns = 1;
+  }
+
+  return (bytes * 1000000000) / (ns * 1024);
+}
+
+static ssize_t copy_read_write(int out, int in)
+{
+  static unsigned char chunk[CHUNK_SIZE];
+  ssize_t total;
+  ssize_t n;
+
+  total = 0;
+
+  while ((n = read(in, chunk, sizeof(chunk))) > 0) {
+    ssize_t m;
+
+    m = write(out, chunk, (size_t) n);
+    rtems_test_assert(m == n);
+    total += n;
+  }
+
+  rtems_test_assert(n == 0);
+  return total;
+}
+
+static ssize_t copy_sendfile(int out, int in)
+{
+  ssize_t total;
+  ssize_t n;
+
+  total = 0;
+
+  while ((n = rtems_sendfile(out, in, NULL, FILE_SIZE)) > 0) {
+    total += n;
+  }
+
+  rtems_test_assert(n == 0);
+  return total;
+}
+
+typedef struct {
+  const char *name;
+  const char *from;
+  const char *to;
+  ssize_t (*copy)(int out, int in);
+} copy_method;
+
+static const copy_method methods[] = {
+  { "rw-linear", linfile, dosfile, copy_read_write },
+  { "sf-linear", linfile, dosfile, copy_sendfile },
+  { "rw-memory", memfile, dosfile, copy_read_write },
+  { "sf-memory", memfile, dosfile, copy_sendfile },
+  { "rw-dosfs", dosfile, memfile, copy_read_write },
+  { "sf-dosfs", dosfile, memfile, copy_sendfile }
+};
+
+static void test_throughput(void)
+{
+  size_t i;
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(methods); ++i) {
+    const copy_method *method = &methods[i];
+    int in;
+    int out;
+    uint64_t begin;
+    uint64_t ns;
+    ssize_t n;
+    int rv;
+
+    in = open(method->from, O_RDONLY);
+    rtems_test_assert(in >= 0);
+
+    out = open(method->to, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+    rtems_test_assert(out >= 0);
+
+    begin = rtems_clock_get_uptime_nanoseconds();
+    n = (*method->copy)(out, in);
+    ns = rtems_clock_get_uptime_nanoseconds() - begin;
+    rtems_test_assert(n == FILE_SIZE);
+
+    rv = close(out);
+    rtems_test_assert(rv == 0);
+
+    rv = close(in);
+    rtems_test_assert(rv == 0);
+
+    check_file(method->to, FILE_SIZE);
+
+    printf(
+      "%-10s: %7" PRIu64 " us, %6" PRIu64 " KiB/s\n",
+      method->name,
+      ns / 1000,
+      throughput(FILE_SIZE, ns)
+    );
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+  TEST_BEGIN();
+
+  create_files();
+  fill_blkdev();
+  mount_dosfs();
+  test_errors();
+  test_offset(linfile);
+  test_offset(memfile);
+  test_blkdev();
+  test_throughput();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = 512, .block_num = 2048 },
+  { .block_size = 512, .block_num = FILE_SIZE / 512 }
+};
+
+size_t rtems_ramdisk_configuration_size =
+  RTEMS_ARRAY_SIZE(rtems_ramdisk_configuration);
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_FILESYSTEM_DOSFS
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_EXTRA_TASK_STACKS (8 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,306 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <inttypes.h>
+#include <sha256.h>
+#include <sha512.h>
+#include <stdio.h>
+#include <string.h>
+
+const char rtems_test_name[] = "SHA 2";
+
+/* More than the lanes of the multi-buffer functions */
+#define MESSAGE_COUNT 5
+
+#define MESSAGE_SIZE (16 * 1024)
+
+#define ROUNDS 16
+
+static unsigned char messages[MESSAGE_COUNT][MESSAGE_SIZE];
+
+static uint32_t simple_random(uint32_t v)
+{
+  v *= 1664525;
+  v += 1013904223;
+
+  return v;
+}
+
+static void fill_messages(void)
+{
+  uint32_t v = 1;
+  size_t i;
+  size_t j;
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    for (j = 0; j < MESSAGE_SIZE; ++j) {
+      v = simple_random(v);
+      messages[i][j] = (unsigned char) (v >> 24);
+    }
+  }
+}
+
+static const char *sha256_back_end(void)
+{
+#if defined(__ARM_FEATURE_SHA2) && defined(__ARM_NEON) && \
+    !defined(__ARM_BIG_ENDIAN)
+  return "ARMv8 SHA2";
+#elif defined(__SHA__) && defined(__SSE4_1__)
+  return "x86 SHA";
+#elif defined(__riscv_zknh)
+  return "RISC-V Zknh";
+#else
+  return "generic";
+#endif
+}
+
+static const char *sha512_back_end(void)
+{
+#if defined(__riscv_zknh) && __riscv_xlen == 64
+  return "RISC-V Zknh";
+#else
+  return "generic";
+#endif
+}
+
+/*
+ * The leading bytes are hashed individually to start the multi-buffer update
+ * in the middle of a block of some of the messages.
+ */
+static size_t head_size(size_t i)
+{
+  return i * 37;
+}
+
+static void test_sha256_multi(void)
+{
+  SHA256_CTX ctx[MESSAGE_COUNT];
+  SHA256_CTX *ctxp[MESSAGE_COUNT];
+  const void *in[MESSAGE_COUNT];
+  unsigned char expected[32];
+  unsigned char r[32];
+  size_t len;
+  size_t i;
+
+  len = MESSAGE_SIZE - head_size(MESSAGE_COUNT) - 3;
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    SHA256_Init(&ctx[i]);
+    SHA256_Update(&ctx[i], &messages[i][0], head_size(i));
+    ctxp[i] = &ctx[i];
+    in[i] = &messages[i][head_size(i)];
+  }
+
+  SHA256_Update_Multi(ctxp, in, len, MESSAGE_COUNT);
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    size_t offset = head_size(i) + len;
+
+    SHA256_Update(&ctx[i], &messages[i][offset], MESSAGE_SIZE - offset);
+    SHA256_Final(r, &ctx[i]);
+
+    SHA256_Init(&ctx[i]);
+    SHA256_Update(&ctx[i], &messages[i][0], MESSAGE_SIZE);
+    SHA256_Final(expected, &ctx[i]);
+
+    rtems_test_assert(memcmp(r, expected, sizeof(r)) == 0);
+  }
+}
+
+static void test_sha512_multi(void)
+{
+  SHA512_CTX ctx[MESSAGE_COUNT];
+  SHA512_CTX *ctxp[MESSAGE_COUNT];
+  const void *in[MESSAGE_COUNT];
+  unsigned char expected[64];
+  unsigned char r[64];
+  size_t len;
+  size_t i;
+
+  len = MESSAGE_SIZE - head_size(MESSAGE_COUNT) - 3;
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    SHA512_Init(&ctx[i]);
+    SHA512_Update(&ctx[i], &messages[i][0], head_size(i));
+    ctxp[i] = &ctx[i];
+    in[i] = &messages[i][head_size(i)];
+  }
+
+  SHA512_Update_Multi(ctxp, in, len, MESSAGE_COUNT);
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    size_t offset = head_size(i) + len;
+
+    SHA512_Update(&ctx[i], &messages[i][offset], MESSAGE_SIZE - offset);
+    SHA512_Final(r, &ctx[i]);
+
+    SHA512_Init(&ctx[i]);
+    SHA512_Update(&ctx[i], &messages[i][0], MESSAGE_SIZE);
+    SHA512_Final(expected, &ctx[i]);
+
+    rtems_test_assert(memcmp(r, expected, sizeof(r)) == 0);
+  }
+}
+
+static void sha256_single(void)
+{
+  SHA256_CTX ctx;
+  unsigned char r[32];
+  size_t i;
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    SHA256_Init(&ctx);
+    SHA256_Update(&ctx, &messages[i][0], MESSAGE_SIZE);
+    SHA256_Final(r, &ctx);
+  }
+}
+
+static void sha256_multi(void)
+{
+  SHA256_CTX ctx[MESSAGE_COUNT];
+  SHA256_CTX *ctxp[MESSAGE_COUNT];
+  const void *in[MESSAGE_COUNT];
+  unsigned char r[32];
+  size_t i;
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    SHA256_Init(&ctx[i]);
+    ctxp[i] = &ctx[i];
+    in[i] = &messages[i][0];
+  }
+
+  SHA256_Update_Multi(ctxp, in, MESSAGE_SIZE, MESSAGE_COUNT);
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    SHA256_Final(r, &ctx[i]);
+  }
+}
+
+static void sha512_single(void)
+{
+  SHA512_CTX ctx;
+  unsigned char r[64];
+  size_t i;
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    SHA512_Init(&ctx);
+    SHA512_Update(&ctx, &messages[i][0], MESSAGE_SIZE);
+    SHA512_Final(r, &ctx);
+  }
+}
+
+static void sha512_multi(void)
+{
+  SHA512_CTX ctx[MESSAGE_COUNT];
+  SHA512_CTX *ctxp[MESSAGE_COUNT];
+  const void *in[MESSAGE_COUNT];
+  unsigned char r[64];
+  size_t i;
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    SHA512_Init(&ctx[i]);
+    ctxp[i] = &ctx[i];
+    in[i] = &messages[i][0];
+  }
+
+  SHA512_Update_Multi(ctxp, in, MESSAGE_SIZE, MESSAGE_COUNT);
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    SHA512_Final(r, &ctx[i]);
+  }
+}
+
+static uint64_t throughput(uint64_t bytes, uint64_t ns)
+{
+  if (ns == 0) {
+    ns = 1;
+  }
+
+  return (bytes * 1000000000) / (ns * 1024);
+}
+
+typedef struct {
+  const char *name;
+  void (*hash)(void);
+} hash_method;
+
+static const hash_method methods[] = {
+  { "sha256", sha256_single },
+  { "sha256-mb", sha256_multi },
+  { "sha512", sha512_single },
+  { "sha512-mb", sha512_multi }
+};
+
+static void test_throughput(void)
+{
+  size_t i;
+
+  printf("SHA256 back end: %s\n", sha256_back_end());
+  printf("SHA512 back end: %s\n", sha512_back_end());
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(methods); ++i) {
+    const hash_method *method = &methods[i];
+    uint64_t begin;
+    uint64_t ns;
+    int round;
+
+    begin = rtems_clock_get_uptime_nanoseconds();
+
+    for (round = 0; round < ROUNDS; ++round) {
+      (*method->hash)();
+    }
+
+    ns = rtems_clock_get_uptime_nanoseconds() - begin;
+
+    printf(
+      "%-10s: %7" PRIu64 " us, %6" PRIu64 " KiB/s\n",
+      method->name,
+      ns / 1000,
+      throughput((uint64_t) ROUNDS * MESSAGE_COUNT * MESSAGE_SIZE, ns)
+    );
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+  TEST_BEGIN();
+
+  fill_messages();
+  test_sha256_multi();
+  test_sha512_multi();
+  test_throughput();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+/*
+ * The SHA512_Update() function may need a lot of stack space if the compiler
+ * optimization is disabled.
+ */
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
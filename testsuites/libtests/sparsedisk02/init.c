@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/sparse-disk.h>
+
+const char rtems_test_name[] = "SPARSEDISK 2";
+
+#define DEVICE_NAME "/dev/sda1"
+
+#define BLOCK_SIZE 32
+
+#define BLOCK_COUNT 100000
+
+/* Number of scatter-gather buffers per request */
+#define BATCH_SIZE 64
+
+/* Coprime to the block count to visit every block in a scattered order */
+#define SCATTER_STRIDE 7919
+
+#define FILL_PATTERN 0
+
+typedef enum {
+  ORDER_ASCENDING,
+  ORDER_SCATTERED
+} block_order;
+
+static rtems_disk_device *dd;
+
+static rtems_blkdev_request *request;
+
+static uint8_t buffers[BATCH_SIZE][BLOCK_SIZE];
+
+static void request_done(rtems_blkdev_request *req, rtems_status_code status)
+{
+  rtems_status_code *sc = req->done_arg;
+
+  *sc = status;
+}
+
+static rtems_blkdev_bnum get_block(block_order order, rtems_blkdev_bnum i)
+{
+  if (order == ORDER_SCATTERED) {
+    return (rtems_blkdev_bnum) (((uint64_t) i * SCATTER_STRIDE) % BLOCK_COUNT);
+  }
+
+  return i;
+}
+
+static void fill_block(uint8_t *buf, rtems_blkdev_bnum block, bool pattern)
+{
+  size_t i;
+
+  if (pattern) {
+    memset(buf, FILL_PATTERN, BLOCK_SIZE);
+  } else {
+    for (i = 0; i < BLOCK_SIZE; ++i) {
+      buf[i] = (uint8_t) (block + i + 1);
+    }
+
+    buf[0] = (uint8_t) ~FILL_PATTERN;
+  }
+}
+
+static void do_request(rtems_blkdev_request_op op, uint32_t bufnum)
+{
+  rtems_status_code sc;
+  int rv;
+
+  sc = RTEMS_NOT_IMPLEMENTED;
+  request->req = op;
+  request->done = request_done;
+  request->done_arg = &sc;
+  request->bufnum = bufnum;
+
+  rv = (*dd->ioctl)(dd, RTEMS_BLKIO_REQUEST, request);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static uint64_t write_all(block_order order, bool pattern)
+{
+  uint64_t delta = 0;
+  rtems_blkdev_bnum i;
+
+  for (i = 0; i < BLOCK_COUNT; i += BATCH_SIZE) {
+    uint64_t begin;
+    uint32_t j;
+
+    for (j = 0; j < BATCH_SIZE && i + j < BLOCK_COUNT; ++j) {
+      rtems_blkdev_sg_buffer *sg = &request->bufs[j];
+
+      sg->block = get_block(order, i + j);
+      sg->length = BLOCK_SIZE;
+      sg->buffer = &buffers[j][0];
+      fill_block(sg->buffer, sg->block, pattern);
+    }
+
+    begin = rtems_clock_get_uptime_nanoseconds();
+    do_request(RTEMS_BLKDEV_REQ_WRITE, j);
+    delta += rtems_clock_get_uptime_nanoseconds() - begin;
+  }
+
+  return delta;
+}
+
+static uint64_t read_all(bool pattern)
+{
+  uint64_t delta = 0;
+  rtems_blkdev_bnum i;
+
+  for (i = 0; i < BLOCK_COUNT; i += BATCH_SIZE) {
+    uint8_t expected[BLOCK_SIZE];
+    uint64_t begin;
+    uint32_t j;
+
+    for (j = 0; j < BATCH_SIZE && i + j < BLOCK_COUNT; ++j) {
+      rtems_blkdev_sg_buffer *sg = &request->bufs[j];
+
+      sg->block = i + j;
+      sg->length = BLOCK_SIZE;
+      sg->buffer = &buffers[j][0];
+    }
+
+    begin = rtems_clock_get_uptime_nanoseconds();
+    do_request(RTEMS_BLKDEV_REQ_READ, j);
+    delta += rtems_clock_get_uptime_nanoseconds() - begin;
+
+    while (j > 0) {
+      --j;
+      fill_block(expected, i + j, pattern);
+      rtems_test_assert(memcmp(&buffers[j][0], expected, BLOCK_SIZE) == 0);
+    }
+  }
+
+  return delta;
+}
+
+static void print_result(const char *name, uint64_t ns)
+{
+  printf(
+    "%-20s %6" PRIu32 " blocks, %7" PRIu64 " us, %6" PRIu64 " KiB/s\n",
+    name,
+    (uint32_t) BLOCK_COUNT,
+    ns / 1000,
+    ((uint64_t) BLOCK_COUNT * BLOCK_SIZE * 1000000000)
+      / ((ns != 0 ? ns : 1) * 1024)
+  );
+}
+
+static void test(void)
+{
+  rtems_sparse_disk *sparse_disk;
+  rtems_status_code sc;
+  uint64_t ns;
+  int fd;
+  int rv;
+
+  sc = rtems_sparse_disk_create_and_register(
+    DEVICE_NAME,
+    BLOCK_SIZE,
+    BLOCK_COUNT,
+    BLOCK_COUNT,
+    FILL_PATTERN
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(DEVICE_NAME, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  sparse_disk = rtems_disk_get_driver_data(dd);
+
+  request = malloc(
+    sizeof(*request) + BATCH_SIZE * sizeof(request->bufs[0])
+  );
+  rtems_test_assert(request != NULL);
+
+  ns = write_all(ORDER_ASCENDING, false);
+  print_result("ascending write:", ns);
+  rtems_test_assert(sparse_disk->used_count == BLOCK_COUNT);
+
+  ns = read_all(false);
+  print_result("read:", ns);
+
+  /* Blocks with only fill pattern bytes go back to the free block pool */
+  ns = write_all(ORDER_ASCENDING, true);
+  print_result("fill pattern write:", ns);
+  rtems_test_assert(sparse_disk->used_count == 0);
+
+  ns = write_all(ORDER_SCATTERED, false);
+  print_result("scattered write:", ns);
+  rtems_test_assert(sparse_disk->used_count == BLOCK_COUNT);
+
+  ns = read_all(false);
+  print_result("read:", ns);
+
+  free(request);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(DEVICE_NAME);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (16 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,297 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems/stackchk.h>
+
+const char rtems_test_name[] = "STACKCHK 3";
+
+#define SWITCH_COUNT 100000
+
+#define CREATE_COUNT 100
+
+#define LARGE_STACK_SIZE (256 * 1024)
+
+#define USAGE_STACK_SIZE (64 * 1024)
+
+#define DEEP_STACK_USAGE (16 * 1024)
+
+typedef struct {
+  rtems_id yield;
+  volatile bool done;
+} test_context;
+
+static test_context test_instance;
+
+static void yield_task(rtems_task_argument arg)
+{
+  (void) arg;
+
+  while (true) {
+    rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+  }
+}
+
+static void use_stack_and_yield(void)
+{
+  volatile char buf[DEEP_STACK_USAGE];
+
+  memset(RTEMS_DEVOLATILE(char *, buf), 0, sizeof(buf));
+
+  /* The switch extension samples the stack pointer in this frame */
+  rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+}
+
+static void use_stack(void)
+{
+  volatile char buf[DEEP_STACK_USAGE];
+
+  /* Only the guard words notice this usage */
+  memset(RTEMS_DEVOLATILE(char *, buf), 0, sizeof(buf));
+}
+
+static void deep_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  if (ctx->done) {
+    use_stack();
+  } else {
+    use_stack_and_yield();
+  }
+
+  rtems_task_suspend(RTEMS_SELF);
+}
+
+typedef struct {
+  const char *name;
+  size_t used;
+  size_t available;
+  bool found;
+} usage_context;
+
+static bool get_usage(const rtems_stack_checker_info *info, void *arg)
+{
+  usage_context *ctx = arg;
+
+  if (strcmp(info->name, ctx->name) != 0) {
+    return false;
+  }
+
+  ctx->used = info->used;
+  ctx->available = info->available;
+  ctx->found = true;
+  return true;
+}
+
+static size_t get_task_usage(const char *name)
+{
+  usage_context ctx;
+
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.name = name;
+  rtems_stack_checker_iterate(get_usage, &ctx);
+  rtems_test_assert(ctx.found);
+  rtems_test_assert(ctx.used <= ctx.available);
+  return ctx.used;
+}
+
+static rtems_id create_task(
+  rtems_name name,
+  size_t stack_size,
+  rtems_task_entry entry,
+  test_context *ctx
+)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    name,
+    1,
+    stack_size,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, entry, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return id;
+}
+
+static void test_usage(test_context *ctx)
+{
+  rtems_id sampled;
+  rtems_id guarded;
+  rtems_status_code sc;
+
+  ctx->done = false;
+  sampled = create_task(
+    rtems_build_name('S', 'A', 'M', 'P'),
+    USAGE_STACK_SIZE,
+    deep_task,
+    ctx
+  );
+
+  sc = rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->done = true;
+  guarded = create_task(
+    rtems_build_name('G', 'U', 'A', 'R'),
+    USAGE_STACK_SIZE,
+    deep_task,
+    ctx
+  );
+
+  sc = rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(!rtems_stack_checker_is_blown());
+
+  /* The sample is taken in a frame below the buffer */
+  rtems_test_assert(get_task_usage("SAMP") >= DEEP_STACK_USAGE);
+
+  /* The guard words have a resolution of one eighth of the stack */
+  rtems_test_assert(
+    get_task_usage("GUAR") + USAGE_STACK_SIZE / 8 >= DEEP_STACK_USAGE
+  );
+
+  sc = rtems_task_delete(sampled);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_delete(guarded);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_create(void)
+{
+  uint64_t begin;
+  uint64_t ns;
+  int i;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < CREATE_COUNT; ++i) {
+    rtems_status_code sc;
+    rtems_id id;
+
+    sc = rtems_task_create(
+      rtems_build_name('C', 'R', 'E', 'A'),
+      1,
+      LARGE_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_delete(id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  ns = rtems_clock_get_uptime_nanoseconds() - begin;
+
+  printf(
+    "task create/delete with %i KiB stack: %" PRIu64 " ns\n",
+    LARGE_STACK_SIZE / 1024,
+    ns / CREATE_COUNT
+  );
+}
+
+static void test_switch(const char *variant)
+{
+  uint64_t begin;
+  uint64_t ns;
+  int i;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < SWITCH_COUNT; ++i) {
+    rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+  }
+
+  ns = rtems_clock_get_uptime_nanoseconds() - begin;
+
+  /* Each yield results in two context switches */
+  printf(
+    "context switch %s sampling: %" PRIu64 " ns\n",
+    variant,
+    ns / (2 * SWITCH_COUNT)
+  );
+}
+
+static void test_switch_without_sampling(void)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  /* The stack checks remain, only the sampling extension is removed */
+  sc = rtems_extension_ident(rtems_build_name('S', 'T', 'C', 'K'), &id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_extension_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_switch("without");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  (void) arg;
+  TEST_BEGIN();
+
+  test_usage(ctx);
+  test_create();
+
+  ctx->yield = create_task(
+    rtems_build_name('Y', 'I', 'E', 'L'),
+    RTEMS_MINIMUM_STACK_SIZE,
+    yield_task,
+    ctx
+  );
+
+  test_switch("with");
+  test_switch_without_sampling();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 4
+
+#define CONFIGURE_EXTRA_TASK_STACKS (LARGE_STACK_SIZE + 2 * USAGE_STACK_SIZE)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_STACK_CHECKER_ENABLED
+
+#define CONFIGURE_STACK_CHECKER_SAMPLING
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
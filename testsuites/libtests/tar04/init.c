@@ -0,0 +1,402 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/untar.h>
+
+const char rtems_test_name[] = "TAR 4";
+
+#define FILE_COUNT 8
+
+/* Not a multiple of the TAR block size to exercise the padding */
+#define FILE_SIZE (64 * 1024 + 100)
+
+#define FILE_BLOCKS ((FILE_SIZE + 511) / 512)
+
+#define ARCHIVE_SIZE (FILE_COUNT * (1 + FILE_BLOCKS) * 512 + 2 * 512)
+
+#define ARCHIVE_PATH "/archive.tar"
+
+#define CHUNK_SIZE 4096
+
+#define PIPE_BUFFER_SIZE (2 * 32 * 1024)
+
+static const char * const words[] = {
+  "boot ",
+  "image ",
+  "file ",
+  "archive ",
+  "block ",
+  "the ",
+  "of ",
+  "extract ",
+  "write ",
+  "application\n"
+};
+
+static char *archive;
+
+static unsigned char *archive_gz;
+
+static size_t archive_gz_size;
+
+static char file_data[FILE_SIZE];
+
+static char check_data[FILE_SIZE];
+
+static char inflate_buffer[CHUNK_SIZE];
+
+static char pipe_buffer[PIPE_BUFFER_SIZE];
+
+static uint32_t simple_random(uint32_t v)
+{
+  v *= 1664525;
+  v += 1013904223;
+
+  return v;
+}
+
+static void fill_file(char *buf, int file)
+{
+  uint32_t v = (uint32_t) file + 1;
+  size_t i = 0;
+
+  while (i < FILE_SIZE) {
+    const char *word;
+    size_t n;
+
+    v = simple_random(v);
+    word = words[(v >> 16) % RTEMS_ARRAY_SIZE(words)];
+    n = strlen(word);
+
+    if (n > FILE_SIZE - i) {
+      n = FILE_SIZE - i;
+    }
+
+    memcpy(&buf[i], word, n);
+    i += n;
+  }
+}
+
+static void make_header(char *h, int file)
+{
+  unsigned int sum;
+  size_t i;
+
+  memset(h, 0, 512);
+  snprintf(&h[0], 100, "dir/file%02d", file);
+  snprintf(&h[100], 8, "%07o", 0644);
+  snprintf(&h[108], 8, "%07o", 0);
+  snprintf(&h[116], 8, "%07o", 0);
+  snprintf(&h[124], 12, "%011o", (unsigned int) FILE_SIZE);
+  snprintf(&h[136], 12, "%011o", 0);
+  h[156] = REGTYPE;
+  memcpy(&h[257], "ustar", 6);
+  memcpy(&h[263], "00", 2);
+
+  memset(&h[148], ' ', 8);
+  sum = 0;
+  for (i = 0; i < 512; ++i) {
+    sum += (unsigned char) h[i];
+  }
+  snprintf(&h[148], 8, "%06o", sum);
+  h[155] = ' ';
+}
+
+static void make_archive(void)
+{
+  z_stream strm;
+  size_t offset;
+  int file;
+  int rv;
+
+  archive = calloc(1, ARCHIVE_SIZE);
+  rtems_test_assert(archive != NULL);
+
+  offset = 0;
+  for (file = 0; file < FILE_COUNT; ++file) {
+    make_header(&archive[offset], file);
+    offset += 512;
+    fill_file(&archive[offset], file);
+    offset += FILE_BLOCKS * 512;
+  }
+
+  memset(&strm, 0, sizeof(strm));
+  rv = deflateInit2(&strm, 6, Z_DEFLATED, 16 + MAX_WBITS, 8,
+    Z_DEFAULT_STRATEGY);
+  rtems_test_assert(rv == Z_OK);
+
+  archive_gz_size = deflateBound(&strm, ARCHIVE_SIZE);
+  archive_gz = malloc(archive_gz_size);
+  rtems_test_assert(archive_gz != NULL);
+
+  strm.next_in = (Bytef *) archive;
+  strm.avail_in = ARCHIVE_SIZE;
+  strm.next_out = archive_gz;
+  strm.avail_out = archive_gz_size;
+  rv = deflate(&strm, Z_FINISH);
+  rtems_test_assert(rv == Z_STREAM_END);
+
+  archive_gz_size = strm.total_out;
+  rv = deflateEnd(&strm);
+  rtems_test_assert(rv == Z_OK);
+}
+
+static void write_archive_file(void)
+{
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(ARCHIVE_PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  rtems_test_assert(fd >= 0);
+
+  n = write(fd, archive, ARCHIVE_SIZE);
+  rtems_test_assert(n == ARCHIVE_SIZE);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void enter_target(const char *target)
+{
+  int rv;
+
+  rv = mkdir(target, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  rv = chdir(target);
+  rtems_test_assert(rv == 0);
+}
+
+/*
+ * Checks the extracted files and removes them to free the memory for the
+ * next method.
+ */
+static void check_and_leave_target(const char *target)
+{
+  char path[32];
+  int file;
+  int rv;
+
+  for (file = 0; file < FILE_COUNT; ++file) {
+    ssize_t n;
+    int fd;
+
+    snprintf(path, sizeof(path), "dir/file%02d", file);
+
+    fd = open(path, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    n = read(fd, check_data, sizeof(check_data));
+    rtems_test_assert(n == FILE_SIZE);
+
+    n = read(fd, check_data, 1);
+    rtems_test_assert(n == 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+
+    fill_file(file_data, file);
+    rtems_test_assert(memcmp(check_data, file_data, FILE_SIZE) == 0);
+
+    rv = unlink(path);
+    rtems_test_assert(rv == 0);
+  }
+
+  rv = rmdir("dir");
+  rtems_test_assert(rv == 0);
+
+  rv = chdir("/");
+  rtems_test_assert(rv == 0);
+
+  rv = rmdir(target);
+  rtems_test_assert(rv == 0);
+}
+
+static int extract_memory(void)
+{
+  return Untar_FromMemory_Print(archive, ARCHIVE_SIZE, NULL);
+}
+
+static int extract_file(void)
+{
+  return Untar_FromFile_Print(ARCHIVE_PATH, NULL);
+}
+
+static int extract_chunks(void)
+{
+  Untar_ChunkContext ctx;
+  size_t offset;
+
+  Untar_ChunkContext_Init(&ctx);
+
+  for (offset = 0; offset < ARCHIVE_SIZE; offset += 512) {
+    int status;
+
+    status = Untar_FromChunk_Print(&ctx, &archive[offset], 512, NULL);
+    if (status != UNTAR_SUCCESSFUL) {
+      return status;
+    }
+  }
+
+  return UNTAR_SUCCESSFUL;
+}
+
+static int extract_gz(Untar_PipeContext *pipe)
+{
+  Untar_GzChunkContext ctx;
+  size_t offset;
+  int status;
+
+  status = Untar_GzChunkContext_Init(&ctx, inflate_buffer, CHUNK_SIZE);
+  rtems_test_assert(status == UNTAR_SUCCESSFUL);
+
+  ctx.pipe = pipe;
+
+  for (offset = 0; offset < archive_gz_size; offset += CHUNK_SIZE) {
+    size_t size = archive_gz_size - offset;
+
+    if (size > CHUNK_SIZE) {
+      size = CHUNK_SIZE;
+    }
+
+    status = Untar_FromGzChunk_Print(&ctx, &archive_gz[offset], size, NULL);
+    if (status != UNTAR_SUCCESSFUL) {
+      break;
+    }
+  }
+
+  return status;
+}
+
+static int extract_gz_chunks(void)
+{
+  return extract_gz(NULL);
+}
+
+static int extract_gz_pipe(void)
+{
+  Untar_PipeContext pipe;
+  int status;
+  int finish_status;
+
+  status = Untar_PipeContext_Init(
+    &pipe,
+    pipe_buffer,
+    sizeof(pipe_buffer),
+    RTEMS_CURRENT_PRIORITY,
+    NULL
+  );
+  rtems_test_assert(status == UNTAR_SUCCESSFUL);
+
+  status = extract_gz(&pipe);
+  finish_status = Untar_PipeContext_Finish(&pipe);
+
+  return status != UNTAR_SUCCESSFUL ? status : finish_status;
+}
+
+static uint64_t throughput(uint64_t bytes, uint64_t ns)
+{
+  if (ns == 0) {
+    ns = 1;
+  }
+
+  return (bytes * 1000000000) / (ns * 1024);
+}
+
+typedef struct {
+  const char *name;
+  const char *target;
+  int (*extract)(void);
+} extract_method;
+
+static const extract_method methods[] = {
+  { "memory", "/memory", extract_memory },
+  { "file", "/file", extract_file },
+  { "chunks", "/chunks", extract_chunks },
+  { "tgz", "/tgz", extract_gz_chunks },
+  { "tgz-pipe", "/tgz-pipe", extract_gz_pipe }
+};
+
+static void test(void)
+{
+  size_t i;
+
+  make_archive();
+  write_archive_file();
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(methods); ++i) {
+    const extract_method *method = &methods[i];
+    uint64_t begin;
+    uint64_t ns;
+    int status;
+
+    enter_target(method->target);
+
+    begin = rtems_clock_get_uptime_nanoseconds();
+    status = (*method->extract)();
+    ns = rtems_clock_get_uptime_nanoseconds() - begin;
+    rtems_test_assert(status == UNTAR_SUCCESSFUL);
+
+    check_and_leave_target(method->target);
+
+    printf(
+      "%-10s: %7" PRIu64 " us, %6" PRIu64 " KiB/s\n",
+      method->name,
+      ns / 1000,
+      throughput((uint64_t) FILE_COUNT * FILE_SIZE, ns)
+    );
+  }
+
+  free(archive_gz);
+  free(archive);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK 512
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,295 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/untar.h>
+
+#include "tar05-tar-xz.h"
+
+const char rtems_test_name[] = "TAR 5";
+
+/* The archive content is produced by the build, see tar05.yml */
+#define FILE_COUNT 8
+
+#define FILE_SIZE (64 * 1024 + 100)
+
+/* Set by the xz command line of tar05.yml */
+#define DICT_MAX (64 * 1024)
+
+#define CHUNK_SIZE (32 * 1024)
+
+static const char * const words[] = {
+  "boot ",
+  "image ",
+  "file ",
+  "archive ",
+  "block ",
+  "the ",
+  "of ",
+  "extract ",
+  "write ",
+  "application\n"
+};
+
+static char file_data[FILE_SIZE];
+
+static char check_data[FILE_SIZE];
+
+static char inflate_buffer[CHUNK_SIZE];
+
+static uint32_t simple_random(uint32_t v)
+{
+  v *= 1664525;
+  v += 1013904223;
+
+  return v;
+}
+
+static void fill_file(char *buf, int file)
+{
+  uint32_t v = (uint32_t) file + 1;
+  size_t i = 0;
+
+  while (i < FILE_SIZE) {
+    const char *word;
+    size_t n;
+
+    v = simple_random(v);
+    word = words[(v >> 16) % RTEMS_ARRAY_SIZE(words)];
+    n = strlen(word);
+
+    if (n > FILE_SIZE - i) {
+      n = FILE_SIZE - i;
+    }
+
+    memcpy(&buf[i], word, n);
+    i += n;
+  }
+}
+
+static void enter_target(const char *target)
+{
+  int rv;
+
+  rv = mkdir(target, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  rv = chdir(target);
+  rtems_test_assert(rv == 0);
+}
+
+static void check_and_leave_target(const char *target)
+{
+  char path[32];
+  int file;
+  int rv;
+
+  for (file = 0; file < FILE_COUNT; ++file) {
+    ssize_t n;
+    int fd;
+
+    snprintf(path, sizeof(path), "dir/file%02d", file);
+
+    fd = open(path, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    n = read(fd, check_data, sizeof(check_data));
+    rtems_test_assert(n == FILE_SIZE);
+
+    n = read(fd, check_data, 1);
+    rtems_test_assert(n == 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+
+    fill_file(file_data, file);
+    rtems_test_assert(memcmp(check_data, file_data, FILE_SIZE) == 0);
+
+    rv = unlink(path);
+    rtems_test_assert(rv == 0);
+  }
+
+  rv = rmdir("dir");
+  rtems_test_assert(rv == 0);
+
+  rv = chdir("/");
+  rtems_test_assert(rv == 0);
+
+  rv = rmdir(target);
+  rtems_test_assert(rv == 0);
+}
+
+static int extract_chunks(void)
+{
+  Untar_XzChunkContext ctx;
+  int status;
+
+  status = Untar_XzChunkContext_Init(
+    &ctx,
+    XZ_DYNALLOC,
+    DICT_MAX,
+    inflate_buffer,
+    sizeof(inflate_buffer)
+  );
+  rtems_test_assert(status == UNTAR_SUCCESSFUL);
+
+  return Untar_FromXzChunk_Print(
+    &ctx,
+    tar05_tar_xz,
+    tar05_tar_xz_size,
+    NULL
+  );
+}
+
+static int extract_one_worker(void)
+{
+  return Untar_FromXzMemory_Print(
+    tar05_tar_xz,
+    tar05_tar_xz_size,
+    DICT_MAX,
+    1,
+    NULL
+  );
+}
+
+static int extract_all_processors(void)
+{
+  return Untar_FromXzMemory_Print(
+    tar05_tar_xz,
+    tar05_tar_xz_size,
+    DICT_MAX,
+    0,
+    NULL
+  );
+}
+
+static void test_corrupt_archive(void)
+{
+  unsigned char *corrupt;
+  int status;
+
+  corrupt = malloc(tar05_tar_xz_size);
+  rtems_test_assert(corrupt != NULL);
+
+  /* Flip a bit in the compressed data of the second block */
+  memcpy(corrupt, tar05_tar_xz, tar05_tar_xz_size);
+  corrupt[tar05_tar_xz_size / 4] ^= 0x10;
+
+  enter_target("/corrupt");
+
+  status = Untar_FromXzMemory_Print(
+    corrupt,
+    tar05_tar_xz_size,
+    DICT_MAX,
+    0,
+    NULL
+  );
+  rtems_test_assert(status != UNTAR_SUCCESSFUL);
+
+  /* Nothing is extracted from a corrupt archive */
+  rtems_test_assert(rmdir("dir") != 0);
+
+  rtems_test_assert(chdir("/") == 0);
+  rtems_test_assert(rmdir("/corrupt") == 0);
+
+  free(corrupt);
+}
+
+typedef struct {
+  const char *name;
+  const char *target;
+  int (*extract)(void);
+} extract_method;
+
+static const extract_method methods[] = {
+  { "chunks", "/chunks", extract_chunks },
+  { "1 worker", "/one", extract_one_worker },
+  { "all cpus", "/all", extract_all_processors }
+};
+
+static void test(void)
+{
+  size_t i;
+
+  printf(
+    "archive: %zu bytes, processors: %" PRIu32 "\n",
+    (size_t) tar05_tar_xz_size,
+    rtems_scheduler_get_processor_maximum()
+  );
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(methods); ++i) {
+    const extract_method *method = &methods[i];
+    uint64_t begin;
+    uint64_t ns;
+    int status;
+
+    enter_target(method->target);
+
+    begin = rtems_clock_get_uptime_nanoseconds();
+    status = (*method->extract)();
+    ns = rtems_clock_get_uptime_nanoseconds() - begin;
+    rtems_test_assert(status == UNTAR_SUCCESSFUL);
+
+    check_and_leave_target(method->target);
+
+    printf(
+      "%-10s: %7" PRIu64 " us, %6" PRIu64 " KiB/s\n",
+      method->name,
+      ns / 1000,
+      ((uint64_t) FILE_COUNT * FILE_SIZE * 1000000000)
+        / ((ns != 0 ? ns : 1) * 1024)
+    );
+  }
+
+  test_corrupt_archive();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK 512
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_PROCESSORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 4
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
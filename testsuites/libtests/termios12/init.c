@@ -0,0 +1,420 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <rtems/termiostypes.h>
+
+const char rtems_test_name[] = "TERMIOS 12";
+
+#define TX 0
+
+#define RX 1
+
+#define DEVICE_COUNT 2
+
+#define CBUF_SIZE 256
+
+#define RAW_INPUT_BUFFER_SIZE 4096
+
+#define RAW_OUTPUT_BUFFER_SIZE 1024
+
+#define TRANSFER_SIZE (64 * 1024)
+
+#define IOV_COUNT 4
+
+static const char * const paths[DEVICE_COUNT] = {
+  "/tx",
+  "/rx"
+};
+
+/*
+ * The devices are connected by a loopback line.  The transmit interrupt is
+ * emulated by loopback_complete().
+ */
+typedef struct {
+  rtems_termios_device_context base;
+  rtems_termios_tty *tty;
+  const char *output_buf;
+  size_t output_pending;
+} device_context;
+
+typedef struct {
+  device_context devices[DEVICE_COUNT];
+  int fds[DEVICE_COUNT];
+  struct termios term[DEVICE_COUNT];
+  char tx_buf[TRANSFER_SIZE];
+  char rx_buf[TRANSFER_SIZE];
+} test_context;
+
+static test_context test_instance = {
+  .devices = {
+    {
+      .base = RTEMS_TERMIOS_DEVICE_CONTEXT_INITIALIZER("TX")
+    }, {
+      .base = RTEMS_TERMIOS_DEVICE_CONTEXT_INITIALIZER("RX")
+    }
+  }
+};
+
+static bool first_open(
+  rtems_termios_tty *tty,
+  rtems_termios_device_context *base,
+  struct termios *term,
+  rtems_libio_open_close_args_t *args
+)
+{
+  device_context *dev = (device_context *) base;
+
+  (void) term;
+  (void) args;
+
+  dev->tty = tty;
+
+  return true;
+}
+
+static void write_loopback(
+  rtems_termios_device_context *base,
+  const char *buf,
+  size_t len
+)
+{
+  device_context *dev = (device_context *) base;
+
+  dev->output_buf = buf;
+  dev->output_pending = len;
+}
+
+static const rtems_termios_device_handler handler = {
+  .first_open = first_open,
+  .write = write_loopback,
+  .mode = TERMIOS_IRQ_DRIVEN
+};
+
+static void loopback_complete(test_context *ctx)
+{
+  device_context *tx = &ctx->devices[TX];
+  device_context *rx = &ctx->devices[RX];
+
+  while (tx->output_pending > 0) {
+    size_t len = tx->output_pending;
+    int dropped;
+
+    tx->output_pending = 0;
+    dropped = rtems_termios_enqueue_raw_characters(
+      rx->tty,
+      tx->output_buf,
+      (int) len
+    );
+    rtems_test_assert(dropped == 0);
+    rtems_termios_dequeue_characters(tx->tty, (int) len);
+  }
+}
+
+static void set_term(test_context *ctx, size_t i)
+{
+  int rv;
+
+  rv = tcsetattr(ctx->fds[i], TCSANOW, &ctx->term[i]);
+  rtems_test_assert(rv == 0);
+}
+
+static void set_raw(test_context *ctx, size_t i)
+{
+  cfmakeraw(&ctx->term[i]);
+  ctx->term[i].c_cc[VMIN] = 0;
+  ctx->term[i].c_cc[VTIME] = 0;
+  set_term(ctx, i);
+}
+
+static void setup(test_context *ctx)
+{
+  rtems_status_code sc;
+  size_t i;
+  int rv;
+
+  rtems_termios_initialize();
+
+  sc = rtems_termios_bufsize(
+    CBUF_SIZE,
+    RAW_INPUT_BUFFER_SIZE,
+    RAW_OUTPUT_BUFFER_SIZE
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < DEVICE_COUNT; ++i) {
+    sc = rtems_termios_device_install(
+      paths[i],
+      &handler,
+      NULL,
+      &ctx->devices[i].base
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ctx->fds[i] = open(paths[i], O_RDWR | O_NONBLOCK);
+    rtems_test_assert(ctx->fds[i] >= 0);
+
+    rv = tcgetattr(ctx->fds[i], &ctx->term[i]);
+    rtems_test_assert(rv == 0);
+
+    set_raw(ctx, i);
+  }
+
+  for (i = 0; i < TRANSFER_SIZE; ++i) {
+    ctx->tx_buf[i] = (char) ('A' + (i % 58));
+  }
+}
+
+static size_t receive(test_context *ctx, char *buf, size_t size)
+{
+  size_t received = 0;
+  ssize_t n;
+
+  do {
+    n = read(ctx->fds[RX], &buf[received], size - received);
+    rtems_test_assert(n >= 0);
+    received += (size_t) n;
+  } while (n > 0 && received < size);
+
+  return received;
+}
+
+static void test_readv_writev(test_context *ctx)
+{
+  struct iovec iov[3];
+  char a[2];
+  char b[4];
+  ssize_t n;
+
+  iov[0].iov_base = RTEMS_DECONST(char *, "ab");
+  iov[0].iov_len = 2;
+  iov[1].iov_base = NULL;
+  iov[1].iov_len = 0;
+  iov[2].iov_base = RTEMS_DECONST(char *, "cde");
+  iov[2].iov_len = 3;
+  n = writev(ctx->fds[TX], iov, 3);
+  rtems_test_assert(n == 5);
+  loopback_complete(ctx);
+
+  iov[0].iov_base = a;
+  iov[0].iov_len = sizeof(a);
+  iov[1].iov_base = NULL;
+  iov[1].iov_len = 0;
+  iov[2].iov_base = b;
+  iov[2].iov_len = sizeof(b);
+  n = readv(ctx->fds[RX], iov, 3);
+  rtems_test_assert(n == 5);
+  rtems_test_assert(memcmp(a, "ab", 2) == 0);
+  rtems_test_assert(memcmp(b, "cde", 3) == 0);
+
+  n = readv(ctx->fds[RX], iov, 3);
+  rtems_test_assert(n == 0);
+}
+
+static void test_opost(test_context *ctx)
+{
+  static const char expected[] = "ab      c\r\nx\tyz";
+  char buf[sizeof(expected)];
+  ssize_t n;
+
+  ctx->term[TX].c_oflag |= OPOST | ONLCR | OXTABS;
+  set_term(ctx, TX);
+
+  n = write(ctx->fds[TX], "ab\tc\n", 5);
+  rtems_test_assert(n == 5);
+  loopback_complete(ctx);
+
+  ctx->term[TX].c_oflag &= ~OXTABS;
+  set_term(ctx, TX);
+
+  n = write(ctx->fds[TX], "x\tyz", 4);
+  rtems_test_assert(n == 4);
+  loopback_complete(ctx);
+
+  n = (ssize_t) receive(ctx, buf, sizeof(buf));
+  rtems_test_assert(n == (ssize_t) sizeof(expected) - 1);
+  rtems_test_assert(memcmp(buf, expected, sizeof(expected) - 1) == 0);
+
+  set_raw(ctx, TX);
+}
+
+static void test_cooked_input(test_context *ctx)
+{
+  char buf[4];
+  size_t n;
+
+  ctx->term[RX].c_iflag |= ISTRIP | ICRNL;
+  set_term(ctx, RX);
+
+  rtems_termios_enqueue_raw_characters(ctx->devices[RX].tty, "\xe1\r", 2);
+  n = receive(ctx, buf, sizeof(buf));
+  rtems_test_assert(n == 2);
+  rtems_test_assert(buf[0] == 'a');
+  rtems_test_assert(buf[1] == '\n');
+
+  set_raw(ctx, RX);
+}
+
+static ssize_t transfer_write(test_context *ctx, size_t offset, size_t len)
+{
+  return write(ctx->fds[TX], &ctx->tx_buf[offset], len);
+}
+
+static ssize_t transfer_read(test_context *ctx, size_t offset, size_t len)
+{
+  return read(ctx->fds[RX], &ctx->rx_buf[offset], len);
+}
+
+static void set_iov(struct iovec *iov, char *buf, size_t len)
+{
+  size_t part = len / IOV_COUNT;
+  size_t i;
+
+  for (i = 0; i < IOV_COUNT; ++i) {
+    iov[i].iov_base = buf;
+    iov[i].iov_len = i + 1 < IOV_COUNT ? part : len;
+    buf += part;
+    len -= part;
+  }
+}
+
+static ssize_t transfer_writev(test_context *ctx, size_t offset, size_t len)
+{
+  struct iovec iov[IOV_COUNT];
+
+  set_iov(iov, &ctx->tx_buf[offset], len);
+  return writev(ctx->fds[TX], iov, IOV_COUNT);
+}
+
+static ssize_t transfer_readv(test_context *ctx, size_t offset, size_t len)
+{
+  struct iovec iov[IOV_COUNT];
+
+  set_iov(iov, &ctx->rx_buf[offset], len);
+  return readv(ctx->fds[RX], iov, IOV_COUNT);
+}
+
+typedef struct {
+  const char *name;
+  tcflag_t iflag;
+  tcflag_t lflag;
+  ssize_t (*write)(test_context *, size_t, size_t);
+  ssize_t (*read)(test_context *, size_t, size_t);
+} transfer_method;
+
+static const transfer_method methods[] = {
+  { "raw", 0, 0, transfer_write, transfer_read },
+  { "raw-iov", 0, 0, transfer_writev, transfer_readv },
+  { "cooked", ISTRIP, ISIG, transfer_write, transfer_read }
+};
+
+static uint64_t throughput(uint64_t bytes, uint64_t ns)
+{
+  if (ns == 0) {
+    ns = 1;
+  }
+
+  return (bytes * 1000000000) / (ns * 1024);
+}
+
+static void test_throughput(test_context *ctx)
+{
+  size_t i;
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(methods); ++i) {
+    const transfer_method *method = &methods[i];
+    size_t sent;
+    size_t received;
+    uint64_t begin;
+    uint64_t ns;
+
+    ctx->term[RX].c_iflag |= method->iflag;
+    ctx->term[RX].c_lflag |= method->lflag;
+    set_term(ctx, RX);
+    memset(ctx->rx_buf, 0, sizeof(ctx->rx_buf));
+
+    sent = 0;
+    received = 0;
+    begin = rtems_clock_get_uptime_nanoseconds();
+
+    while (received < TRANSFER_SIZE) {
+      ssize_t n;
+
+      if (sent < TRANSFER_SIZE) {
+        n = (*method->write)(ctx, sent, TRANSFER_SIZE - sent);
+        rtems_test_assert(n > 0);
+        sent += (size_t) n;
+      }
+
+      loopback_complete(ctx);
+
+      do {
+        n = (*method->read)(ctx, received, TRANSFER_SIZE - received);
+        rtems_test_assert(n >= 0);
+        received += (size_t) n;
+      } while (n > 0 && received < TRANSFER_SIZE);
+    }
+
+    ns = rtems_clock_get_uptime_nanoseconds() - begin;
+
+    rtems_test_assert(memcmp(ctx->tx_buf, ctx->rx_buf, TRANSFER_SIZE) == 0);
+    set_raw(ctx, RX);
+
+    printf(
+      "%-10s: %7" PRIu64 " us, %6" PRIu64 " KiB/s\n",
+      method->name,
+      ns / 1000,
+      throughput(TRANSFER_SIZE, ns)
+    );
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  (void) arg;
+  TEST_BEGIN();
+
+  setup(ctx);
+  test_readv_writev(ctx);
+  test_opost(ctx);
+  test_cooked_input(ctx);
+  test_throughput(ctx);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zlib.h>
+
+const char rtems_test_name[] = "ZLIB 1";
+
+#define DATA_SIZE (256 * 1024)
+
+#define INFLATE_OUT_SIZE (16 * 1024)
+
+#define ROUNDS 8
+
+/* Values of the reference zlib implementation for the test data */
+#define DATA_CRC32 0x9714f739UL
+
+#define DATA_CRC32_OFFSET_3 0x3dce79f1UL
+
+#define DATA_ADLER32 0xf7ad1d91UL
+
+#define DATA_ADLER32_OFFSET_1 0xdda81d22UL
+
+static const char * const words[] = {
+  "boot ",
+  "image ",
+  "file ",
+  "archive ",
+  "block ",
+  "the ",
+  "of ",
+  "inflate ",
+  "crc ",
+  "application\n"
+};
+
+static unsigned char data[DATA_SIZE];
+
+static unsigned char check_data[DATA_SIZE];
+
+static unsigned char *compressed;
+
+static size_t compressed_size;
+
+static uint32_t simple_random(uint32_t v)
+{
+  v *= 1664525;
+  v += 1013904223;
+
+  return v;
+}
+
+static void add_byte(size_t *i, unsigned char c)
+{
+  if (*i < DATA_SIZE) {
+    data[*i] = c;
+    ++(*i);
+  }
+}
+
+/*
+ * Mixes text, random bytes, and short distance repetitions to exercise the
+ * literal, window, and overlapped copy paths of the inflate fast path.
+ */
+static void fill_data(void)
+{
+  uint32_t v = 1;
+  size_t i = 0;
+
+  while (i < DATA_SIZE) {
+    const char *word;
+    size_t n;
+
+    v = simple_random(v);
+
+    switch ((v >> 8) % 4) {
+      case 0:
+      case 1:
+        word = words[(v >> 16) % RTEMS_ARRAY_SIZE(words)];
+        while (*word != '\0') {
+          add_byte(&i, (unsigned char) *word);
+          ++word;
+        }
+        break;
+      case 2:
+        add_byte(&i, (unsigned char) (v >> 24));
+        break;
+      default:
+        for (n = 0; n < (v >> 16) % 32 + 3; ++n) {
+          add_byte(&i, (unsigned char) "ab"[n % 2]);
+        }
+        break;
+    }
+  }
+}
+
+static void test_checksums(void)
+{
+  uLong crc;
+  uLong adler;
+  size_t i;
+
+  rtems_test_assert(crc32(0, data, DATA_SIZE) == DATA_CRC32);
+  rtems_test_assert(crc32(0, &data[3], DATA_SIZE - 3) == DATA_CRC32_OFFSET_3);
+  rtems_test_assert(adler32(1, data, DATA_SIZE) == DATA_ADLER32);
+  rtems_test_assert(
+    adler32(1, &data[1], DATA_SIZE - 1) == DATA_ADLER32_OFFSET_1
+  );
+
+  /* Piecewise with all alignments and lengths around the word size */
+  crc = crc32(0, Z_NULL, 0);
+  adler = adler32(0, Z_NULL, 0);
+  i = 0;
+
+  while (i < DATA_SIZE) {
+    size_t n = i % 67 + 1;
+
+    if (n > DATA_SIZE - i) {
+      n = DATA_SIZE - i;
+    }
+
+    crc = crc32(crc, &data[i], n);
+    adler = adler32(adler, &data[i], n);
+    i += n;
+  }
+
+  rtems_test_assert(crc == DATA_CRC32);
+  rtems_test_assert(adler == DATA_ADLER32);
+}
+
+static void compress_data(void)
+{
+  z_stream strm;
+  int rv;
+
+  memset(&strm, 0, sizeof(strm));
+  rv = deflateInit(&strm, Z_DEFAULT_COMPRESSION);
+  rtems_test_assert(rv == Z_OK);
+
+  compressed_size = deflateBound(&strm, DATA_SIZE);
+  compressed = malloc(compressed_size);
+  rtems_test_assert(compressed != NULL);
+
+  strm.next_in = data;
+  strm.avail_in = DATA_SIZE;
+  strm.next_out = compressed;
+  strm.avail_out = compressed_size;
+  rv = deflate(&strm, Z_FINISH);
+  rtems_test_assert(rv == Z_STREAM_END);
+
+  compressed_size = strm.total_out;
+  rv = deflateEnd(&strm);
+  rtems_test_assert(rv == Z_OK);
+}
+
+static void inflate_data(uInt out_size)
+{
+  z_stream strm;
+  int rv;
+
+  memset(&strm, 0, sizeof(strm));
+  rv = inflateInit(&strm);
+  rtems_test_assert(rv == Z_OK);
+
+  strm.next_in = compressed;
+  strm.avail_in = compressed_size;
+
+  do {
+    uInt avail = DATA_SIZE - strm.total_out;
+
+    strm.next_out = &check_data[strm.total_out];
+    strm.avail_out = avail < out_size ? avail : out_size;
+    rv = inflate(&strm, Z_NO_FLUSH);
+  } while (rv == Z_OK);
+
+  rtems_test_assert(rv == Z_STREAM_END);
+  rtems_test_assert(strm.total_out == DATA_SIZE);
+
+  rv = inflateEnd(&strm);
+  rtems_test_assert(rv == Z_OK);
+}
+
+static void test_inflate(void)
+{
+  compress_data();
+
+  /*
+   * A small output buffer forces matches to be copied from the window,
+   * a large one uses the fast path on the output.
+   */
+  memset(check_data, 0, sizeof(check_data));
+  inflate_data(300);
+  rtems_test_assert(memcmp(check_data, data, DATA_SIZE) == 0);
+
+  memset(check_data, 0, sizeof(check_data));
+  inflate_data(INFLATE_OUT_SIZE);
+  rtems_test_assert(memcmp(check_data, data, DATA_SIZE) == 0);
+}
+
+static void print_result(const char *name, uint64_t ns)
+{
+  printf(
+    "%-10s: %7" PRIu64 " us, %6" PRIu64 " KiB/s\n",
+    name,
+    ns / 1000,
+    ((uint64_t) ROUNDS * DATA_SIZE * 1000000000)
+      / ((ns != 0 ? ns : 1) * 1024)
+  );
+}
+
+static void benchmark(void)
+{
+  uint64_t begin;
+  uint64_t ns;
+  int i;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+  for (i = 0; i < ROUNDS; ++i) {
+    rtems_test_assert(crc32(0, data, DATA_SIZE) == DATA_CRC32);
+  }
+  ns = rtems_clock_get_uptime_nanoseconds() - begin;
+  print_result("crc32", ns);
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+  for (i = 0; i < ROUNDS; ++i) {
+    rtems_test_assert(adler32(1, data, DATA_SIZE) == DATA_ADLER32);
+  }
+  ns = rtems_clock_get_uptime_nanoseconds() - begin;
+  print_result("adler32", ns);
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+  for (i = 0; i < ROUNDS; ++i) {
+    inflate_data(INFLATE_OUT_SIZE);
+  }
+  ns = rtems_clock_get_uptime_nanoseconds() - begin;
+  print_result("inflate", ns);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+  TEST_BEGIN();
+
+  fill_data();
+  test_checksums();
+  test_inflate();
+  benchmark();
+  free(compressed);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (16 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
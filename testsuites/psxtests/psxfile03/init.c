@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <unistd.h>
+
+const char rtems_test_name[] = "PSXFILE 3";
+
+#define WORKER_MAXIMUM 4
+
+#define FILE_DESCRIPTOR_MAXIMUM 16
+
+#define ITERATIONS 10000
+
+#define FILE_PATH "/file"
+
+typedef struct {
+  pthread_barrier_t barrier;
+} test_context;
+
+static test_context test_instance;
+
+static int open_all(int *fds)
+{
+  int n;
+
+  n = 0;
+
+  while (true) {
+    int fd;
+
+    fd = open(FILE_PATH, O_RDONLY);
+    if (fd < 0) {
+      rtems_test_assert(errno == ENFILE);
+      break;
+    }
+
+    rtems_test_assert(n < FILE_DESCRIPTOR_MAXIMUM);
+    fds[n] = fd;
+    ++n;
+  }
+
+  return n;
+}
+
+static void close_all(const int *fds, int n)
+{
+  int i;
+
+  for (i = 0; i < n; ++i) {
+    int rv;
+
+    rv = close(fds[i]);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void test_exhaustion(void)
+{
+  int fds[FILE_DESCRIPTOR_MAXIMUM];
+  int n;
+  int m;
+
+  n = open_all(fds);
+  rtems_test_assert(n > 0);
+  close_all(fds, n);
+
+  /* All descriptors are available again */
+  m = open_all(fds);
+  rtems_test_assert(m == n);
+  close_all(fds, m);
+}
+
+static void *worker(void *arg)
+{
+  test_context *ctx;
+  int eno;
+  int i;
+
+  ctx = arg;
+
+  eno = pthread_barrier_wait(&ctx->barrier);
+  rtems_test_assert(eno == 0 || eno == PTHREAD_BARRIER_SERIAL_THREAD);
+
+  for (i = 0; i < ITERATIONS; ++i) {
+    int fd;
+    int rv;
+
+    fd = open(FILE_PATH, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+
+  return NULL;
+}
+
+static void run(test_context *ctx, uint32_t worker_count)
+{
+  pthread_t threads[WORKER_MAXIMUM];
+  uint64_t begin;
+  uint64_t ns;
+  uint64_t opens;
+  uint32_t i;
+  int eno;
+
+  eno = pthread_barrier_init(&ctx->barrier, NULL, worker_count);
+  rtems_test_assert(eno == 0);
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < worker_count; ++i) {
+    eno = pthread_create(&threads[i], NULL, worker, ctx);
+    rtems_test_assert(eno == 0);
+  }
+
+  for (i = 0; i < worker_count; ++i) {
+    eno = pthread_join(threads[i], NULL);
+    rtems_test_assert(eno == 0);
+  }
+
+  ns = rtems_clock_get_uptime_nanoseconds() - begin;
+
+  eno = pthread_barrier_destroy(&ctx->barrier);
+  rtems_test_assert(eno == 0);
+
+  if (ns == 0) {
+    ns = 1;
+  }
+
+  opens = (uint64_t) worker_count * ITERATIONS;
+  printf(
+    "workers %" PRIu32 ": %7" PRIu64 " us, %8" PRIu64 " open/close per s\n",
+    worker_count,
+    ns / 1000,
+    (opens * 1000000000) / ns
+  );
+}
+
+static void test(test_context *ctx)
+{
+  uint32_t cpu_count;
+  uint32_t worker_count;
+  int fd;
+  int rv;
+
+  fd = open(FILE_PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  rtems_test_assert(fd >= 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  test_exhaustion();
+
+  cpu_count = rtems_scheduler_get_processor_maximum();
+  if (cpu_count > WORKER_MAXIMUM) {
+    cpu_count = WORKER_MAXIMUM;
+  }
+
+  for (worker_count = 1; worker_count <= cpu_count; ++worker_count) {
+    run(ctx, worker_count);
+  }
+
+  /* No descriptor leaked */
+  test_exhaustion();
+
+  rv = unlink(FILE_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+  TEST_BEGIN();
+
+  test(&test_instance);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS FILE_DESCRIPTOR_MAXIMUM
+
+#define CONFIGURE_MAXIMUM_PROCESSORS WORKER_MAXIMUM
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS WORKER_MAXIMUM
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,163 @@
+/*
+ *  COPYRIGHT (c) 2026.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include <timesys.h>
+#include "test_support.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <rtems/btimer.h>
+
+#define WAITER_MAX 256
+
+const char rtems_test_name[] = "PSXTMCOND 11";
+
+/* forward declarations to avoid warnings */
+void *POSIX_Init(void *argument);
+void *Waiter(void *argument);
+
+pthread_mutex_t MutexID;
+pthread_cond_t CondID;
+pthread_t WaiterID[WAITER_MAX];
+int Woken;
+
+void *Waiter(
+  void *argument
+)
+{
+  int status;
+
+  status = pthread_mutex_lock(&MutexID);
+  rtems_test_assert( status == 0 );
+
+  /* Unlock mutex, block, wait for CondID to be broadcasted */
+  status = pthread_cond_wait(&CondID, &MutexID);
+  rtems_test_assert( status == 0 );
+
+  ++Woken;
+
+  status = pthread_mutex_unlock(&MutexID);
+  rtems_test_assert( status == 0 );
+
+  return NULL;
+}
+
+static void benchmark_broadcast(int n, const pthread_attr_t *attr)
+{
+  uint32_t broadcast_time;
+  uint32_t end_time;
+  int      status;
+  int      i;
+  char     message[80];
+
+  Woken = 0;
+
+  for ( i = 0 ; i < n ; i++ ) {
+    /* Threads will preempt as they are created, start up, and block */
+    status = pthread_create(&WaiterID[i], attr, Waiter, NULL);
+    rtems_test_assert( status == 0 );
+  }
+
+  status = pthread_mutex_lock(&MutexID);
+  rtems_test_assert( status == 0 );
+
+  benchmark_timer_initialize();
+  status = pthread_cond_broadcast(&CondID);
+  broadcast_time = benchmark_timer_read();
+  rtems_test_assert( status == 0 );
+
+  /*
+   * The waiters have a higher priority, so we get back here after all of
+   * them acquired and released the mutex.
+   */
+  status = pthread_mutex_unlock(&MutexID);
+  end_time = benchmark_timer_read();
+  rtems_test_assert( status == 0 );
+  rtems_test_assert( Woken == n );
+
+  snprintf(
+    message,
+    sizeof(message),
+    "pthread_cond_broadcast: %d threads waiting",
+    n
+  );
+  put_time( message, broadcast_time, 1, 0, 0 );
+
+  snprintf(
+    message,
+    sizeof(message),
+    "pthread_cond_broadcast: %d threads waiting: mutex handover",
+    n
+  );
+  put_time( message, end_time, 1, 0, 0 );
+
+  for ( i = 0 ; i < n ; i++ ) {
+    status = pthread_join(WaiterID[i], NULL);
+    rtems_test_assert( status == 0 );
+  }
+}
+
+void *POSIX_Init(
+  void *argument
+)
+{
+  int                 status;
+  int                 n;
+  pthread_attr_t      attr;
+  struct sched_param  param;
+
+  TEST_BEGIN();
+
+  status = pthread_mutex_init(&MutexID, NULL);
+  rtems_test_assert( status == 0 );
+  status = pthread_cond_init(&CondID, NULL);
+  rtems_test_assert( status == 0 );
+
+  /* Setup so threads are created with a high enough priority to preempt
+   * as they get created.
+   */
+  status = pthread_attr_init( &attr );
+  rtems_test_assert( status == 0 );
+  status = pthread_attr_setinheritsched( &attr, PTHREAD_EXPLICIT_SCHED );
+  rtems_test_assert( status == 0 );
+  status = pthread_attr_setschedpolicy( &attr, SCHED_FIFO );
+  rtems_test_assert( status == 0 );
+  param.sched_priority = sched_get_priority_max(SCHED_FIFO) / 2;
+  status = pthread_attr_setschedparam( &attr, &param );
+  rtems_test_assert( status == 0 );
+
+  for ( n = 1 ; n <= WAITER_MAX ; n *= 2 ) {
+    benchmark_broadcast( n, &attr );
+  }
+
+  TEST_END();
+  rtems_test_exit( 0 );
+
+  return NULL;
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS  1 + WAITER_MAX
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+  /* end of file */
@@ -0,0 +1,398 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/test-info.h>
+#include <rtems/posix/pthread.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPMUTEX 3";
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 4
+
+#define CRITICAL_SECTION_NANOSECONDS 500
+
+typedef struct {
+  uint64_t counter;
+  rtems_counter_ticks max_obtain;
+  rtems_counter_ticks sum_obtain;
+} test_stats;
+
+typedef struct {
+  rtems_test_parallel_context base;
+  rtems_id classic_mtx;
+  rtems_id classic_adaptive_mtx;
+  pthread_mutex_t posix_mtx;
+  pthread_mutex_t posix_adaptive_mtx;
+  test_stats stats[CPU_COUNT] RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES);
+} test_context;
+
+static test_context test_instance;
+
+typedef struct {
+  const char *name;
+  void (*lock)(test_context *ctx);
+  void (*unlock)(test_context *ctx);
+} test_variant;
+
+static void classic_lock(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_obtain(ctx->classic_mtx, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void classic_unlock(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_release(ctx->classic_mtx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void classic_adaptive_lock(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_obtain(
+    ctx->classic_adaptive_mtx,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void classic_adaptive_unlock(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_release(ctx->classic_adaptive_mtx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void posix_lock(test_context *ctx)
+{
+  int eno;
+
+  eno = pthread_mutex_lock(&ctx->posix_mtx);
+  rtems_test_assert(eno == 0);
+}
+
+static void posix_unlock(test_context *ctx)
+{
+  int eno;
+
+  eno = pthread_mutex_unlock(&ctx->posix_mtx);
+  rtems_test_assert(eno == 0);
+}
+
+static void posix_adaptive_lock(test_context *ctx)
+{
+  int eno;
+
+  eno = pthread_mutex_lock(&ctx->posix_adaptive_mtx);
+  rtems_test_assert(eno == 0);
+}
+
+static void posix_adaptive_unlock(test_context *ctx)
+{
+  int eno;
+
+  eno = pthread_mutex_unlock(&ctx->posix_adaptive_mtx);
+  rtems_test_assert(eno == 0);
+}
+
+static const test_variant test_variants[TEST_COUNT] = {
+  { "ClassicMutex", classic_lock, classic_unlock },
+  { "ClassicAdaptiveMutex", classic_adaptive_lock, classic_adaptive_unlock },
+  { "POSIXMutex", posix_lock, posix_unlock },
+  { "POSIXAdaptiveMutex", posix_adaptive_lock, posix_adaptive_unlock }
+};
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  memset(&ctx->stats[0], 0, sizeof(ctx->stats));
+
+  return rtems_clock_get_ticks_per_second();
+}
+
+static void test_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  const test_variant *variant = arg;
+  test_stats *stats = &ctx->stats[worker_index];
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    rtems_counter_ticks begin;
+    rtems_counter_ticks delta;
+
+    begin = rtems_counter_read();
+    (*variant->lock)(ctx);
+    delta = rtems_counter_difference(rtems_counter_read(), begin);
+    rtems_counter_delay_nanoseconds(CRITICAL_SECTION_NANOSECONDS);
+    (*variant->unlock)(ctx);
+
+    ++stats->counter;
+    stats->sum_obtain += delta;
+
+    if (delta > stats->max_obtain) {
+      stats->max_obtain = delta;
+    }
+  }
+}
+
+static void test_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  const test_variant *variant = arg;
+  uint64_t sum = 0;
+  size_t i;
+
+  printf("  <%s activeWorker=\"%zu\">\n", variant->name, active_workers);
+
+  for (i = 0; i < active_workers; ++i) {
+    const test_stats *stats = &ctx->stats[i];
+    uint64_t avg_obtain;
+
+    sum += stats->counter;
+
+    if (stats->counter > 0) {
+      avg_obtain = rtems_counter_ticks_to_nanoseconds(
+        (rtems_counter_ticks) (stats->sum_obtain / stats->counter)
+      );
+    } else {
+      avg_obtain = 0;
+    }
+
+    printf(
+      "    <Worker index=\"%zu\">\n"
+      "      <Counter>%" PRIu64 "</Counter>\n"
+      "      <AvgObtainNs>%" PRIu64 "</AvgObtainNs>\n"
+      "      <MaxObtainNs>%" PRIu64 "</MaxObtainNs>\n"
+      "    </Worker>\n",
+      i,
+      stats->counter,
+      avg_obtain,
+      rtems_counter_ticks_to_nanoseconds(stats->max_obtain)
+    );
+  }
+
+  printf(
+    "    <SumOfCounter>%" PRIu64 "</SumOfCounter>\n"
+    "  </%s>\n",
+    sum,
+    variant->name
+  );
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = test_body,
+    .fini = test_fini,
+    .arg = RTEMS_DECONST(test_variant *, &test_variants[0]),
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_body,
+    .fini = test_fini,
+    .arg = RTEMS_DECONST(test_variant *, &test_variants[1]),
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_body,
+    .fini = test_fini,
+    .arg = RTEMS_DECONST(test_variant *, &test_variants[2]),
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_body,
+    .fini = test_fini,
+    .arg = RTEMS_DECONST(test_variant *, &test_variants[3]),
+    .cascade = true
+  }
+};
+
+static void create_mutexes(test_context *ctx)
+{
+  rtems_status_code sc;
+  pthread_mutexattr_t attr;
+  int eno;
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('M', 'T', 'X', ' '),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY | RTEMS_INHERIT_PRIORITY,
+    0,
+    &ctx->classic_mtx
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('A', 'M', 'T', 'X'),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY | RTEMS_INHERIT_PRIORITY
+      | RTEMS_ADAPTIVE_SPINNING,
+    0,
+    &ctx->classic_adaptive_mtx
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  eno = pthread_mutex_init(&ctx->posix_mtx, NULL);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutexattr_init(&attr);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_ADAPTIVE_NP);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_PROTECT);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutex_init(&ctx->posix_adaptive_mtx, &attr);
+  rtems_test_assert(eno == EINVAL);
+
+  eno = pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutex_init(&ctx->posix_adaptive_mtx, &attr);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutexattr_destroy(&attr);
+  rtems_test_assert(eno == 0);
+}
+
+static void test_invalid_attributes(void)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('I', 'N', 'V', ' '),
+    1,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_ADAPTIVE_SPINNING,
+    0,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_NOT_DEFINED);
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('I', 'N', 'V', ' '),
+    1,
+    RTEMS_SIMPLE_BINARY_SEMAPHORE | RTEMS_ADAPTIVE_SPINNING,
+    0,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_NOT_DEFINED);
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('I', 'N', 'V', ' '),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY
+      | RTEMS_MULTIPROCESSOR_RESOURCE_SHARING | RTEMS_ADAPTIVE_SPINNING,
+    1,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_NOT_DEFINED);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  const char *test = "SMPMutex03";
+
+  test_invalid_attributes();
+  create_mutexes(ctx);
+
+  printf("<%s>\n", test);
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("</%s>\n", test);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 2
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,467 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/test-info.h>
+#include <rtems/posix/pthread.h>
+#include <rtems/thread.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPRWLOCK 1";
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 3
+
+#define CRITICAL_SECTION_NANOSECONDS 200
+
+#define WRITE_PERIOD 256
+
+typedef struct {
+  uint64_t reads;
+  uint64_t writes;
+  rtems_counter_ticks max_read_obtain;
+  rtems_counter_ticks sum_read_obtain;
+} test_stats;
+
+typedef struct {
+  rtems_test_parallel_context base;
+  pthread_rwlock_t posix_rwlock;
+  pthread_rwlock_t posix_scalable_rwlock;
+  rtems_rwlock rwlock;
+  test_stats stats[CPU_COUNT] RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES);
+} test_context;
+
+static test_context test_instance;
+
+typedef struct {
+  const char *name;
+  void (*read_lock)(test_context *ctx);
+  void (*read_unlock)(test_context *ctx);
+  void (*write_lock)(test_context *ctx);
+  void (*write_unlock)(test_context *ctx);
+} test_variant;
+
+static void posix_read_lock(test_context *ctx)
+{
+  int eno;
+
+  eno = pthread_rwlock_rdlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == 0);
+}
+
+static void posix_write_lock(test_context *ctx)
+{
+  int eno;
+
+  eno = pthread_rwlock_wrlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == 0);
+}
+
+static void posix_unlock(test_context *ctx)
+{
+  int eno;
+
+  eno = pthread_rwlock_unlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == 0);
+}
+
+static void posix_scalable_read_lock(test_context *ctx)
+{
+  int eno;
+
+  eno = pthread_rwlock_rdlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == 0);
+}
+
+static void posix_scalable_write_lock(test_context *ctx)
+{
+  int eno;
+
+  eno = pthread_rwlock_wrlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == 0);
+}
+
+static void posix_scalable_unlock(test_context *ctx)
+{
+  int eno;
+
+  eno = pthread_rwlock_unlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == 0);
+}
+
+static void self_contained_read_lock(test_context *ctx)
+{
+  rtems_rwlock_read_lock(&ctx->rwlock);
+}
+
+static void self_contained_read_unlock(test_context *ctx)
+{
+  rtems_rwlock_read_unlock(&ctx->rwlock);
+}
+
+static void self_contained_write_lock(test_context *ctx)
+{
+  rtems_rwlock_write_lock(&ctx->rwlock);
+}
+
+static void self_contained_write_unlock(test_context *ctx)
+{
+  rtems_rwlock_write_unlock(&ctx->rwlock);
+}
+
+static const test_variant test_variants[TEST_COUNT] = {
+  {
+    "POSIXRWLock",
+    posix_read_lock,
+    posix_unlock,
+    posix_write_lock,
+    posix_unlock
+  }, {
+    "POSIXScalableRWLock",
+    posix_scalable_read_lock,
+    posix_scalable_unlock,
+    posix_scalable_write_lock,
+    posix_scalable_unlock
+  }, {
+    "RTEMSRWLock",
+    self_contained_read_lock,
+    self_contained_read_unlock,
+    self_contained_write_lock,
+    self_contained_write_unlock
+  }
+};
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  memset(&ctx->stats[0], 0, sizeof(ctx->stats));
+
+  return rtems_clock_get_ticks_per_second();
+}
+
+static void test_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  const test_variant *variant = arg;
+  test_stats *stats = &ctx->stats[worker_index];
+  uint64_t iteration = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    rtems_counter_ticks begin;
+    rtems_counter_ticks delta;
+
+    ++iteration;
+
+    /* Read-mostly workload: only the first worker writes occasionally */
+    if (worker_index == 0 && iteration % WRITE_PERIOD == 0) {
+      (*variant->write_lock)(ctx);
+      rtems_counter_delay_nanoseconds(CRITICAL_SECTION_NANOSECONDS);
+      (*variant->write_unlock)(ctx);
+      ++stats->writes;
+      continue;
+    }
+
+    begin = rtems_counter_read();
+    (*variant->read_lock)(ctx);
+    delta = rtems_counter_difference(rtems_counter_read(), begin);
+    rtems_counter_delay_nanoseconds(CRITICAL_SECTION_NANOSECONDS);
+    (*variant->read_unlock)(ctx);
+
+    ++stats->reads;
+    stats->sum_read_obtain += delta;
+
+    if (delta > stats->max_read_obtain) {
+      stats->max_read_obtain = delta;
+    }
+  }
+}
+
+static void test_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  const test_variant *variant = arg;
+  uint64_t sum = 0;
+  size_t i;
+
+  printf("  <%s activeWorker=\"%zu\">\n", variant->name, active_workers);
+
+  for (i = 0; i < active_workers; ++i) {
+    const test_stats *stats = &ctx->stats[i];
+    uint64_t avg_obtain;
+
+    sum += stats->reads;
+
+    if (stats->reads > 0) {
+      avg_obtain = rtems_counter_ticks_to_nanoseconds(
+        (rtems_counter_ticks) (stats->sum_read_obtain / stats->reads)
+      );
+    } else {
+      avg_obtain = 0;
+    }
+
+    printf(
+      "    <Worker index=\"%zu\">\n"
+      "      <Reads>%" PRIu64 "</Reads>\n"
+      "      <Writes>%" PRIu64 "</Writes>\n"
+      "      <AvgReadObtainNs>%" PRIu64 "</AvgReadObtainNs>\n"
+      "      <MaxReadObtainNs>%" PRIu64 "</MaxReadObtainNs>\n"
+      "    </Worker>\n",
+      i,
+      stats->reads,
+      stats->writes,
+      avg_obtain,
+      rtems_counter_ticks_to_nanoseconds(stats->max_read_obtain)
+    );
+  }
+
+  printf(
+    "    <SumOfReads>%" PRIu64 "</SumOfReads>\n"
+    "  </%s>\n",
+    sum,
+    variant->name
+  );
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = test_body,
+    .fini = test_fini,
+    .arg = RTEMS_DECONST(test_variant *, &test_variants[0]),
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_body,
+    .fini = test_fini,
+    .arg = RTEMS_DECONST(test_variant *, &test_variants[1]),
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_body,
+    .fini = test_fini,
+    .arg = RTEMS_DECONST(test_variant *, &test_variants[2]),
+    .cascade = true
+  }
+};
+
+static void create_rwlocks(test_context *ctx)
+{
+  pthread_rwlockattr_t attr;
+  int kind;
+  int pshared;
+  int eno;
+
+  eno = pthread_rwlock_init(&ctx->posix_rwlock, NULL);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlockattr_init(&attr);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlockattr_getkind_np(&attr, &kind);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(kind == PTHREAD_RWLOCK_DEFAULT_NP);
+
+  eno = pthread_rwlockattr_setkind_np(&attr, 123);
+  rtems_test_assert(eno == EINVAL);
+
+  eno = pthread_rwlockattr_setkind_np(&attr, PTHREAD_RWLOCK_SCALABLE_NP);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlockattr_getkind_np(&attr, &kind);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(kind == PTHREAD_RWLOCK_SCALABLE_NP);
+
+  eno = pthread_rwlockattr_getpshared(&attr, &pshared);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(pshared == PTHREAD_PROCESS_PRIVATE);
+
+  eno = pthread_rwlock_init(&ctx->posix_scalable_rwlock, &attr);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlockattr_destroy(&attr);
+  rtems_test_assert(eno == 0);
+
+  rtems_rwlock_init(&ctx->rwlock, "RW");
+  rtems_test_assert(strcmp(rtems_rwlock_get_name(&ctx->rwlock), "RW") == 0);
+}
+
+static void test_exclusion(test_context *ctx)
+{
+  int eno;
+
+  eno = pthread_rwlock_rdlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_tryrdlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_trywrlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == EBUSY);
+
+  eno = pthread_rwlock_destroy(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == EBUSY);
+
+  eno = pthread_rwlock_unlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_unlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_trywrlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_tryrdlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == EBUSY);
+
+  eno = pthread_rwlock_unlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == 0);
+
+  rtems_rwlock_read_lock(&ctx->rwlock);
+  rtems_test_assert(rtems_rwlock_try_read_lock(&ctx->rwlock) == 0);
+  rtems_test_assert(rtems_rwlock_try_write_lock(&ctx->rwlock) == EBUSY);
+  rtems_rwlock_read_unlock(&ctx->rwlock);
+  rtems_rwlock_read_unlock(&ctx->rwlock);
+
+  rtems_test_assert(rtems_rwlock_try_write_lock(&ctx->rwlock) == 0);
+  rtems_test_assert(rtems_rwlock_try_read_lock(&ctx->rwlock) == EBUSY);
+  rtems_rwlock_write_unlock(&ctx->rwlock);
+}
+
+static void test_timeout(test_context *ctx)
+{
+  struct timespec abstime;
+  int eno;
+  int rv;
+
+  eno = pthread_rwlock_rdlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == 0);
+
+  rv = clock_gettime(CLOCK_REALTIME, &abstime);
+  rtems_test_assert(rv == 0);
+
+  abstime.tv_nsec += 10000000;
+
+  if (abstime.tv_nsec >= 1000000000) {
+    abstime.tv_nsec -= 1000000000;
+    ++abstime.tv_sec;
+  }
+
+  /*
+   * The RWLock is obtained for writing, however, the wait for the fast path
+   * reader times out.  The RWLock shall be released again.
+   */
+  eno = pthread_rwlock_timedwrlock(&ctx->posix_scalable_rwlock, &abstime);
+  rtems_test_assert(eno == ETIMEDOUT);
+
+  eno = pthread_rwlock_tryrdlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_unlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_unlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_timedwrlock(&ctx->posix_scalable_rwlock, &abstime);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_unlock(&ctx->posix_scalable_rwlock);
+  rtems_test_assert(eno == 0);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  const char *test = "SMPRWLock01";
+
+  create_rwlocks(ctx);
+  test_exclusion(ctx);
+  test_timeout(ctx);
+
+  printf("<%s>\n", test);
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("</%s>\n", test);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,321 @@
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "SPFIFO 6";
+
+#define TRANSFER_SIZE (1024 * 1024)
+
+#define MAX_WRITE_SIZE (64 * 1024)
+
+typedef struct {
+  int fds[2];
+  rtems_id writer;
+} test_context;
+
+static test_context test_instance;
+
+static unsigned char tx_buf[TRANSFER_SIZE];
+
+static unsigned char rx_buf[MAX_WRITE_SIZE];
+
+static void reader_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    size_t received = 0;
+    rtems_status_code sc;
+
+    while (received < TRANSFER_SIZE) {
+      ssize_t n;
+
+      n = read(ctx->fds[0], rx_buf, sizeof(rx_buf));
+      rtems_test_assert(n > 0);
+      rtems_test_assert(memcmp(&tx_buf[received], rx_buf, (size_t) n) == 0);
+      received += (size_t) n;
+    }
+
+    sc = rtems_event_transient_send(ctx->writer);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_capacity(test_context *ctx)
+{
+  int fd;
+  int size;
+  ssize_t n;
+  int rv;
+
+  size = fcntl(ctx->fds[1], F_GETPIPE_SZ);
+  rtems_test_assert(size == PIPE_BUF);
+
+  /* The capacity is rounded up to a multiple of PIPE_BUF */
+  size = fcntl(ctx->fds[1], F_SETPIPE_SZ, PIPE_BUF + 1);
+  rtems_test_assert(size == 2 * PIPE_BUF);
+
+  size = fcntl(ctx->fds[0], F_GETPIPE_SZ);
+  rtems_test_assert(size == 2 * PIPE_BUF);
+
+  errno = 0;
+  size = fcntl(ctx->fds[1], F_SETPIPE_SZ, -1);
+  rtems_test_assert(size == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  errno = 0;
+  size = fcntl(ctx->fds[1], F_SETPIPE_SZ, 2 * 1024 * 1024);
+  rtems_test_assert(size == -1);
+  rtems_test_assert(errno == EPERM);
+
+  /* The pipe buffer grows on demand up to the capacity */
+  rv = fcntl(ctx->fds[1], F_SETFL, O_NONBLOCK);
+  rtems_test_assert(rv == 0);
+
+  n = write(ctx->fds[1], tx_buf, 2 * PIPE_BUF);
+  rtems_test_assert(n == 2 * PIPE_BUF);
+
+  errno = 0;
+  n = write(ctx->fds[1], tx_buf, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EAGAIN);
+
+  /* The capacity cannot be less than the pipe contents */
+  errno = 0;
+  size = fcntl(ctx->fds[1], F_SETPIPE_SZ, PIPE_BUF);
+  rtems_test_assert(size == -1);
+  rtems_test_assert(errno == EBUSY);
+
+  n = read(ctx->fds[0], rx_buf, sizeof(rx_buf));
+  rtems_test_assert(n == 2 * PIPE_BUF);
+  rtems_test_assert(memcmp(tx_buf, rx_buf, 2 * PIPE_BUF) == 0);
+
+  size = fcntl(ctx->fds[1], F_SETPIPE_SZ, 0);
+  rtems_test_assert(size == PIPE_BUF);
+
+  rv = fcntl(ctx->fds[1], F_SETFL, 0);
+  rtems_test_assert(rv == 0);
+
+  /* Other files have no pipe capacity */
+  fd = open("/file", O_RDWR | O_CREAT, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  size = fcntl(fd, F_GETPIPE_SZ);
+  rtems_test_assert(size == -1);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink("/file");
+  rtems_test_assert(rv == 0);
+}
+
+static void blocked_writer_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+  rtems_status_code sc;
+  ssize_t n;
+
+  n = write(ctx->fds[1], tx_buf, 1);
+  rtems_test_assert(n == 1);
+
+  sc = rtems_event_transient_send(ctx->writer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  (void) rtems_task_suspend(RTEMS_SELF);
+}
+
+static void test_writer_wakeup(test_context *ctx, int capacity)
+{
+  rtems_status_code sc;
+  rtems_id id;
+  int size;
+  ssize_t n;
+  int rv;
+
+  size = fcntl(ctx->fds[1], F_SETPIPE_SZ, capacity);
+  rtems_test_assert(size == capacity);
+
+  rv = fcntl(ctx->fds[1], F_SETFL, O_NONBLOCK);
+  rtems_test_assert(rv == 0);
+
+  do {
+    n = write(ctx->fds[1], tx_buf, 1);
+  } while (n == 1);
+
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EAGAIN);
+
+  rv = fcntl(ctx->fds[1], F_SETFL, 0);
+  rtems_test_assert(rv == 0);
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'R', 'I', 'T'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, blocked_writer_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Let the writer block on the full pipe */
+  sc = rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /*
+   * A waiting writer is woken up as soon as its write fits into the pipe,
+   * even if the readers stop reading before the batch size is reached.
+   */
+  n = read(ctx->fds[0], rx_buf, 1);
+  rtems_test_assert(n == 1);
+
+  sc = rtems_event_transient_receive(
+    RTEMS_WAIT,
+    rtems_clock_get_ticks_per_second()
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  n = read(ctx->fds[0], rx_buf, sizeof(rx_buf));
+  rtems_test_assert(n == capacity);
+
+  size = fcntl(ctx->fds[1], F_SETPIPE_SZ, 0);
+  rtems_test_assert(size == PIPE_BUF);
+}
+
+static uint64_t throughput(uint64_t bytes, uint64_t ns)
+{
+  if (ns == 0) {
+    ns = 1;
+  }
+
+  return (bytes * 1000000000) / (ns * 1024);
+}
+
+static void test_throughput(test_context *ctx, int capacity)
+{
+  size_t write_size;
+  int size;
+
+  size = fcntl(ctx->fds[1], F_SETPIPE_SZ, capacity);
+  rtems_test_assert(size == capacity);
+
+  for (write_size = 64; write_size <= MAX_WRITE_SIZE; write_size *= 4) {
+    size_t sent;
+    uint64_t begin;
+    uint64_t ns;
+    rtems_status_code sc;
+
+    sent = 0;
+    begin = rtems_clock_get_uptime_nanoseconds();
+
+    while (sent < TRANSFER_SIZE) {
+      ssize_t n;
+
+      n = write(ctx->fds[1], &tx_buf[sent], write_size);
+      rtems_test_assert(n == (ssize_t) write_size);
+      sent += write_size;
+    }
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ns = rtems_clock_get_uptime_nanoseconds() - begin;
+
+    printf(
+      "capacity %6i, write %5zu: %7" PRIu64 " us, %6" PRIu64 " KiB/s\n",
+      capacity,
+      write_size,
+      ns / 1000,
+      throughput(TRANSFER_SIZE, ns)
+    );
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  rtems_id id;
+  size_t i;
+  int rv;
+
+  (void) arg;
+  TEST_BEGIN();
+
+  for (i = 0; i < sizeof(tx_buf); ++i) {
+    tx_buf[i] = (unsigned char) (i * 13 + (i >> 9));
+  }
+
+  ctx->writer = rtems_task_self();
+
+  rv = pipe(ctx->fds);
+  rtems_test_assert(rv == 0);
+
+  test_capacity(ctx);
+  test_writer_wakeup(ctx, PIPE_BUF);
+  test_writer_wakeup(ctx, 4 * PIPE_BUF);
+
+  sc = rtems_task_create(
+    rtems_build_name('R', 'E', 'A', 'D'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, reader_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_throughput(ctx, PIPE_BUF);
+  test_throughput(ctx, 16 * 1024);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_IMFS_ENABLE_MKFIFO
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
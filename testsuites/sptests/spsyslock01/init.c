@@ -25,6 +25,8 @@
 #include <string.h>
 #include <time.h>
 
+#include <rtems/thread.h>
+
 const char rtems_test_name[] = "SPSYSLOCK 1";
 
 #define US_PER_TICK 10000
@@ -49,6 +51,8 @@ const char rtems_test_name[] = "SPSYSLOCK 1";
 
 #define EVENT_CONDITION_WAIT_REC RTEMS_EVENT_10
 
+#define EVENT_FUTEX_WAIT_BITSET RTEMS_EVENT_11
+
 typedef struct {
   rtems_id high[2];
   rtems_id mid;
@@ -58,7 +62,9 @@ typedef struct {
   struct _Condition_Control cond;
   struct _Semaphore_Control sem;
   struct _Futex_Control futex;
+  struct _Futex_Control futex_2;
   int val;
+  uint32_t bitset[2];
   int eno[2];
   int generation[2];
   int current_generation[2];
@@ -161,12 +167,14 @@ static void test_initialization(test_context *ctx)
   _Condition_Initialize(&ctx->cond);
   _Semaphore_Initialize(&ctx->sem, 1);
   _Futex_Initialize(&ctx->futex);
+  _Futex_Initialize(&ctx->futex_2);
 
   rtems_test_assert(eq_mtx(&mtx, &ctx->mtx));
   rtems_test_assert(eq_rec_mtx(&rec_mtx, &ctx->rec_mtx));
   rtems_test_assert(eq_cond(&cond, &ctx->cond));
   rtems_test_assert(eq_sem(&sem, &ctx->sem));
   rtems_test_assert(eq_futex(&futex, &ctx->futex));
+  rtems_test_assert(eq_futex(&futex, &ctx->futex_2));
 
   _Mutex_Destroy(&mtx);
   _Mutex_recursive_Destroy(&rec_mtx);
@@ -539,6 +547,123 @@ static void test_futex(test_context *ctx)
   rtems_test_assert(ctx->eno[b] == 0);
 }
 
+static void test_futex_bitset(test_context *ctx)
+{
+  struct _Futex_Control *futex = &ctx->futex;
+  size_t a = 0;
+  size_t b = 1;
+  int eno;
+  int woken;
+
+  ctx->val = 1;
+
+  eno = _Futex_Wait_bitset(futex, &ctx->val, 1, 0);
+  rtems_test_assert(eno == EINVAL);
+
+  eno = _Futex_Wait_bitset(futex, &ctx->val, 0, 1);
+  rtems_test_assert(eno == EWOULDBLOCK);
+
+  ctx->bitset[a] = 0x1;
+  ctx->bitset[b] = 0x6;
+  ctx->eno[a] = -1;
+  ctx->eno[b] = -1;
+  send_event(ctx, a, EVENT_FUTEX_WAIT_BITSET);
+  send_event(ctx, b, EVENT_FUTEX_WAIT_BITSET);
+  rtems_test_assert(ctx->eno[a] == -1);
+  rtems_test_assert(ctx->eno[b] == -1);
+
+  woken = _Futex_Wake_bitset(futex, INT_MAX, 0x8);
+  rtems_test_assert(woken == 0);
+
+  woken = _Futex_Wake_bitset(futex, INT_MAX, 0x4);
+  rtems_test_assert(woken == 1);
+  rtems_test_assert(ctx->eno[a] == -1);
+  rtems_test_assert(ctx->eno[b] == 0);
+
+  woken = _Futex_Wake_bitset(futex, INT_MAX, 0x4);
+  rtems_test_assert(woken == 0);
+
+  woken = _Futex_Wake(futex, INT_MAX);
+  rtems_test_assert(woken == 1);
+  rtems_test_assert(ctx->eno[a] == 0);
+
+  ctx->eno[a] = -1;
+  ctx->eno[b] = -1;
+  send_event(ctx, a, EVENT_FUTEX_WAIT_BITSET);
+  send_event(ctx, b, EVENT_FUTEX_WAIT_BITSET);
+
+  woken = _Futex_Wake_bitset(futex, 1, 0x3);
+  rtems_test_assert(woken == 1);
+  rtems_test_assert(ctx->eno[a] == 0);
+  rtems_test_assert(ctx->eno[b] == -1);
+
+  woken = _Futex_Wake_bitset(futex, 1, 0x3);
+  rtems_test_assert(woken == 1);
+  rtems_test_assert(ctx->eno[b] == 0);
+}
+
+static void test_futex_requeue(test_context *ctx)
+{
+  struct _Futex_Control *futex = &ctx->futex;
+  struct _Futex_Control *futex_2 = &ctx->futex_2;
+  size_t a = 0;
+  size_t b = 1;
+  int eno;
+  int count;
+
+  ctx->val = 1;
+
+  count = -1;
+  eno = _Futex_Requeue(futex, &ctx->val, 0, 1, futex_2, INT_MAX, &count);
+  rtems_test_assert(eno == EAGAIN);
+  rtems_test_assert(count == 0);
+
+  count = -1;
+  eno = _Futex_Requeue(futex, &ctx->val, 1, 1, futex_2, INT_MAX, &count);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(count == 0);
+
+  ctx->eno[a] = -1;
+  ctx->eno[b] = -1;
+  send_event(ctx, a, EVENT_FUTEX_WAIT);
+  send_event(ctx, b, EVENT_FUTEX_WAIT);
+
+  eno = _Futex_Requeue(futex, &ctx->val, 1, 1, futex_2, INT_MAX, &count);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(count == 2);
+  rtems_test_assert(ctx->eno[a] == 0);
+  rtems_test_assert(ctx->eno[b] == -1);
+
+  count = _Futex_Wake(futex, INT_MAX);
+  rtems_test_assert(count == 0);
+  rtems_test_assert(ctx->eno[b] == -1);
+
+  count = _Futex_Wake(futex_2, INT_MAX);
+  rtems_test_assert(count == 1);
+  rtems_test_assert(ctx->eno[b] == 0);
+
+  ctx->eno[a] = -1;
+  ctx->eno[b] = -1;
+  send_event(ctx, a, EVENT_FUTEX_WAIT);
+  send_event(ctx, b, EVENT_FUTEX_WAIT);
+
+  eno = _Futex_Requeue(futex, &ctx->val, 1, 0, futex_2, 1, &count);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(count == 1);
+  rtems_test_assert(ctx->eno[a] == -1);
+  rtems_test_assert(ctx->eno[b] == -1);
+
+  count = _Futex_Wake(futex_2, INT_MAX);
+  rtems_test_assert(count == 1);
+  rtems_test_assert(ctx->eno[a] == 0);
+  rtems_test_assert(ctx->eno[b] == -1);
+
+  eno = _Futex_Requeue(futex, &ctx->val, 1, 1, futex, INT_MAX, &count);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(count == 1);
+  rtems_test_assert(ctx->eno[b] == 0);
+}
+
 static void test_sched(void)
 {
   rtems_test_assert(_Sched_Index() == 0);
@@ -632,6 +757,15 @@ static void high_task(rtems_task_argument idx)
       ctx->eno[idx] = _Futex_Wait(&ctx->futex, &ctx->val, 1);
     }
 
+    if ((events & EVENT_FUTEX_WAIT_BITSET) != 0) {
+      ctx->eno[idx] = _Futex_Wait_bitset(
+        &ctx->futex,
+        &ctx->val,
+        1,
+        ctx->bitset[idx]
+      );
+    }
+
     if ((events & EVENT_CONDITION_WAIT) != 0) {
       _Mutex_Acquire(&ctx->mtx);
       ctx->generation[idx] = generation(ctx, idx);
@@ -710,6 +844,8 @@ static void test(void)
   test_sem(ctx);
   test_sem_prio_wait_order(ctx);
   test_futex(ctx);
+  test_futex_bitset(ctx);
+  test_futex_requeue(ctx);
   test_sched();
 
   sc = rtems_task_delete(ctx->mid);
@@ -726,6 +862,7 @@ static void test(void)
   _Condition_Destroy(&ctx->cond);
   _Semaphore_Destroy(&ctx->sem);
   _Futex_Destroy(&ctx->futex);
+  _Futex_Destroy(&ctx->futex_2);
 }
 
 static void Init(rtems_task_argument arg)
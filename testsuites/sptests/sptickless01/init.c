@@ -0,0 +1,154 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <time.h>
+
+#include <bsp.h>
+#include <rtems.h>
+#include <rtems/cpuuse.h>
+#include <rtems/printer.h>
+#include <rtems/test-info.h>
+#include <rtems/timespec.h>
+#include <rtems/score/percpu.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPTICKLESS 1";
+
+static void test_wake_after(rtems_interval interval)
+{
+  rtems_status_code sc;
+  rtems_interval start;
+  rtems_interval elapsed;
+
+  /* Synchronize with the clock tick */
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  start = rtems_clock_get_ticks_since_boot();
+  sc = rtems_task_wake_after(interval);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  elapsed = rtems_clock_get_ticks_since_boot() - start;
+
+  rtems_test_assert(elapsed >= interval);
+  rtems_test_assert(elapsed <= interval + 1);
+}
+
+static void test_nanosleep(long nanoseconds)
+{
+  struct timespec start;
+  struct timespec end;
+  struct timespec elapsed;
+  struct timespec delay;
+  struct timespec max;
+  int rv;
+
+  rtems_timespec_set(&delay, 0, nanoseconds);
+  rtems_timespec_set(
+    &max,
+    0,
+    nanoseconds + 2 * (long) rtems_configuration_get_nanoseconds_per_tick()
+  );
+
+  rv = clock_gettime(CLOCK_MONOTONIC, &start);
+  rtems_test_assert(rv == 0);
+
+  rv = clock_nanosleep(CLOCK_MONOTONIC, 0, &delay, NULL);
+  rtems_test_assert(rv == 0);
+
+  rv = clock_gettime(CLOCK_MONOTONIC, &end);
+  rtems_test_assert(rv == 0);
+
+  rtems_timespec_subtract(&start, &end, &elapsed);
+  rtems_test_assert(!rtems_timespec_less_than(&elapsed, &delay));
+  rtems_test_assert(!rtems_timespec_greater_than(&elapsed, &max));
+}
+
+static void test_idle_statistics(void)
+{
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+  uint64_t wakeups_avoided;
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+  wakeups_avoided = 0;
+
+  for (cpu_index = 0; cpu_index < cpu_max; ++cpu_index) {
+    const Per_CPU_Control *cpu;
+
+    cpu = _Per_CPU_Get_by_index(cpu_index);
+    rtems_test_assert(cpu->Idle.tickless);
+    wakeups_avoided += cpu->Idle.wakeups_avoided;
+  }
+
+  /* The long sleeps above must have been spent without clock interrupts */
+  rtems_test_assert(wakeups_avoided > 0);
+#endif
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_printer printer;
+  rtems_interval ticks_per_second;
+
+  TEST_BEGIN();
+
+  ticks_per_second = rtems_clock_get_ticks_per_second();
+
+  test_wake_after(1);
+  test_wake_after(2);
+  test_wake_after(ticks_per_second / 10);
+  test_wake_after(ticks_per_second);
+  test_nanosleep(1000000);
+  test_nanosleep(50000000);
+  test_nanosleep(500000000);
+  test_idle_statistics();
+
+  rtems_print_printer_printf(&printer);
+  rtems_cpu_info_report(&printer);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>